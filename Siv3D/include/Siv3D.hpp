@@ -209,6 +209,9 @@
 // 動的配列（二次元）| 2D array
 # include <Siv3D/Grid.hpp>
 
+// インターン化された文字列 | Interned string
+# include <Siv3D/InternedString.hpp>
+
 // 文字列ルックアップヘルパー | Heterogeneous lookup helper
 # include <Siv3D/HeterogeneousLookupHelper.hpp>
 
@@ -248,6 +251,9 @@
 // 子プロセス | Child process
 # include <Siv3D/ChildProcess.hpp>
 
+// プロセスプール | Process pool
+# include <Siv3D/ProcessPool.hpp>
+
 ////////////////////////////////////////////////////////////////
 //
 //	文字列フォーマット | Formatting
@@ -282,6 +288,7 @@
 
 // フォーマット | Format
 # include <Siv3D/Format.hpp>
+# include <Siv3D/InlineFormat.hpp>
 
 // フォーマットリテラル | Format literal
 # include <Siv3D/FormatLiteral.hpp>
@@ -391,6 +398,7 @@
 ////////////////////////////////////////////////////////////////
 
 # include <Siv3D/FrameMetrics.hpp>
+# include <Siv3D/EngineInitMetrics.hpp>
 
 // プロファイラー | Profiler
 # include <Siv3D/Profiler.hpp>
@@ -437,6 +445,15 @@
 // ファイルとディレクトリの変更の監視 | Directory watcher
 # include <Siv3D/DirectoryWatcher.hpp>
 
+// ディレクトリのエントリ | Directory entry
+# include <Siv3D/DirectoryEntry.hpp>
+
+// ディレクトリの列挙のオプション | Directory walker options
+# include <Siv3D/DirectoryWalkerOptions.hpp>
+
+// ディレクトリの並列な列挙 | Directory walker
+# include <Siv3D/DirectoryWalker.hpp>
+
 // 所有権を持たない、メモリ範囲への IReader インタフェース | IReader Wrapper for Non-Owning Memory Range 
 # include <Siv3D/MemoryViewReader.hpp>
 
@@ -683,6 +700,9 @@
 // 数式パーサ | Math parser
 # include <Siv3D/MathParser.hpp>
 
+// コンパイル済みの数式 | Compiled expression
+# include <Siv3D/CompiledExpression.hpp>
+
 //// 統計 | Statistics
 //# include <Siv3D/Statistics.hpp>
 //
@@ -788,6 +808,9 @@
 // ランダムな色の作成 | Random Color generation
 # include <Siv3D/RandomColor.hpp>
 
+// 乱数による配列の一括生成 | Bulk random number generation
+# include <Siv3D/RandomFill.hpp>
+
 //// ランダムなサンプリング | Random sampling
 # include <Siv3D/Sample.hpp>
 
@@ -823,6 +846,9 @@
 // 2D 描画の頂点 | Vertex elements for 2D rendering
 # include <Siv3D/Vertex2D.hpp>
 
+// 2D 描画の頂点（GPU 転送用の圧縮形式） | Packed vertex elements for 2D rendering
+# include <Siv3D/Vertex2DPacked.hpp>
+
 // 円座標 | Polar coordinates system (2D)
 # include <Siv3D/Circular.hpp>
 
@@ -1070,6 +1096,12 @@
 // OSC 受信メッセージ
 # include <Siv3D/OSCReceivedMessage.hpp>
 
+// OSC 受信メッセージの引数の参照
+# include <Siv3D/OSCArgumentView.hpp>
+
+// OSC 受信メッセージの参照
+# include <Siv3D/OSCReceivedMessageView.hpp>
+
 // OSC 受信クラス
 # include <Siv3D/OSCReceiver.hpp>
 
@@ -1246,6 +1278,9 @@
 // 画像の情報 | Image information
 # include <Siv3D/ImageInfo.hpp>
 
+// 画像の拡大縮小に使うフィルタ | Filters for image scaling
+# include <Siv3D/ResizeFilter.hpp>
+
 //// ピクセルアドレスモード | Image address mode
 //# include <Siv3D/ImageAddressMode.hpp>
 //
@@ -1294,6 +1329,9 @@
 //
 ////////////////////////////////////////////////////////////////
 
+// 画像デコードのオプション | Image decode options
+# include <Siv3D/ImageDecodeOptions.hpp>
+
 // 画像デコーダのインタフェース | Image decoder interface
 # include <Siv3D/IImageDecoder.hpp>
 
@@ -1336,6 +1374,7 @@
 
 // BCn 画像 | BCn image
 # include <Siv3D/BCnData.hpp>
+# include <Siv3D/BCnQuality.hpp>
 # include <Siv3D/ImageFormat/BCnDecoder.hpp>
 # include <Siv3D/ImageFormat/BCnEncoder.hpp>
 
@@ -1351,6 +1390,10 @@
 # include <Siv3D/ImageFormat/TGADecoder.hpp>
 # include <Siv3D/ImageFormat/TGAEncoder.hpp>
 
+// QOI 画像 | QOI image
+# include <Siv3D/ImageFormat/QOIDecoder.hpp>
+# include <Siv3D/ImageFormat/QOIEncoder.hpp>
+
 //// アニメーション GIF の読み込み | Animated GIF reader
 //# include <Siv3D/AnimatedGIFReader.hpp>
 //
@@ -1678,9 +1721,11 @@
 
 # include <Siv3D/TextLayoutResult.hpp>
 # include <Siv3D/DrawableText.hpp>
+# include <Siv3D/TextLayout.hpp>
 # include <Siv3D/TextStyle.hpp>
 
 # include <Siv3D/GlyphContext.hpp>
+# include <Siv3D/GlyphQuad.hpp>
 # include <Siv3D/ITextEffect.hpp>
 # include <Siv3D/TextEffect/NullTextEffect.hpp>
 # include <Siv3D/TextEffect/BasicTextEffect.hpp>
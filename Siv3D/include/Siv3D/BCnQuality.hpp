@@ -0,0 +1,41 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	BCnQuality
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief BCn 形式エンコード時の品質と速度のトレードオフ
+	enum class BCnQuality : uint8
+	{
+		/// @brief 最も高速で、品質は最も低い
+		Fastest,
+
+		/// @brief 高速で、品質はやや低い
+		Fast,
+
+		/// @brief 標準
+		Default,
+
+		/// @brief 低速で、品質はやや高い（BC7 のみ効果があります）
+		High,
+
+		/// @brief 最も低速で、品質は最も高い（BC7 のみ効果があります）
+		Highest,
+	};
+}
@@ -172,6 +172,43 @@ namespace s3d
 		[[nodiscard]]
 		std::ostream& ostream();
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	tryRead
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 子プロセスの標準出力から、ブロックせずに読み込めるだけのデータを読み込みます。
+		/// @param dst 読み込み先のバッファ
+		/// @param size 読み込む最大のサイズ（バイト）
+		/// @return 読み込んだサイズ（バイト）。現在読み込めるデータが無い場合は 0, 標準出力が閉じられた場合やエラーが発生した場合は none
+		/// @remark `Pipe::StdIn` または `Pipe::StdInOut` を指定して作成した場合に使用できます。
+		[[nodiscard]]
+		Optional<size_t> tryRead(void* dst, size_t size);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	tryWrite
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 子プロセスの標準入力に、ブロックせずに書き込めるだけのデータを書き込みます。
+		/// @param src 書き込むデータ
+		/// @param size 書き込むデータのサイズ（バイト）
+		/// @return 書き込んだサイズ（バイト）。パイプに空きが無い場合は 0, 標準入力が閉じられた場合やエラーが発生した場合は none
+		/// @remark `Pipe::StdOut` または `Pipe::StdInOut` を指定して作成した場合に使用できます。
+		/// @remark Windows では、パイプに空きができるまでブロックする場合があります。
+		Optional<size_t> tryWrite(const void* src, size_t size);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	closeStdIn
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 子プロセスの標準入力を閉じ、子プロセスに入力の終わり (EOF) を伝えます。
+		void closeStdIn();
+
 	private:
 
 		class ChildProcessDetail;
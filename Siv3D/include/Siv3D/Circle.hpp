@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <span>
 # include "Common.hpp"
 # include "PointVector.hpp"
 # include "ColorHSV.hpp"
@@ -1270,6 +1271,24 @@ namespace s3d
 		[[nodiscard]]
 		static Circle FromPoints(const position_type& p0, const position_type& p1, const position_type& p2) noexcept;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	DrawBatch
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の円をまとめて描きます。
+		/// @param circles 円の配列
+		/// @param color 円の色
+		/// @remark 頂点バッファをまとめて確保するため、`draw()` を繰り返し呼ぶよりも高速です。
+		static void DrawBatch(std::span<const Circle> circles, const ColorF& color = Palette::White);
+
+		/// @brief 複数の円を、それぞれ指定した色でまとめて描きます。
+		/// @param circles 円の配列
+		/// @param colors それぞれの円の色
+		/// @remark `circles` と `colors` の要素数が異なる場合、少ないほうの要素数だけ描きます。
+		static void DrawBatch(std::span<const Circle> circles, std::span<const ColorF> colors);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	operator <<
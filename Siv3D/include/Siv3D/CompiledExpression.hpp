@@ -0,0 +1,129 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <span>
+# include <initializer_list>
+# include "Common.hpp"
+# include "MathConstants.hpp"
+
+namespace s3d
+{
+	class MathParser;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	CompiledExpression
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief `MathParser::compile()` で作成する、コンパイル済みの数式
+	/// @remark 作成後は内容が変化しないため、複数のスレッドから同時に評価できます。
+	/// @remark 列として指定しなかった変数は、コンパイル時点の値を定数として扱います。
+	/// @remark 三項演算子 `?:` は両方の分岐を評価してから結果を選択するため、副作用のある関数を分岐内で使う場合は注意してください。
+	class CompiledExpression
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		CompiledExpression() = default;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isValid
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief コンパイル済みの数式を持っているかを返します。
+		/// @return コンパイル済みの数式を持っている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isValid() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief コンパイル済みの数式を持っているかを返します。
+		/// @return コンパイル済みの数式を持っている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_columns
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 数式の入力となる列の数を返します。
+		/// @return 列の数
+		[[nodiscard]]
+		size_t num_columns() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	eval
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 1 行分の値を与えて数式を評価します。
+		/// @param values 各列の値
+		/// @return 数式を評価した結果。値の数が列の数と一致しない場合や、数式が無効な場合は Math::NaN
+		[[nodiscard]]
+		double eval(std::initializer_list<double> values) const;
+
+		/// @brief 1 行分の値を与えて数式を評価します。
+		/// @param values 各列の値
+		/// @return 数式を評価した結果。値の数が列の数と一致しない場合や、数式が無効な場合は Math::NaN
+		[[nodiscard]]
+		double eval(std::span<const double> values) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	evalColumns
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 列ごとの値の配列を与えて、各行の数式を評価します。
+		/// @param columns 各列の値の配列。`compile()` で指定した変数の順に並べます。
+		/// @param out 結果の格納先。`out.size()` 行を評価します。
+		/// @return 評価した場合 true, 列の数が一致しないか、いずれかの列の要素数が `out.size()` より少ない場合は false
+		/// @remark 行数が多い場合は、複数のスレッドで分割して評価します。
+		bool evalColumns(std::initializer_list<std::span<const double>> columns, std::span<double> out) const;
+
+		/// @brief 列ごとの値の配列を与えて、各行の数式を評価します。
+		/// @param columns 各列の値の配列。`compile()` で指定した変数の順に並べます。
+		/// @param out 結果の格納先。`out.size()` 行を評価します。
+		/// @return 評価した場合 true, 列の数が一致しないか、いずれかの列の要素数が `out.size()` より少ない場合は false
+		/// @remark 行数が多い場合は、複数のスレッドで分割して評価します。
+		bool evalColumns(std::span<const std::span<const double>> columns, std::span<double> out) const;
+
+	private:
+
+		friend class MathParser;
+
+		class CompiledExpressionDetail;
+
+		std::shared_ptr<const CompiledExpressionDetail> pImpl;
+
+		[[nodiscard]]
+		explicit CompiledExpression(std::shared_ptr<const CompiledExpressionDetail>&& detail) noexcept;
+	};
+}
@@ -0,0 +1,83 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "DateTime.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryEntryType
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ディレクトリエントリの種類
+	enum class DirectoryEntryType : uint8
+	{
+		/// @brief ファイル
+		File,
+
+		/// @brief ディレクトリ
+		Directory,
+
+		/// @brief シンボリックリンク（リンク先はたどりません）
+		SymbolicLink,
+
+		/// @brief その他（デバイスファイルやソケットなど）
+		Other,
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryEntry
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ディレクトリの列挙で得られるエントリ
+	struct DirectoryEntry
+	{
+		/// @brief 絶対パス。ディレクトリの場合は末尾に '/' が付加されます。
+		FilePath path;
+
+		/// @brief ファイルのサイズ（バイト）。ファイル以外の場合は 0
+		uint64 size = 0;
+
+		/// @brief 最終更新日時（1970-01-01 00:00:00 UTC からの経過時間 [ナノ秒]）
+		int64 writeTimeNs = 0;
+
+		/// @brief エントリの種類
+		DirectoryEntryType type = DirectoryEntryType::File;
+
+		/// @brief ファイルであるかを返します。
+		/// @return ファイルである場合 true, それ以外の場合は false
+		[[nodiscard]]
+		constexpr bool isFile() const noexcept
+		{
+			return (type == DirectoryEntryType::File);
+		}
+
+		/// @brief ディレクトリであるかを返します。
+		/// @return ディレクトリである場合 true, それ以外の場合は false
+		[[nodiscard]]
+		constexpr bool isDirectory() const noexcept
+		{
+			return (type == DirectoryEntryType::Directory);
+		}
+
+		/// @brief 最終更新日時をローカル時刻で返します。
+		/// @return 最終更新日時
+		[[nodiscard]]
+		DateTime writeTime() const;
+	};
+}
@@ -0,0 +1,172 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <iterator>
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "DirectoryEntry.hpp"
+# include "DirectoryWalkerOptions.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryWalker
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ディレクトリの中身を、サイズや最終更新日時とともに複数のスレッドで列挙するクラス
+	/// @remark 列挙は作成と同時にバックグラウンドで始まり、結果は `next()` や範囲 for 文で順に取り出せます。
+	/// @remark 取り出されていない結果が一定数を超えると列挙を一時停止するため、巨大なディレクトリでもメモリ使用量は一定に保たれます。
+	/// @remark エントリの順番は不定です。
+	class DirectoryWalker
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Iterator
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 列挙結果を順に取り出す入力イテレータ
+		class Iterator
+		{
+		public:
+
+			using difference_type	= std::ptrdiff_t;
+			using value_type		= DirectoryEntry;
+			using iterator_concept	= std::input_iterator_tag;
+
+			[[nodiscard]]
+			Iterator() = default;
+
+			[[nodiscard]]
+			explicit Iterator(DirectoryWalker* walker);
+
+			Iterator& operator ++();
+
+			void operator ++(int);
+
+			[[nodiscard]]
+			const DirectoryEntry& operator *() const noexcept;
+
+			[[nodiscard]]
+			const DirectoryEntry* operator ->() const noexcept;
+
+			[[nodiscard]]
+			bool operator ==(std::default_sentinel_t) const noexcept;
+
+		private:
+
+			DirectoryWalker* m_walker = nullptr;
+
+			DirectoryEntry m_entry;
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		DirectoryWalker() = default;
+
+		/// @brief ディレクトリの列挙を開始します。
+		/// @param directory 列挙するディレクトリ
+		/// @param options オプション
+		[[nodiscard]]
+		explicit DirectoryWalker(FilePathView directory, const DirectoryWalkerOptions& options = {});
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isOpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 列挙を開始できたかを返します。
+		/// @return 列挙を開始できた場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 列挙を開始できたかを返します。
+		/// @return 列挙を開始できた場合 true, それ以外の場合は false
+		/// @remark isOpen() と同じです。
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	next
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 次のエントリを取り出します。必要に応じて列挙が進むまで待機します。
+		/// @param entry 取り出したエントリの格納先
+		/// @return エントリを取り出した場合 true, すべてのエントリを取り出し終えた場合は false
+		bool next(DirectoryEntry& entry);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	readAll
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 残りのすべてのエントリを取り出します。
+		/// @return 残りのすべてのエントリ
+		[[nodiscard]]
+		Array<DirectoryEntry> readAll();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	directory
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 列挙しているディレクトリのパスを返します。
+		/// @return 列挙しているディレクトリのパス
+		[[nodiscard]]
+		const FilePath& directory() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	begin, end
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 列挙結果を順に取り出すイテレータを返します。
+		/// @return 列挙結果を順に取り出すイテレータ
+		[[nodiscard]]
+		Iterator begin();
+
+		/// @brief 列挙の終端を返します。
+		/// @return 列挙の終端
+		[[nodiscard]]
+		std::default_sentinel_t end() const noexcept;
+
+	private:
+
+		class DirectoryWalkerDetail;
+
+		std::shared_ptr<DirectoryWalkerDetail> pImpl;
+	};
+}
@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <functional>
+# include "Common.hpp"
+# include "DirectoryEntry.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryWalkerOptions
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief DirectoryWalker のオプション
+	struct DirectoryWalkerOptions
+	{
+		/// @brief ディレクトリの中身にあるディレクトリの中身も列挙する場合は `Recursive::Yes`, それ以外の場合は `Recursive::No`
+		Recursive recursive = Recursive::Yes;
+
+		/// @brief 結果に含めるエントリを選ぶ関数。空の場合はすべてのエントリを結果に含めます。
+		/// @remark 複数のスレッドから同時に呼ばれます。
+		std::function<bool(const DirectoryEntry&)> filter = {};
+
+		/// @brief 中身を列挙するディレクトリを選ぶ関数。空の場合はすべてのディレクトリの中身を列挙します。
+		/// @remark `filter` とは独立しています。結果に含めないディレクトリの中身を列挙することもできます。
+		/// @remark 複数のスレッドから同時に呼ばれます。
+		std::function<bool(const DirectoryEntry&)> directoryFilter = {};
+
+		/// @brief ファイルのサイズと最終更新日時を取得するか。false の場合、`DirectoryEntry::size` と `DirectoryEntry::writeTimeNs` は 0 になりますが、列挙は高速になります。
+		bool fetchMetadata = true;
+
+		/// @brief 列挙に使うスレッド数。0 の場合は `Threading::GetConcurrency()` を使います。
+		size_t numThreads = 0;
+	};
+}
@@ -14,6 +14,7 @@
 # include "FileChange.hpp"
 # include "Optional.hpp"
 # include "Array.hpp"
+# include "Duration.hpp"
 
 namespace s3d
 {
@@ -28,6 +29,9 @@ namespace s3d
 	{
 	public:
 
+		/// @brief 同じパスへの連続した変更をまとめる時間のデフォルト値（まとめない）
+		static constexpr Duration DefaultDebounceTime{ 0.0 };
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	(constructor)
@@ -41,8 +45,9 @@ namespace s3d
 		/// @brief ディレクトリを監視を開始します。
 		/// @param directory 監視するディレクトリ
 		/// @param applicableExtensions 監視するファイルの拡張子。空の場合はすべてのファイルを監視します。
+		/// @param debounceTime 同じパスへの連続した変更を 1 つの FileChange にまとめる時間。最後の変更からこの時間が経過すると `extractChanges()` で取得できるようになります。0 の場合はまとめずにすぐ取得できるようにします。
 		[[nodiscard]]
-		explicit DirectoryWatcher(FilePathView directory, const Array<String>& applicableExtensions = {});
+		explicit DirectoryWatcher(FilePathView directory, const Array<String>& applicableExtensions = {}, const Duration& debounceTime = DefaultDebounceTime);
 
 		////////////////////////////////////////////////////////////////
 		//
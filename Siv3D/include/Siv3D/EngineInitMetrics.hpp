@@ -0,0 +1,77 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ComponentInitTime
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief エンジンのコンポーネント 1 つの初期化時間
+	struct ComponentInitTime
+	{
+		/// @brief コンポーネントの名前
+		String name;
+
+		/// @brief 初期化の開始時刻（エンジンの初期化開始からの経過時間、マイクロ秒）
+		int64 startTimeUs = 0;
+
+		/// @brief 初期化にかかった時間（マイクロ秒）
+		int64 durationUs = 0;
+
+		/// @brief メインスレッド以外で初期化されたか
+		bool isAsync = false;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	EngineInitMetrics
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief エンジンの起動時の初期化時間
+	struct EngineInitMetrics
+	{
+		/// @brief コンポーネントの初期化全体にかかった時間（マイクロ秒）
+		int64 totalTimeUs = 0;
+
+		/// @brief 各コンポーネントの初期化時間（初期化を開始した順）
+		Array<ComponentInitTime> components;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	format
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		String format() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Formatter
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief EngineInitMetrics を文字列に変換します。
+		/// @param formatData 文字列バッファ
+		/// @param value EngineInitMetrics
+		/// @remark この関数は Format 用の関数です。通常、ユーザーが直接呼び出す必要はありません。
+		friend void Formatter(FormatData& formatData, const EngineInitMetrics& value);
+	};
+}
@@ -12,6 +12,7 @@
 # pragma once
 # include "FormatData.hpp"
 # include "Formatter.hpp"
+# include "Unicode.hpp"
 
 namespace s3d
 {
@@ -88,6 +89,44 @@ namespace s3d
 		/// @brief 文字列フォーマット
 		inline constexpr detail::Format_impl Format;
 	}
+
+	namespace detail
+	{
+		/// @brief 現在のスレッドの作業用バッファを取り出します。
+		/// @return 空の作業用バッファ
+		[[nodiscard]]
+		String AcquireFormatBuffer() noexcept;
+
+		/// @brief 作業用バッファを現在のスレッドに返却します。
+		/// @param buffer 作業用バッファ
+		void ReleaseFormatBuffer(String&& buffer) noexcept;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	FormatTo
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 一連の引数を文字列に変換して、既存の文字列の末尾に追加します。
+	/// @param out 追加先の文字列
+	/// @param ...args 変換する値
+	/// @remark `out` の確保済みの容量を再利用するため、容量が足りる限りメモリの確保は発生しません。
+	template <Concept::Formattable... Args>
+	void FormatTo(String& out, const Args&... args);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	FormatUTF8To
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 一連の引数を文字列に変換し、UTF-8 で既存の文字列の末尾に追加します。
+	/// @param out 追加先の文字列
+	/// @param ...args 変換する値
+	/// @remark 変換には `Format()` と同じ `Formatter()` が使われます。途中の UTF-32 の文字列はスレッドごとの作業用バッファに作られるため、メモリの確保は `out` の容量が足りない場合だけ発生します。
+	template <Concept::Formattable... Args>
+	void FormatUTF8To(std::string& out, const Args&... args);
 }
 
 # include "detail/Format.ipp"
@@ -0,0 +1,27 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "FloatRect.hpp"
+
+namespace s3d
+{
+	/// @brief TextEffect にまとめて渡すグリフの矩形
+	struct GlyphQuad
+	{
+		/// @brief 描画先の矩形
+		FloatRect rect;
+
+		/// @brief テクスチャ上の UV 座標
+		FloatRect uvRect;
+	};
+}
@@ -13,6 +13,7 @@
 # include "Common.hpp"
 # include "StringView.hpp"
 # include "String.hpp"
+# include "InternedString.hpp"
 
 namespace s3d
 {
@@ -37,6 +38,15 @@ namespace s3d
 		constexpr bool operator ()(const String& key, const char32* s) const noexcept { return (key == s); }
 		constexpr bool operator ()(const String& key, StringView s) const noexcept { return (key == s); }
 		constexpr bool operator ()(const String& key, const String& s) const noexcept { return (key == s); }
+
+		bool operator ()(const char32* key, const InternedString& s) const noexcept { return (key == s.view()); }
+		bool operator ()(StringView key, const InternedString& s) const noexcept { return (key == s.view()); }
+		bool operator ()(const String& key, const InternedString& s) const noexcept { return (key == s.view()); }
+
+		bool operator ()(const InternedString& key, const char32* s) const noexcept { return (key.view() == s); }
+		bool operator ()(const InternedString& key, StringView s) const noexcept { return (key.view() == s); }
+		bool operator ()(const InternedString& key, const String& s) const noexcept { return (key.view() == s); }
+		bool operator ()(const InternedString& key, const InternedString& s) const noexcept { return (key == s); }
 	};
 
 	////////////////////////////////////////////////////////////////
@@ -54,5 +64,6 @@ namespace s3d
 		size_t operator ()(StringView s) const noexcept { return hash_type{}(s); }
 		size_t operator ()(const String& s) const noexcept { return hash_type{}(s); }
 		size_t operator ()(const char32* s) const noexcept { return hash_type{}(s); }
+		size_t operator ()(const InternedString& s) const noexcept { return static_cast<size_t>(s.hash()); }
 	};
 }
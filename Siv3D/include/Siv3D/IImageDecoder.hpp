@@ -18,6 +18,7 @@
 # include "Optional.hpp"
 # include "Grid.hpp"
 # include "PredefinedYesNo.hpp"
+# include "ImageDecodeOptions.hpp"
 
 namespace s3d
 {
@@ -124,6 +125,22 @@ namespace s3d
 		/// @return デコードされた画像
 		[[nodiscard]]
 		virtual Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const = 0;
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @param path 画像ファイルのパス
+		/// @param options デコードのオプション
+		/// @return デコードされた画像
+		[[nodiscard]]
+		virtual Image decode(FilePathView path, const ImageDecodeOptions& options) const;
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @param reader Reader オブジェクト
+		/// @param pathHint 画像ファイルのパス（わかる場合）
+		/// @param options デコードのオプション
+		/// @return デコードされた画像
+		/// @remark デフォルトの実装では、フル解像度でデコードしたあとに `options.scaleDenominator` に従って縮小します。
+		[[nodiscard]]
+		virtual Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, const ImageDecodeOptions& options) const;
 	
 		////////////////////////////////////////////////////////////////
 		//
@@ -160,6 +160,18 @@ namespace s3d
 		/// @param dst 読み込んだデータの格納先 | The destination to store the read data
 		/// @return 読み込みに成功したら true, それ以外の場合は false | Returns true if the read was successful, otherwise false
 		bool lookahead(Concept::TriviallyCopyable auto& dst) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	data
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief データ全体がメモリ上に連続して配置されている場合、その先頭へのポインタを返します。 | Returns a pointer to the beginning of the data if the entire data is contiguous in memory.
+		/// @return データの先頭へのポインタ。連続したメモリ上にない場合は nullptr | A pointer to the beginning of the data, or nullptr if the data is not contiguous in memory
+		/// @remark デコーダはこのポインタから直接読み込むことで、データ全体のコピーを省略できます。 | Decoders can read directly from this pointer to avoid copying the entire data.
+		[[nodiscard]]
+		virtual const void* data() const noexcept;
 	};
 
 	////////////////////////////////////////////////////////////////
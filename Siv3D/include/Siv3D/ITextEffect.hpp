@@ -10,16 +10,31 @@
 //-----------------------------------------------
 
 # pragma once
+# include <span>
 # include "TextureRegion.hpp"
 
 namespace s3d
 {
 	struct GlyphContext;
+	struct GlyphQuad;
 
 	struct ITextEffect
 	{
 		virtual ~ITextEffect() = default;
 
 		virtual void draw(const TextureRegion& textureRegion, const GlyphContext& glyphContext) const = 0;
+
+		/// @brief 同じテクスチャ上の複数のグリフをまとめて描画します。
+		/// @param texture グリフが格納されているテクスチャ
+		/// @param glyphQuads 各グリフの描画先の矩形と UV 座標
+		/// @param glyphContexts 各グリフのコンテキスト
+		/// @remark デフォルトの実装はグリフごとに `draw()` を呼びます。頂点をまとめて生成できるエフェクトはオーバーライドしてください。
+		virtual void drawBatch(const Texture& texture, std::span<const GlyphQuad> glyphQuads, std::span<const GlyphContext> glyphContexts) const;
+
+		/// @brief `drawBatch()` がグリフの頂点をまとめて生成してよいかを返します。
+		/// @return `draw()` と同じ結果をまとめて描画できる場合 true, それ以外の場合は false
+		/// @remark デフォルトは false です。まとめて描画できるエフェクトは明示的にオーバーライドして true を返してください。
+		[[nodiscard]]
+		virtual bool isBatchable() const noexcept;
 	};
 }
@@ -706,7 +706,7 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		Blob encodePNG(PNGFilter filter = PNGFilter::Default) const;
+		Blob encodePNG(PNGFilter filter = PNGFilter::Default, Parallelize parallelize = Parallelize::No) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -0,0 +1,109 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Point.hpp"
+# include "Rect.hpp"
+# include "Optional.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ImageDecodeOptions
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 画像デコード時のオプション | Image decode options
+	/// @remark `sourceRect` で切り出した領域を `scaleDenominator` で縮小し、さらに `maxSize` に収まるよう縮小した画像を返します。
+	/// @remark PNG, BMP, TGA は 1 行ずつデコードしながら縮小し、JPEG は DCT の段階で縮小するため、必要なメモリは出力画像の大きさにほぼ比例します。
+	struct ImageDecodeOptions
+	{
+		/// @brief アルファ乗算処理を適用するか | Whether to apply premultiplied alpha
+		PremultiplyAlpha premultiplyAlpha = PremultiplyAlpha::Yes;
+
+		/// @brief 縮小デコードの分母（1, 2, 4, 8） | Denominator of the downscaled decode (1, 2, 4, 8)
+		/// @remark 2 の場合は幅と高さがそれぞれ 1/2 の画像を返します。JPEG は DCT の段階で縮小するため、フル解像度でデコードするより大幅に高速です。
+		/// @remark 縮小デコードに対応していないデコーダでは、フル解像度でデコードしたあとに縮小します。
+		int32 scaleDenominator = 1;
+
+		/// @brief 出力画像の最大サイズ | Maximum size of the output image
+		/// @remark 指定した場合、縦横比を保ったままこのサイズに収まるよう縮小します。拡大はしません。
+		Optional<Size> maxSize;
+
+		/// @brief デコードする元画像の領域 | Region of the source image to decode
+		/// @remark 画像の範囲外の部分は無視されます。指定しない場合は画像全体をデコードします。
+		Optional<Rect> sourceRect;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getScaleDenominator
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `scaleDenominator` を 1, 2, 4, 8 のいずれかに切り上げた値を返します。 | Returns `scaleDenominator` rounded up to one of 1, 2, 4, or 8.
+		/// @return 縮小デコードの分母 | The denominator of the downscaled decode
+		[[nodiscard]]
+		constexpr int32 getScaleDenominator() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getScaledSize
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief `scaleDenominator` による縮小後の画像サイズを返します。 | Returns the image size after downscaling by `scaleDenominator`.
+		/// @param size 元の画像サイズ | The original image size
+		/// @return 縮小後の画像サイズ（端数は切り上げ） | The downscaled image size (rounded up)
+		[[nodiscard]]
+		constexpr Size getScaledSize(const Size& size) const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getSourceRect
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デコードする元画像の領域を、画像の範囲内に収めて返します。 | Returns the region of the source image to decode, clamped to the image bounds.
+		/// @param imageSize 元の画像サイズ | The original image size
+		/// @return デコードする元画像の領域。範囲内に含まれる部分が無い場合は空の長方形 | The region to decode, or an empty rectangle if it does not overlap the image
+		[[nodiscard]]
+		constexpr Rect getSourceRect(const Size& imageSize) const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getOutputSize
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief すべてのオプションを適用したあとの出力画像のサイズを返します。 | Returns the size of the output image after applying all options.
+		/// @param imageSize 元の画像サイズ | The original image size
+		/// @return 出力画像のサイズ | The size of the output image
+		[[nodiscard]]
+		constexpr Size getOutputSize(const Size& imageSize) const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isFullDecode
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 画像全体を元のサイズのままデコードするかを返します。 | Returns whether the entire image is decoded at its original size.
+		/// @param imageSize 元の画像サイズ | The original image size
+		/// @return 画像全体を元のサイズのままデコードする場合 true, それ以外の場合は false | Returns true if the entire image is decoded at its original size, otherwise false
+		[[nodiscard]]
+		constexpr bool isFullDecode(const Size& imageSize) const noexcept;
+	};
+}
+
+# include "detail/ImageDecodeOptions.ipp"
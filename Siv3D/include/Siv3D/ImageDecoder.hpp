@@ -109,6 +109,60 @@ namespace s3d
 		[[nodiscard]]
 		Image Decode(Reader&& reader, PremultiplyAlpha premultiplyAlpha, StringView decoderName);
 
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @param path 画像ファイルのパス
+		/// @param options デコードのオプション
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルの拡張子から判断
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		/// @remark サムネイルの作成など、縮小した画像や一部の領域だけが必要な場合は `options.maxSize` や `options.sourceRect` を指定すると、少ないメモリで高速にデコードできます。
+		[[nodiscard]]
+		Image Decode(FilePathView path, const ImageDecodeOptions& options, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @param path 画像ファイルのパス
+		/// @param options デコードのオプション
+		/// @param decoderName 使用するデコーダの名前
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		[[nodiscard]]
+		Image Decode(FilePathView path, const ImageDecodeOptions& options, StringView decoderName);
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @param reader Reader オブジェクト
+		/// @param options デコードのオプション
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルの拡張子から判断
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		/// @remark `MemoryViewReader` などメモリ上のデータを読む Reader を渡すと、デコーダはデータをコピーせずに直接読み込みます。
+		[[nodiscard]]
+		Image Decode(std::unique_ptr<IReader> reader, const ImageDecodeOptions& options, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @param reader Reader オブジェクト
+		/// @param options デコードのオプション
+		/// @param decoderName 使用するデコーダの名前
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		[[nodiscard]]
+		Image Decode(std::unique_ptr<IReader> reader, const ImageDecodeOptions& options, StringView decoderName);
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @tparam Reader Reader オブジェクトの型
+		/// @param reader Reader オブジェクト
+		/// @param options デコードのオプション
+		/// @param imageFormat 画像フォーマット、指定しない場合はファイルの拡張子から判断
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		template <ReaderObject Reader>
+		[[nodiscard]]
+		Image Decode(Reader&& reader, const ImageDecodeOptions& options, ImageFormat imageFormat = ImageFormat::Unspecified);
+
+		/// @brief 画像ファイルをオプションを指定してデコードします。
+		/// @tparam Reader Reader オブジェクトの型
+		/// @param reader Reader オブジェクト
+		/// @param options デコードのオプション
+		/// @param decoderName 使用するデコーダの名前
+		/// @return デコードされた画像、デコードに失敗した場合は空の画像
+		template <ReaderObject Reader>
+		[[nodiscard]]
+		Image Decode(Reader&& reader, const ImageDecodeOptions& options, StringView decoderName);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	DecodeGray16
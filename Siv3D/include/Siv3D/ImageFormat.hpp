@@ -64,6 +64,9 @@ namespace s3d
 		/// @brief SVG
 		SVG,
 
+		/// @brief QOI
+		QOI,
+
 		/// @brief 指定しない（データと拡張子から判断）
 		Unspecified = Unknown,
 	};
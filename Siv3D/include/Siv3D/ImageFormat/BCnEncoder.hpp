@@ -11,6 +11,7 @@
 
 # pragma once
 # include <Siv3D/IImageEncoder.hpp>
+# include <Siv3D/BCnQuality.hpp>
 
 namespace s3d
 {	
@@ -103,10 +104,24 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC1(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
-
+		/// @brief Image を BC1 (DXT1) 形式でエンコードして書き出します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックの圧縮は複数のスレッドで並列に行われます。
+		bool encodeBC1(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
+
+		/// @brief Image を BC1 (DXT1) 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC1(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC1(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -114,10 +129,24 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC3(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
-
+		/// @brief Image を BC3 (DXT5) 形式でエンコードして書き出します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックの圧縮は複数のスレッドで並列に行われます。
+		bool encodeBC3(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
+
+		/// @brief Image を BC3 (DXT5) 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC3(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC3(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -125,10 +154,24 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC4(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
-
+		/// @brief Image を BC4 (R チャンネル) 形式でエンコードして書き出します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックの圧縮は複数のスレッドで並列に行われます。
+		bool encodeBC4(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
+
+		/// @brief Image を BC4 (R チャンネル) 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC4(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC4(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -136,10 +179,24 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC5(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
-
+		/// @brief Image を BC5 (RG チャンネル) 形式でエンコードして書き出します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックの圧縮は複数のスレッドで並列に行われます。
+		bool encodeBC5(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
+
+		/// @brief Image を BC5 (RG チャンネル) 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC5(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC5(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -147,9 +204,23 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool encodeBC7(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		/// @brief Image を BC7 形式でエンコードして書き出します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark ブロックの圧縮は複数のスレッドで並列に行われます。
+		bool encodeBC7(const Image& image, IWriter& writer, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
 
+		/// @brief Image を BC7 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image. 幅と高さは 4 の倍数である必要があります。
+		/// @param generateMipmaps ミップマップを生成するか
+		/// @param quality エンコード品質
+		/// @param rdoLambda RDO (rate-distortion optimization) の強さ。0 の場合は RDO を行いません。大きいほど LZ 系圧縮後のサイズが小さくなり、画質は低下します。
+		/// @return エンコード結果
 		[[nodiscard]]
-		Blob encodeBC7(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes) const;
+		Blob encodeBC7(const Image& image, GenerateMipmaps generateMipmaps = GenerateMipmaps::Yes, BCnQuality quality = BCnQuality::Default, double rdoLambda = 0.0) const;
 	};
 }
@@ -109,5 +109,21 @@ namespace s3d
 		/// @return 作成した Image
 		[[nodiscard]]
 		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const override;
+
+		/// @brief BMP 形式の画像ファイルをオプションを指定してデコードして Image を作成します。
+		/// @param path 画像ファイルのパス
+		/// @param options デコードのオプション
+		/// @return 作成した Image
+		[[nodiscard]]
+		Image decode(FilePathView path, const ImageDecodeOptions& options) const override;
+
+		/// @brief BMP 形式の画像データをオプションを指定してデコードして Image を作成します。
+		/// @param reader Reader オブジェクト
+		/// @param pathHint ファイルパス（オプション）
+		/// @param options デコードのオプション
+		/// @return 作成した Image
+		/// @remark 1 行ずつデコードしながら、切り出しと縮小を行います。出力に不要な行は読み飛ばします。
+		[[nodiscard]]
+		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, const ImageDecodeOptions& options) const override;
 	};
 }
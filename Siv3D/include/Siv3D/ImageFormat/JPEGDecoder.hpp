@@ -109,5 +109,22 @@ namespace s3d
 		/// @return 作成した Image
 		[[nodiscard]]
 		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const override;
+
+		/// @brief JPEG 形式の画像ファイルをオプションを指定してデコードして Image を作成します。
+		/// @param path 画像ファイルのパス
+		/// @param options デコードのオプション
+		/// @return 作成した Image
+		[[nodiscard]]
+		Image decode(FilePathView path, const ImageDecodeOptions& options) const override;
+
+		/// @brief JPEG 形式の画像データをオプションを指定してデコードして Image を作成します。
+		/// @param reader Reader オブジェクト
+		/// @param pathHint ファイルパス（オプション）
+		/// @param options デコードのオプション
+		/// @return 作成した Image
+		/// @remark 出力画像のサイズに応じて、DCT の段階で 1/2, 1/4, 1/8 に縮小してデコードします。
+		/// @remark Reader のデータがメモリ上にある場合は、データをコピーせずに直接デコードします。
+		[[nodiscard]]
+		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, const ImageDecodeOptions& options) const override;
 	};
 }
@@ -13,6 +13,7 @@
 # include <Siv3D/IImageEncoder.hpp>
 # include <Siv3D/PNGFilter.hpp>
 # include <Siv3D/Grid.hpp>
+# include <Siv3D/PredefinedYesNo.hpp>
 
 namespace s3d
 {	
@@ -79,6 +80,15 @@ namespace s3d
 		/// @return 保存に成功した場合 true, それ以外の場合は false
 		bool save(const Image& image, FilePathView path, PNGFilter filter) const;
 
+		/// @brief Image を PNG 形式でエンコードしてファイルに保存します。
+		/// @param image エンコードする Image
+		/// @param path 保存するファイルのパス
+		/// @param filter 使用できるフィルタ
+		/// @param parallelize 複数のスレッドで並列にエンコードするか
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		/// @remark 並列エンコードの詳細は `encode(const Image&, PNGFilter, Parallelize)` を参照してください。
+		bool save(const Image& image, FilePathView path, PNGFilter filter, Parallelize parallelize) const;
+
 		/// @brief 16-bit グレースケールデータ (Grid) を PNG 形式でエンコードしてファイルに保存します。
 		/// @param image エンコードする Grid
 		/// @param path 保存するファイルのパス
@@ -105,6 +115,15 @@ namespace s3d
 		/// @return 書き出しに成功した場合 true, それ以外の場合は false
 		bool encode(const Image& image, IWriter& writer, PNGFilter filter) const;
 
+		/// @brief Image を PNG 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @param filter 使用できるフィルタ
+		/// @param parallelize 複数のスレッドで並列にエンコードするか
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		/// @remark 並列エンコードの詳細は `encode(const Image&, PNGFilter, Parallelize)` を参照してください。
+		bool encode(const Image& image, IWriter& writer, PNGFilter filter, Parallelize parallelize) const;
+
 		/// @brief 16-bit グレースケールデータ (Grid) を PNG 形式でエンコードして書き出します。
 		/// @param image エンコードする Grid
 		/// @param writer 書き出し先の IWriter インタフェース
@@ -125,6 +144,16 @@ namespace s3d
 		[[nodiscard]]
 		Blob encode(const Image& image, PNGFilter filter) const;
 
+		/// @brief Image を PNG 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @param filter 使用できるフィルタ
+		/// @param parallelize 複数のスレッドで並列にエンコードするか
+		/// @return エンコード結果
+		/// @remark `Parallelize::Yes` の場合、行ごとに `filter` の中から最適なフィルタを選び、画像を行のブロックに分けて複数のスレッドで圧縮します。
+		/// @remark 各ブロックは直前のブロックの末尾 32 KiB を辞書として圧縮するため、圧縮率の低下はわずかです。出力は標準的な PNG です。
+		[[nodiscard]]
+		Blob encode(const Image& image, PNGFilter filter, Parallelize parallelize) const;
+
 		/// @brief 16-bit グレースケールデータ (Grid) を PNG 形式でエンコードした結果を Blob で返します。
 		/// @param image エンコードする Grid
 		/// @param filter 使用するフィルタ
@@ -0,0 +1,131 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/IImageDecoder.hpp>
+
+namespace s3d
+{	
+	////////////////////////////////////////////////////////////////
+	//
+	//	QOIDecoder
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief QOI 形式画像データのデコーダ
+	/// @remark QOI はエンコードとデコードが高速な可逆圧縮形式で、サムネイルや描画結果などの一時的なキャッシュに適しています。
+	class QOIDecoder : public IImageDecoder
+	{
+	public:
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	name
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デコーダの対応形式 `U"QOI"` を返します。
+		/// @return 文字列 `U"QOI"`
+		[[nodiscard]]
+		StringView name() const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	imageFormat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式を示す ImageFormat を返します。
+		/// @return `ImageFormat::QOI`
+		[[nodiscard]]
+		ImageFormat imageFormat() const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	isHeader
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式の先頭データであるかを返します。
+		/// @param bytes データの先頭 16 バイト
+		/// @return QOI 形式と推測される場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isHeader(const uint8(&bytes)[RequiredHeaderBytes]) const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	possibleExtensions
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式のファイルに想定される拡張子一覧 `{ U"qoi" }` を返します。
+		/// @return 配列 `{ U"qoi" }`
+		[[nodiscard]]
+		std::span<const StringView> possibleExtensions() const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	getImageInfo
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式の画像ファイルから画像情報を取得します。
+		/// @param path 画像ファイルのパス
+		/// @return 画像情報。取得に失敗した場合は none
+		[[nodiscard]]
+		Optional<ImageInfo> getImageInfo(FilePathView path) const override;
+
+		/// @brief QOI 形式の画像データから画像情報を取得します。
+		/// @param reader Reader オブジェクト
+		/// @param pathHint ファイルパス（オプション）
+		/// @return 画像情報。取得に失敗した場合は none
+		/// @remark 先頭 14 バイトのヘッダのみを読み込みます。
+		[[nodiscard]]
+		Optional<ImageInfo> getImageInfo(const IReader& reader, FilePathView pathHint = {}) const override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	decode
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式の画像ファイルをデコードして Image を作成します。
+		/// @param path 画像ファイルのパス
+		/// @param premultiplyAlpha アルファ乗算処理を適用するか
+		/// @return 作成した Image
+		[[nodiscard]]
+		Image decode(FilePathView path, PremultiplyAlpha premultiplyAlpha) const override;
+
+		/// @brief QOI 形式の画像データをデコードして Image を作成します。
+		/// @param reader Reader オブジェクト
+		/// @param pathHint ファイルパス（オプション）
+		/// @param premultiplyAlpha アルファ乗算処理を適用するか
+		/// @return 作成した Image
+		[[nodiscard]]
+		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha) const override;
+
+		/// @brief QOI 形式の画像ファイルをオプションを指定してデコードして Image を作成します。
+		/// @param path 画像ファイルのパス
+		/// @param options デコードのオプション
+		/// @return 作成した Image
+		[[nodiscard]]
+		Image decode(FilePathView path, const ImageDecodeOptions& options) const override;
+
+		/// @brief QOI 形式の画像データをオプションを指定してデコードして Image を作成します。
+		/// @param reader Reader オブジェクト
+		/// @param pathHint ファイルパス（オプション）
+		/// @param options デコードのオプション
+		/// @return 作成した Image
+		/// @remark 1 行ずつデコードしながら、切り出しと縮小を行います。出力に必要な行をすべてデコードした時点で終了します。
+		[[nodiscard]]
+		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, const ImageDecodeOptions& options) const override;
+	};
+}
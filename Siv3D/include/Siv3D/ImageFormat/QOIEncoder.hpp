@@ -0,0 +1,92 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/IImageEncoder.hpp>
+
+namespace s3d
+{	
+	////////////////////////////////////////////////////////////////
+	//
+	//	QOIEncoder
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief QOI 形式画像のエンコーダ
+	/// @remark 常に 4 チャンネル (RGBA) の QOI データを出力します。
+	class QOIEncoder : public IImageEncoder
+	{
+	public:
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	name
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief エンコーダの対応形式 `U"QOI"` を返します。
+		/// @return 文字列 `U"QOI"`
+		[[nodiscard]]
+		StringView name() const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	imageFormat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式を示す ImageFormat を返します。
+		/// @return `ImageFormat::QOI`
+		[[nodiscard]]
+		ImageFormat imageFormat() const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	possibleExtensions
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief QOI 形式のファイルに想定される拡張子一覧 `{ U"qoi" }` を返します。
+		/// @return 配列 `{ U"qoi" }` 
+		[[nodiscard]]
+		std::span<const StringView> possibleExtensions() const noexcept override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	save
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief Image を QOI 形式でエンコードしてファイルに保存します。
+		/// @param image エンコードする Image
+		/// @param path 保存するファイルのパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool save(const Image& image, FilePathView path) const override;
+	
+		////////////////////////////////////////////////////////////////
+		//
+		//	encode
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief Image を QOI 形式でエンコードして書き出します。
+		/// @param image エンコードする Image
+		/// @param writer 書き出し先の IWriter インタフェース
+		/// @return 書き出しに成功した場合 true, それ以外の場合は false
+		bool encode(const Image& image, IWriter& writer) const override;
+
+		/// @brief Image を QOI 形式でエンコードした結果を Blob で返します。
+		/// @param image エンコードする Image
+		/// @return エンコード結果
+		[[nodiscard]]
+		Blob encode(const Image& image) const override;
+	};
+}
@@ -12,6 +12,10 @@
 # pragma once
 # include "Common.hpp"
 # include "PointVector.hpp"
+# include "Array.hpp"
+# include "Grid.hpp"
+# include "ResizeFilter.hpp"
+# include "PredefinedYesNo.hpp"
 
 namespace s3d
 {
@@ -26,8 +30,92 @@ namespace s3d
 		[[nodiscard]]
 		constexpr uint8 CalculateMipmapLevel(size_t width, size_t height) noexcept;
 
+		/// @brief 画像を拡大縮小します。
+		/// @param src 元の画像
+		/// @param size 新しいサイズ
+		/// @param filter 使用するフィルタ
+		/// @param gammaCorrect sRGB のガンマを考慮し、線形の色空間で補間するか。アルファ値は常に線形に扱われます。
+		/// @return 拡大縮小した画像
+		/// @remark 同じスレッドで同じサイズ・設定の拡大縮小を繰り返す場合、フィルタの係数の計算結果が再利用されます。
+		/// @remark 出力が大きい場合は複数のスレッドで並列に処理します。
 		[[nodiscard]]
-		Image Resize(const Image& src, const Size& size);
+		Image Resize(const Image& src, const Size& size, ResizeFilter filter = ResizeFilter::Default, GammaCorrect gammaCorrect = GammaCorrect::No);
+
+		/// @brief 画像の幅と高さを繰り返し 1/2 に縮小し、1x1 までのすべてのレベルの画像（画像ピラミッド）を作成します。
+		/// @param src 元の画像
+		/// @param gammaCorrect sRGB のガンマを考慮し、線形の色空間で平均を計算するか。アルファ値は常に線形に扱われます。
+		/// @param includeSource 先頭に元の画像のコピーを含めるか。`IncludeSource::No` の場合は 1/2 に縮小したレベルから始まり、元の画像はコピーされません。
+		/// @return 画像ピラミッド。`IncludeSource::Yes` の場合、要素数は `CalculateMipmapLevel(src.width(), src.height())` です。
+		/// @remark 各レベルは前のレベルの面積平均です。奇数サイズの場合も画素を読み飛ばしません。
+		/// @remark 中間結果は 16-bit の精度で保持されるため、レベルを重ねても丸め誤差が蓄積しにくくなっています。
+		[[nodiscard]]
+		Array<Image> BuildPyramid(const Image& src, GammaCorrect gammaCorrect = GammaCorrect::Yes, IncludeSource includeSource = IncludeSource::Yes);
+
+		/// @brief 画像に、横方向と縦方向の 1 次元カーネルを順に畳み込みます。
+		/// @param src 元の画像
+		/// @param kernelX 横方向のカーネル。`kernelX.size() / 2` 番目の要素が中心です。
+		/// @param kernelY 縦方向のカーネル。`kernelY.size() / 2` 番目の要素が中心です。
+		/// @return 畳み込みの結果。カーネルの係数の絶対値の合計が 2 を超える場合は空の画像
+		/// @remark 画像の範囲外は端の画素で延長されます。アルファ値も RGB と同様に畳み込まれます。
+		/// @remark 計算は固定小数点で行われるため、それぞれのカーネルの係数の絶対値の合計は 2 以下である必要があります。
+		[[nodiscard]]
+		Image SeparableConvolve(const Image& src, std::span<const float> kernelX, std::span<const float> kernelY);
+
+		/// @brief 2 次元配列に、横方向と縦方向の 1 次元カーネルを順に畳み込みます。
+		/// @param src 元の 2 次元配列
+		/// @param kernelX 横方向のカーネル。`kernelX.size() / 2` 番目の要素が中心です。
+		/// @param kernelY 縦方向のカーネル。`kernelY.size() / 2` 番目の要素が中心です。
+		/// @return 畳み込みの結果
+		/// @remark 範囲外は端の要素で延長されます。
+		[[nodiscard]]
+		Grid<float> SeparableConvolve(const Grid<float>& src, std::span<const float> kernelX, std::span<const float> kernelY);
+
+		/// @brief 画像にガウスぼかしを適用します。
+		/// @param src 元の画像
+		/// @param sigma ガウス関数の標準偏差（ピクセル）。カーネルの半径は `ceil(3 * sigma)` です。
+		/// @return ぼかした画像
+		[[nodiscard]]
+		Image GaussianBlur(const Image& src, double sigma);
+
+		/// @brief 2 次元配列にガウスぼかしを適用します。
+		/// @param src 元の 2 次元配列
+		/// @param sigma ガウス関数の標準偏差（要素数）。カーネルの半径は `ceil(3 * sigma)` です。
+		/// @return ぼかした 2 次元配列
+		[[nodiscard]]
+		Grid<float> GaussianBlur(const Grid<float>& src, double sigma);
+
+		/// @brief 画像にボックスぼかしを適用します。
+		/// @param src 元の画像
+		/// @param radius ボックスの半径（ピクセル）。各画素は `(2 * radius + 1)` 四方の平均になります。
+		/// @return ぼかした画像
+		/// @remark 累積和を使うため、計算量は半径によらず 1 画素あたり O(1) です。
+		[[nodiscard]]
+		Image BoxBlur(const Image& src, int32 radius);
+
+		/// @brief 2 次元配列にボックスぼかしを適用します。
+		/// @param src 元の 2 次元配列
+		/// @param radius ボックスの半径（要素数）。各要素は `(2 * radius + 1)` 四方の平均になります。
+		/// @return ぼかした 2 次元配列
+		/// @remark 累積和を使うため、計算量は半径によらず 1 要素あたり O(1) です。
+		[[nodiscard]]
+		Grid<float> BoxBlur(const Grid<float>& src, int32 radius);
+
+		/// @brief 画像をアンシャープマスクで鮮鋭化します。
+		/// @param src 元の画像
+		/// @param sigma ぼかしに使うガウス関数の標準偏差（ピクセル）
+		/// @param amount 強さ。`src + amount * (src - GaussianBlur(src, sigma))` を計算します。
+		/// @return 鮮鋭化した画像
+		/// @remark アルファ値は変更されません。
+		[[nodiscard]]
+		Image Sharpen(const Image& src, double sigma = 1.0, double amount = 1.0);
+
+		/// @brief 2 次元配列をアンシャープマスクで鮮鋭化します。
+		/// @param src 元の 2 次元配列
+		/// @param sigma ぼかしに使うガウス関数の標準偏差（要素数）
+		/// @param amount 強さ。`src + amount * (src - GaussianBlur(src, sigma))` を計算します。
+		/// @return 鮮鋭化した 2 次元配列
+		[[nodiscard]]
+		Grid<float> Sharpen(const Grid<float>& src, double sigma = 1.0, double amount = 1.0);
 	}
 }
 
@@ -0,0 +1,152 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "StringView.hpp"
+# include "String.hpp"
+# include "Format.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	InlineFormat
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 一連の引数を文字列に変換し、結果をオブジェクト内のバッファに保持します。
+	/// @tparam N オブジェクト内のバッファに保持できる最大の文字数
+	/// @remark 変換にはスレッドごとの作業用バッファを使うため、結果が N 文字以下であればメモリの確保は発生しません。N 文字を超える場合は String に保持します。
+	/// @remark 毎フレーム更新する短いテキストの描画やログの出力などに適しています。
+	template <size_t N>
+	class InlineFormat
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 一連の引数を文字列に変換します。
+		/// @param ...args 変換する値
+		template <Concept::Formattable... Args>
+		[[nodiscard]]
+		explicit InlineFormat(const Args&... args);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	data
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列の先頭ポインタを返します。
+		/// @return 文字列の先頭ポインタ
+		/// @remark 文字列は必ず U'\0' で終端されています。
+		[[nodiscard]]
+		const char32* data() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列の長さ（要素数）を返します。
+		/// @return 文字列の長さ（要素数）
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isEmpty
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 空の文字列であるかを返します。
+		/// @return 空の文字列である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isInline
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列がオブジェクト内のバッファに保持されているかを返します。
+		/// @return オブジェクト内のバッファに保持されている場合 true, String に保持されている場合は false
+		[[nodiscard]]
+		bool isInline() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	view
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列を参照する StringView を返します。
+		/// @return 文字列を参照する StringView
+		[[nodiscard]]
+		StringView view() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator StringView
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列を参照する StringView を返します。
+		/// @return 文字列を参照する StringView
+		[[nodiscard]]
+		operator StringView() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	str
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列のコピーを返します。
+		/// @return 文字列のコピー
+		[[nodiscard]]
+		String str() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Formatter
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列をフォーマットします。
+		/// @param formatData フォーマットデータ
+		/// @param value フォーマットする文字列
+		friend void Formatter(FormatData& formatData, const InlineFormat& value)
+		{
+			formatData.string.append(value.view());
+		}
+
+	private:
+
+		/// @brief 文字列の長さ
+		size_t m_length = 0;
+
+		/// @brief N 文字を超える場合の文字列
+		String m_overflow;
+
+		/// @brief オブジェクト内のバッファ
+		char32 m_buffer[N + 1];
+	};
+}
+
+# include "detail/InlineFormat.ipp"
@@ -0,0 +1,303 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "StringView.hpp"
+# include "String.hpp"
+# include "Optional.hpp"
+
+namespace s3d
+{
+	struct FormatData;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	InternedString
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief インターン化された文字列
+	/// @remark 同じ内容の文字列はプロセス全体で 1 つの実体を共有するため、等値比較はポインタの比較だけで行われます。
+	/// @remark ハッシュ値は作成時に一度だけ計算され、`StringView::hash()` と同じ値を返します。
+	/// @remark 文字列の実体はプログラムの終了まで解放されません。実行中に際限なく増える文字列には使わないでください。
+	/// @remark 作成と検索はスレッドセーフです。
+	class InternedString
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 空の文字列を作成します。
+		[[nodiscard]]
+		InternedString() = default;
+
+		/// @brief 文字列をインターン化します。
+		/// @param s 文字列
+		/// @remark 同じ内容の文字列が既にインターン化されている場合は、その実体を共有します。
+		[[nodiscard]]
+		explicit InternedString(StringView s);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	data
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列の先頭ポインタを返します。
+		/// @return 文字列の先頭ポインタ
+		/// @remark 文字列は必ず U'\0' で終端されています。
+		[[nodiscard]]
+		const char32* data() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size, length
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列の長さ（要素数）を返します。
+		/// @return 文字列の長さ（要素数）
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 文字列の長さ（要素数）を返します。
+		/// @return 文字列の長さ（要素数）
+		[[nodiscard]]
+		size_t length() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isEmpty
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 空の文字列であるかを返します。
+		/// @return 空の文字列である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	view
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列を参照する StringView を返します。
+		/// @return 文字列を参照する StringView
+		[[nodiscard]]
+		StringView view() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator StringView
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列を参照する StringView を返します。
+		/// @return 文字列を参照する StringView
+		[[nodiscard]]
+		operator StringView() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	str
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列のコピーを返します。
+		/// @return 文字列のコピー
+		[[nodiscard]]
+		String str() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	hash
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列のハッシュ値を返します。
+		/// @return 文字列のハッシュ値
+		/// @remark 作成時に計算した値を返すため、文字列の長さによらず定数時間です。
+		[[nodiscard]]
+		uint64 hash() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	swap
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 別の InternedString と入れ替えます。
+		/// @param other 別の InternedString
+		void swap(InternedString& other) noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator ==, operator <=>
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2 つの文字列が等しいかを返します。
+		/// @param lhs 一方の文字列
+		/// @param rhs もう一方の文字列
+		/// @return 2 つの文字列が等しい場合 true, それ以外の場合は false
+		/// @remark ポインタの比較だけで判定します。
+		[[nodiscard]]
+		friend bool operator ==(const InternedString& lhs, const InternedString& rhs) noexcept
+		{
+			return (lhs.m_entry == rhs.m_entry);
+		}
+
+		/// @brief 文字列が別の文字列と等しいかを返します。
+		/// @param lhs インターン化された文字列
+		/// @param rhs 比較する文字列
+		/// @return 2 つの文字列が等しい場合 true, それ以外の場合は false
+		[[nodiscard]]
+		friend bool operator ==(const InternedString& lhs, const StringView rhs) noexcept
+		{
+			return (lhs.view() == rhs);
+		}
+
+		/// @brief 2 つの文字列を辞書順で比較します。
+		/// @param lhs 一方の文字列
+		/// @param rhs もう一方の文字列
+		/// @return 比較結果
+		[[nodiscard]]
+		friend std::strong_ordering operator <=>(const InternedString& lhs, const InternedString& rhs) noexcept
+		{
+			if (lhs.m_entry == rhs.m_entry)
+			{
+				return std::strong_ordering::equal;
+			}
+
+			return (lhs.view() <=> rhs.view());
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	swap
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2 つの InternedString を入れ替えます。
+		/// @param lhs 一方の InternedString
+		/// @param rhs もう一方の InternedString
+		friend void swap(InternedString& lhs, InternedString& rhs) noexcept
+		{
+			lhs.swap(rhs);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Find
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列が既にインターン化されている場合、その InternedString を返します。
+		/// @param s 文字列
+		/// @return インターン化されている場合はその InternedString, それ以外の場合は none
+		/// @remark 新しい文字列を登録しません。
+		[[nodiscard]]
+		static Optional<InternedString> Find(StringView s);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Count
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief インターン化されている文字列の個数を返します。
+		/// @return インターン化されている文字列の個数
+		/// @remark 空の文字列は含みません。
+		[[nodiscard]]
+		static size_t Count();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator <<
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列を出力ストリームに出力します。
+		/// @param output 出力ストリーム
+		/// @param value 出力する文字列
+		/// @return 出力ストリーム
+		friend std::ostream& operator <<(std::ostream& output, const InternedString& value);
+
+		/// @brief 文字列を出力ストリームに出力します。
+		/// @param output ワイド文字出力ストリーム
+		/// @param value 出力する文字列
+		/// @return 出力ストリーム
+		friend std::wostream& operator <<(std::wostream& output, const InternedString& value);
+
+		/// @brief 文字列を出力ストリームに出力します。
+		/// @param output char32 出力ストリーム
+		/// @param value 出力する文字列
+		/// @return 出力ストリーム
+		friend std::basic_ostream<char32>& operator <<(std::basic_ostream<char32>& output, const InternedString& value);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Formatter
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列をフォーマットします。
+		/// @param formatData フォーマットデータ
+		/// @param value フォーマットする文字列
+		friend void Formatter(FormatData& formatData, const InternedString& value);
+
+	private:
+
+		/// @brief インターン化された文字列の実体
+		/// @remark 直後に U'\0' で終端された文字列が続きます。
+		struct Entry
+		{
+			/// @brief 文字列のハッシュ値
+			uint64 hash;
+
+			/// @brief 文字列の長さ（要素数）
+			size_t length;
+		};
+
+		[[nodiscard]]
+		explicit InternedString(const Entry* entry) noexcept
+			: m_entry{ entry } {}
+
+		/// @brief 文字列の実体。空の文字列の場合は nullptr
+		const Entry* m_entry = nullptr;
+
+		friend struct InternTable;
+	};
+}
+
+////////////////////////////////////////////////////////////////
+//
+//	std::hash
+//
+////////////////////////////////////////////////////////////////
+
+template <>
+struct std::hash<s3d::InternedString>
+{
+	[[nodiscard]]
+	size_t operator ()(const s3d::InternedString& value) const noexcept
+	{
+		return value.hash();
+	}
+};
+
+# include "detail/InternedString.ipp"
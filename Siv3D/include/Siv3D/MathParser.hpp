@@ -17,6 +17,7 @@
 # include "Optional.hpp"
 # include "PointVector.hpp"
 # include "ColorHSV.hpp"
+# include "CompiledExpression.hpp"
 
 namespace s3d
 {
@@ -346,6 +347,26 @@ namespace s3d
 		[[nodiscard]]
 		String validPostfixCharacters() const;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	compile
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 数式を、複数のスレッドから評価できるコンパイル済みの数式に変換します。
+		/// @param columnVariables 評価時に列として値を与える変数の名前。`setVariable()` で登録されている必要があります。
+		/// @return コンパイル済みの数式。失敗した場合は無効な `CompiledExpression` を返し、`getErrorMessage()` でエラーメッセージを取得できます。
+		/// @remark 代入演算子、文字列引数の関数、複数の結果を返す数式はコンパイルできません。
+		[[nodiscard]]
+		CompiledExpression compile(std::initializer_list<StringView> columnVariables = {}) const;
+
+		/// @brief 数式を、複数のスレッドから評価できるコンパイル済みの数式に変換します。
+		/// @param columnVariables 評価時に列として値を与える変数の名前。`setVariable()` で登録されている必要があります。
+		/// @return コンパイル済みの数式。失敗した場合は無効な `CompiledExpression` を返し、`getErrorMessage()` でエラーメッセージを取得できます。
+		/// @remark 代入演算子、文字列引数の関数、複数の結果を返す数式はコンパイルできません。
+		[[nodiscard]]
+		CompiledExpression compile(const Array<String>& columnVariables) const;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	eval
@@ -10,7 +10,11 @@
 //-----------------------------------------------
 
 # pragma once
+# include <compare>
+# include <span>
+# include <string>
 # include "StringView.hpp"
+# include "PredefinedYesNo.hpp"
 
 namespace s3d
 {
@@ -29,4 +33,120 @@ namespace s3d
 		/// @return lhs が rhs より小さい場合 true, それ以外の場合は false
 		static bool operator()(StringView lhs, StringView rhs) noexcept;
 	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	NaturalSortKey
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 自然順での比較をバイト列の辞書順比較（`memcmp`）で行えるように、文字列を変換したソートキー
+	/// @remark 数字のブロックは有効桁数を前置したバイト列に変換されるため、比較のたびに数字を読み直す必要がありません。
+	/// @remark 順序は `NaturalSortCompare()` と一致します。ただし、先頭の 0 の個数だけが異なる数字ブロックを含み、かつ一方の文字列がもう一方の途中で終わる場合（例: "a01" と "a1b"）は、`NaturalSortCompare()` が 0 を返すのに対し、ソートキーは順序を決めます。
+	class NaturalSortKey
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		NaturalSortKey() = default;
+
+		/// @brief 文字列からソートキーを作成します。
+		/// @param s 文字列
+		[[nodiscard]]
+		explicit NaturalSortKey(StringView s);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	data
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ソートキーのバイト列の先頭ポインタを返します。
+		/// @return ソートキーのバイト列の先頭ポインタ
+		[[nodiscard]]
+		const char* data() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	size
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ソートキーのバイト列のサイズ（バイト）を返します。
+		/// @return ソートキーのバイト列のサイズ（バイト）
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator ==
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		friend bool operator ==(const NaturalSortKey& lhs, const NaturalSortKey& rhs) noexcept
+		{
+			return (lhs.m_bytes == rhs.m_bytes);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator <=>
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		friend std::strong_ordering operator <=>(const NaturalSortKey& lhs, const NaturalSortKey& rhs) noexcept
+		{
+			return Compare(lhs.m_bytes, rhs.m_bytes);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Encode
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 文字列をソートキーのバイト列に変換し、末尾に追加します。
+		/// @param s 文字列
+		/// @param dst 変換結果を追加するバッファ
+		/// @remark 複数の文字列のキーを 1 つのバッファにまとめて作成する場合に使います。
+		static void Encode(StringView s, std::string& dst);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Compare
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ソートキーのバイト列どうしを比較します。
+		/// @param lhs 一方のソートキーのバイト列
+		/// @param rhs もう一方のソートキーのバイト列
+		/// @return 比較結果
+		[[nodiscard]]
+		static std::strong_ordering Compare(std::string_view lhs, std::string_view rhs) noexcept;
+
+	private:
+
+		std::string m_bytes;
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	SortNatural
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 文字列を自然順に並び替えます。
+	/// @param values 並び替える文字列
+	/// @param parallelize ソートキーの作成と並び替えを並列に行うか
+	/// @remark 各文字列を一度だけ `NaturalSortKey` に変換してから並び替えます。キーが短い場合は基数ソートを使います。
+	/// @remark 並び替えは安定です。
+	void SortNatural(std::span<String> values, Parallelize parallelize = Parallelize::No);
 }
@@ -0,0 +1,107 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <variant>
+# include <span>
+# include <string_view>
+# include "Common.hpp"
+# include "OSCTypeTag.hpp"
+# include "ColorHSV.hpp"
+# include "Byte.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//  OSCArgumentView
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief OSC 受信メッセージの引数の参照
+	/// @remark 文字列と blob は受信したパケットのバッファを直接参照します。参照先は `OSCReceiver::consume()` のコールバックの中でのみ有効です。
+	struct OSCArgumentView
+	{
+		/// @brief OSC 型タグ
+		OSCTypeTag tag;
+
+		/// @brief 値
+		std::variant<std::monostate, bool, char, int32, int64, float, double, uint32, uint64, Color, std::string_view, std::span<const Byte>> value;
+
+		/// @brief bool 型の値を取得します。
+		/// @throw std::bad_variant_access bool 型の値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		bool getBool() const;
+
+		/// @brief char 型の値を取得します。
+		/// @throw std::bad_variant_access char 型の値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		char getChar() const;
+
+		/// @brief int32 型の値を取得します。
+		/// @throw std::bad_variant_access int32 型の値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		int32 getInt32() const;
+
+		/// @brief int64 型の値を取得します。
+		/// @throw std::bad_variant_access int64 型の値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		int64 getInt64() const;
+
+		/// @brief float 型の値を取得します。
+		/// @throw std::bad_variant_access float 型の値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		float getFloat() const;
+
+		/// @brief double 型の値を取得します。
+		/// @throw std::bad_variant_access double 型の値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		double getDouble() const;
+
+		/// @brief MIDI メッセージの値を取得します。
+		/// @throw std::bad_variant_access MIDI メッセージの値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		uint32 getMIDIMessage() const;
+
+		/// @brief 時刻タグの値を取得します。
+		/// @throw std::bad_variant_access 時刻タグの値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		uint64 getTimeTag() const;
+
+		/// @brief RGBA カラーの値を取得します。
+		/// @throw std::bad_variant_access RGBA カラーの値が格納されていない場合
+		/// @return 値
+		[[nodiscard]]
+		Color getColor() const;
+
+		/// @brief UTF-8 文字列を取得します。
+		/// @throw std::bad_variant_access 値に 文字列が格納されていない場合
+		/// @return UTF-8 文字列
+		[[nodiscard]]
+		std::string_view getString() const;
+
+		/// @brief blob を取得します。
+		/// @throw std::bad_variant_access 値に blob が格納されていない場合
+		/// @return blob
+		[[nodiscard]]
+		std::span<const Byte> getBlob() const;
+	};
+}
+
+# include "detail/OSCArgumentView.ipp"
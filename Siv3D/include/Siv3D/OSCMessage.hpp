@@ -57,6 +57,12 @@ namespace s3d
 		/// @return *this
 		OSCMessage& beginBundle();
 
+		/// @brief 時刻タグを指定してバンドルを開始します。
+		/// @param timeTag 時刻タグ（NTP 形式。1 の場合は即時）
+		/// @throws Error バッファが不足している場合
+		/// @return *this
+		OSCMessage& beginBundle(uint64 timeTag);
+
 		/// @brief バンドルを終了します。
 		/// @throws Error バッファが不足している場合
 		/// @return *this
@@ -274,6 +280,38 @@ namespace s3d
 		/// @return *this
 		OSCMessage& endArray();
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	size
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込まれたパケットのサイズ（バイト）を返します。
+		/// @return パケットのサイズ（バイト）
+		[[nodiscard]]
+		size_t size() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isReady
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 開始したメッセージやバンドルがすべて終了し、送信できる状態であるかを返します。
+		/// @return 送信できる状態である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isReady() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clear
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 書き込まれた内容を消去します。
+		/// @remark バッファは解放されず、次のメッセージの作成に再利用されます。
+		void clear();
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	_detail
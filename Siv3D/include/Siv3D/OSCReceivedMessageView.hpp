@@ -0,0 +1,36 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include <string_view>
+# include "Common.hpp"
+# include "OSCArgumentView.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	OSCReceivedMessageView
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief OSC 受信メッセージの参照
+	/// @remark 参照先は `OSCReceiver::consume()` のコールバックの中でのみ有効です。
+	struct OSCReceivedMessageView
+	{
+		/// @brief アドレスパターン
+		std::string_view addressPattern;
+
+		/// @brief 引数
+		std::span<const OSCArgumentView> arguments;
+	};
+}
@@ -13,6 +13,8 @@
 # include <memory>
 # include "Common.hpp"
 # include "OSCReceivedMessage.hpp"
+# include "OSCReceivedMessageView.hpp"
+# include "FunctionRef.hpp"
 
 namespace s3d
 {
@@ -25,6 +27,7 @@ namespace s3d
 	////////////////////////////////////////////////////////////////
 
 	/// @brief OSC 受信クラス
+	/// @remark 受信は別スレッドで行われ、受信したメッセージはロックフリーのキューを介して取得できます。メッセージの取得は 1 つのスレッドからのみ行ってください。
 	class OSCReceiver
 	{
 	public:
@@ -52,6 +55,18 @@ namespace s3d
 		/// @brief OSC メッセージの受信を終了します。
 		~OSCReceiver();
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	endpoint
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 受信している IPv4 エンドポイントを返します。
+		/// @return 受信している IPv4 エンドポイント
+		/// @remark コンストラクタでポート番号に 0 を指定した場合、OS が割り当てたポート番号を返します。
+		[[nodiscard]]
+		IPv4Endpoint endpoint() const;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	hasMessages
@@ -86,6 +101,18 @@ namespace s3d
 		[[nodiscard]]
 		OSCReceivedMessage pop();
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	consume
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 受信して未取得のメッセージを古い順にすべて取得し、コールバック関数に渡します。
+		/// @param callback 各メッセージに対して呼ばれるコールバック関数
+		/// @return 取得したメッセージの個数
+		/// @remark `pop()` と異なり、文字列の UTF-32 への変換やメッセージのコピーを行いません。渡される参照はコールバック関数の中でのみ有効です。
+		size_t consume(FunctionRef<void(const OSCReceivedMessageView&)> callback);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	clear
@@ -11,10 +11,9 @@
 
 # pragma once
 # include <memory>
+# include <span>
 # include "Common.hpp"
 
-class UdpTransmitSocket;
-
 namespace s3d
 {
 	class IPv4Endpoint;
@@ -55,8 +54,32 @@ namespace s3d
 		/// @param message メッセージ
 		void send(const OSCMessage& message);
 
-	public:
+		/// @brief 複数の OSC メッセージを、それぞれ 1 つのパケットとして送信します。
+		/// @param messages メッセージの一覧
+		/// @remark Linux では `sendmmsg()` を使い、複数のパケットを 1 回のシステムコールで送信します。
+		void send(std::span<const OSCMessage> messages);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	sendBundle
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の OSC メッセージを OSC バンドルにまとめて送信します。
+		/// @param messages メッセージの一覧
+		/// @param timeTag バンドルの時刻タグ（1 の場合は即時）
+		/// @param maxPacketSize 1 つのパケットの最大サイズ（バイト）
+		/// @remark バンドルが `maxPacketSize` を超える場合は、複数のバンドルに分割して送信します。
+		/// @remark 単独で `maxPacketSize` を超えるメッセージは、1 つのバンドルとして送信します。
+		void sendBundle(std::span<const OSCMessage> messages, uint64 timeTag = 1, size_t maxPacketSize = DefaultMaxPacketSize);
+
+		/// @brief `sendBundle()` における 1 つのパケットの最大サイズのデフォルト値（イーサネットの MTU から IP ヘッダと UDP ヘッダを除いたサイズ）
+		static constexpr size_t DefaultMaxPacketSize = 1472;
+
+	private:
+
+		class OSCSenderDetail;
 
-		std::shared_ptr<UdpTransmitSocket> m_transmitSocket;
+		std::shared_ptr<OSCSenderDetail> pImpl;
 	};
 }
@@ -14,11 +14,15 @@
 # include <cmath>
 # include <algorithm>
 # include <numeric>
+# include <iterator>
 # include "Common.hpp"
+# include "Array.hpp"
 # include "Concepts.hpp"
 # include "PointVector.hpp"
+# include "PredefinedYesNo.hpp"
 # include "Random.hpp"
 # include "Shuffle.hpp"
+# include "Threading.hpp"
 
 namespace s3d
 {
@@ -46,6 +50,19 @@ namespace s3d
 			value_type persistence = value_type(0.5);
 		};
 
+		/// @brief フラクタルノイズの合成方法
+		enum class FractalType : uint8
+		{
+			/// @brief 各オクターブのノイズをそのまま重み付きで合計します（fBm）。出力の範囲は概ね [-1, 1] です。
+			FBm,
+
+			/// @brief 各オクターブのノイズの絶対値を重み付きで合計します。出力の範囲は [0, 1] です。
+			Turbulence,
+
+			/// @brief 各オクターブの (1 - |noise|)^2 を重み付きで合計します。出力の範囲は [0, 1] です。
+			Ridged,
+		};
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	(constructor)
@@ -329,6 +346,55 @@ namespace s3d
 		void batchOctaveNoiseNormalized01(OutputIterator first, Size size,
 			value_type baseX, value_type baseY, value_type xStep, value_type yStep, value_type z, Parameters parameters, Converter convert) const;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	fractalNoise
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2D のフラクタルノイズを返します。
+		/// @param x X 座標
+		/// @param y Y 座標
+		/// @param type 合成方法
+		/// @param parameters オクターブ数と持続度
+		/// @return 振幅の合計で正規化されたノイズの値。octaves が 0 以下の場合は 0
+		[[nodiscard]]
+		value_type fractalNoise(value_type x, value_type y, FractalType type, Parameters parameters) const noexcept;
+
+		[[nodiscard]]
+		value_type fractalNoise(Vector2D<value_type> xy, FractalType type, Parameters parameters) const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	batchFractalNoise
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2D のフラクタルノイズを格子状に一括で生成します。
+		/// @param first 出力先の先頭。行優先で width * height 個の値が書き込まれます。
+		/// @param width 横方向の数
+		/// @param height 縦方向の数
+		/// @param baseX 左上の X 座標
+		/// @param baseY 左上の Y 座標
+		/// @param xStep X 方向の間隔
+		/// @param yStep Y 方向の間隔
+		/// @param type 合成方法
+		/// @param parameters オクターブ数と持続度
+		/// @param convert fractalNoise() と同じ値を受け取り、出力先に書き込む値を返す関数
+		/// @param parallelize 行を複数のスレッドに分割して処理するか
+		/// @remark (x, y) に書き込まれる値は `fractalNoise(baseX + x * xStep, baseY + y * yStep, type, parameters)` と一致します。
+		/// @remark X 方向の 8 点をまとめて計算するため、コンパイラの自動ベクトル化が効きます。
+		/// @remark 並列化は first がランダムアクセスイテレータ（`Grid<float>::begin()` や `Image::begin()` など）の場合のみ行われ、convert は複数のスレッドから同時に呼ばれます。
+		template <class OutputIterator, class Converter>
+		void batchFractalNoise(OutputIterator first, int32 width, int32 height,
+			value_type baseX, value_type baseY, value_type xStep, value_type yStep,
+			FractalType type, Parameters parameters, Converter convert, Parallelize parallelize = Parallelize::Yes) const;
+
+		template <class OutputIterator, class Converter>
+		void batchFractalNoise(OutputIterator first, Size size,
+			value_type baseX, value_type baseY, value_type xStep, value_type yStep,
+			FractalType type, Parameters parameters, Converter convert, Parallelize parallelize = Parallelize::Yes) const;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	serialize, deserialize
@@ -368,6 +434,29 @@ namespace s3d
 		static constexpr value_type To01Clamped(value_type x) noexcept;
 
 		static constexpr value_type AmplitudeSum(Parameters parameters) noexcept;
+
+		static constexpr value_type FractalOctave(value_type n, FractalType type) noexcept;
+
+		static constexpr value_type GradBranchless(int32 hash, value_type x, value_type y, value_type z) noexcept;
+
+		/// @brief batchFractalNoise() で同時に処理する X 方向の点の数
+		static constexpr int32 FractalLaneCount = 8;
+
+		/// @brief batchFractalNoise() で全行に共通する、各オクターブの X 方向の項
+		struct FractalColumns
+		{
+			Array<int32> permA;
+
+			Array<int32> permB;
+
+			Array<value_type> fx;
+
+			int32 stride = 0;
+		};
+
+		template <class OutputIterator, class Converter>
+		void fractalNoiseRow(OutputIterator& it, int32 width, value_type rowY,
+			const FractalColumns& columns, FractalType type, Parameters parameters, Converter& convert) const;
 	};
 
 	using PerlinNoiseF = BasicPerlinNoise<float>;
@@ -260,6 +260,31 @@
 
 # endif
 
+//////////////////////////////////////////////////
+//
+//	2D 描画の頂点フォーマット | Vertex format for 2D rendering
+//
+//	SIV3D_VERTEX2D_INDEX32
+//	SIV3D_VERTEX2D_PACKED
+//
+//////////////////////////////////////////////////
+
+// 1: 2D 描画のインデックスを 32-bit にする（1 回の描画バッチにより多くの頂点を収められる）
+# ifndef SIV3D_VERTEX2D_INDEX32
+
+	# define SIV3D_VERTEX2D_INDEX32	0
+
+# endif
+
+// 0: 色を Float4 で GPU に送る
+// 1: 色を 8-bit UNORM で GPU に送る（1.0 を超える色は丸められる）
+// 2: 1 に加えて UV 座標を半精度浮動小数点数で GPU に送る
+# ifndef SIV3D_VERTEX2D_PACKED
+
+	# define SIV3D_VERTEX2D_PACKED	0
+
+# endif
+
 //////////////////////////////////////////////////
 //
 //	ローカルシンボル | Local symbol
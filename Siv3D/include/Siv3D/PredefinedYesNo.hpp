@@ -82,4 +82,13 @@ namespace s3d
 
 	/// @brief 画像への図形描画時にアンチエイリアシングを有効にするかどうかを指定 | Whether to enable antialiasing when drawing shapes on an image
 	using EnableAntialiasing = YesNo<struct EnableAntialiasing_tag>;
+
+	/// @brief 処理を複数のスレッドで並列化するかどうかを指定 | Whether to parallelize processing across multiple threads
+	using Parallelize = YesNo<struct Parallelize_tag>;
+
+	/// @brief sRGB のガンマを考慮し、線形の色空間で計算するかどうかを指定 | Whether to process colors in linear space, taking the sRGB gamma into account
+	using GammaCorrect = YesNo<struct GammaCorrect_tag>;
+
+	/// @brief 結果に元のデータを含めるかどうかを指定 | Whether to include the source in the result
+	using IncludeSource = YesNo<struct IncludeSource_tag>;
 }
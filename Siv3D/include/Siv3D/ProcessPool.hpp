@@ -0,0 +1,198 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Duration.hpp"
+# include "Threading.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ProcessPool
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 起動したままの複数の子プロセス（ワーカー）に、ジョブを順に割り当てるプロセスプール
+	/// @remark ワーカーは標準入力からジョブを 1 行ずつ読み込み、ジョブごとに結果を 1 行、標準出力に書き出す必要があります。
+	/// @remark 終了したワーカーは自動的に再起動されます。ただし、ジョブを完了しないまま 3 回続けて終了したワーカーは停止し、`num_workers()` から除かれます。ワーカーの起動コストがジョブ 1 件あたりにかからないため、短時間で終わる変換処理を大量に行う場合に適しています。
+	/// @remark Linux では epoll, macOS では poll でパイプを多重化します。
+	class ProcessPool
+	{
+	public:
+
+		/// @brief ジョブの結果
+		struct JobResult
+		{
+			/// @brief `submit()` が返したジョブ ID
+			uint64 jobID = 0;
+
+			/// @brief ワーカーが出力した 1 行（改行を含まない）
+			String output;
+
+			/// @brief ジョブが完了した場合 true, ワーカーが途中で終了した場合は false
+			bool succeeded = false;
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デフォルトコンストラクタ
+		[[nodiscard]]
+		ProcessPool();
+
+		/// @brief プロセスプールを作成し、ワーカーを起動します。
+		/// @param path ワーカーとして実行するプログラムのパス
+		/// @param commands コマンド引数
+		/// @param numWorkers ワーカーの数
+		[[nodiscard]]
+		explicit ProcessPool(FilePathView path, const Array<String>& commands = {}, size_t numWorkers = Threading::GetConcurrency());
+
+		ProcessPool(const ProcessPool&) = delete;
+
+		/// @brief ムーブコンストラクタ
+		/// @param other ムーブする ProcessPool
+		ProcessPool(ProcessPool&& other) noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(destructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief デストラクタ
+		/// @remark 実行中のジョブは破棄され、ワーカーは終了します。
+		~ProcessPool();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator =
+		//
+		////////////////////////////////////////////////////////////////
+
+		ProcessPool& operator =(const ProcessPool&) = delete;
+
+		/// @brief ムーブ代入演算子
+		/// @param other ムーブする ProcessPool
+		/// @return *this
+		ProcessPool& operator =(ProcessPool&& other) noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	operator bool
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ワーカーが起動しているかを返します。
+		/// @return ワーカーが 1 つ以上起動している場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isValid
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ワーカーが起動しているかを返します。
+		/// @return ワーカーが 1 つ以上起動している場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isValid() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_workers
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 起動しているワーカーの数を返します。
+		/// @return 起動しているワーカーの数
+		[[nodiscard]]
+		size_t num_workers() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_pendingJobs
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 完了していないジョブ（待機中と実行中）の数を返します。
+		/// @return 完了していないジョブの数
+		[[nodiscard]]
+		size_t num_pendingJobs() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	submit
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ジョブを追加します。
+		/// @param input ワーカーの標準入力に書き込む 1 行（改行を含まない）
+		/// @return ジョブ ID。ジョブを追加できなかった場合は 0
+		/// @remark ジョブは追加した順に、空いているワーカーに割り当てられます。結果の受け取りは `update()` の中で行われます。
+		uint64 submit(StringView input);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	update
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief パイプの読み書きとジョブの割り当てを行います。
+		/// @param timeout パイプが読み書き可能になるまで待機する最大の時間
+		/// @remark 毎フレーム、または `waitAll()` の代わりに繰り返し呼び出します。
+		void update(const Duration& timeout = Duration{ 0 });
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	retrieveResults
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 前回の呼び出し以降に完了したジョブの結果を取り出します。
+		/// @return 完了したジョブの結果
+		[[nodiscard]]
+		Array<JobResult> retrieveResults();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	waitAll
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief すべてのジョブが完了するまで待機します。
+		void waitAll();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	terminate
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief すべてのワーカーを終了し、完了していないジョブを破棄します。
+		void terminate();
+
+	private:
+
+		class ProcessPoolDetail;
+
+		std::unique_ptr<ProcessPoolDetail> pImpl;
+	};
+}
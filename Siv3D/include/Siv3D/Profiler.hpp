@@ -15,6 +15,7 @@
 namespace s3d
 {
 	struct FrameMetrics;
+	struct EngineInitMetrics;
 
 	namespace Profiler
 	{
@@ -48,5 +49,16 @@ namespace s3d
 
 		[[nodiscard]]
 		const FrameMetrics& GetFrameMetrics();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetEngineInitMetrics
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief エンジンの起動時に各コンポーネントの初期化にかかった時間を返します。
+		/// @return エンジンの起動時の初期化時間
+		[[nodiscard]]
+		const EngineInitMetrics& GetEngineInitMetrics();
 	}
 }
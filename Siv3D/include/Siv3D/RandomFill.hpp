@@ -0,0 +1,148 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include "Common.hpp"
+# include "PointVector.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFill
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列を min 以上 max 未満の範囲の乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param min 生成する乱数の最小値
+	/// @param max 生成する乱数の範囲の基準となる値（これ未満）
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	/// @remark 内部では 8 本の Xoshiro256++ を SIMD で同時に進めるため、`Random()` を繰り返し呼ぶよりも大幅に高速です。
+	void RandomFill(std::span<double> dst, double min, double max, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列を min 以上 max 未満の範囲の乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param min 生成する乱数の最小値
+	/// @param max 生成する乱数の範囲の基準となる値（これ未満）
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	/// @remark 結果はシード値と配列の長さだけで決まり、並列化の有無や CPU の命令セットには依存しません。
+	void RandomFill(std::span<double> dst, double min, double max, uint64 seed, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列を min 以上 max 未満の範囲の乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param min 生成する乱数の最小値
+	/// @param max 生成する乱数の範囲の基準となる値（これ未満）
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFill(std::span<float> dst, float min, float max, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列を min 以上 max 未満の範囲の乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param min 生成する乱数の最小値
+	/// @param max 生成する乱数の範囲の基準となる値（これ未満）
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFill(std::span<float> dst, float min, float max, uint64 seed, Parallelize parallelize = Parallelize::No);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFillNormal
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列を正規分布に従う乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param mean 平均
+	/// @param stddev 標準偏差
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillNormal(std::span<double> dst, double mean = 0.0, double stddev = 1.0, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列を正規分布に従う乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param mean 平均
+	/// @param stddev 標準偏差
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillNormal(std::span<double> dst, double mean, double stddev, uint64 seed, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列を正規分布に従う乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param mean 平均
+	/// @param stddev 標準偏差
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillNormal(std::span<float> dst, float mean = 0.0f, float stddev = 1.0f, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列を正規分布に従う乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param mean 平均
+	/// @param stddev 標準偏差
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillNormal(std::span<float> dst, float mean, float stddev, uint64 seed, Parallelize parallelize = Parallelize::No);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFillInt
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列を min 以上 max 以下の範囲の整数の乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param min 生成する乱数の最小値
+	/// @param max 生成する乱数の最大値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillInt(std::span<int32> dst, int32 min, int32 max, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列を min 以上 max 以下の範囲の整数の乱数で埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param min 生成する乱数の最小値
+	/// @param max 生成する乱数の最大値
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillInt(std::span<int32> dst, int32 min, int32 max, uint64 seed, Parallelize parallelize = Parallelize::No);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFillVec2
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列を指定した長さを持つランダムな 2 次元ベクトルで埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param length ベクトルの長さ
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillVec2(std::span<Vec2> dst, double length = 1.0, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列を指定した長さを持つランダムな 2 次元ベクトルで埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param length ベクトルの長さ
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillVec2(std::span<Vec2> dst, double length, uint64 seed, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 現在のスレッドの乱数エンジンから得たシードを用いて、配列をランダムな X 成分、Y 成分を持つ 2 次元ベクトルで埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param xMinMax X 成分の最小値と最大値
+	/// @param yMinMax Y 成分の最小値と最大値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillVec2(std::span<Vec2> dst, const std::pair<double, double>& xMinMax, const std::pair<double, double>& yMinMax, Parallelize parallelize = Parallelize::No);
+
+	/// @brief 指定したシードを用いて、配列をランダムな X 成分、Y 成分を持つ 2 次元ベクトルで埋めます。
+	/// @param dst 乱数を書き込む配列
+	/// @param xMinMax X 成分の最小値と最大値
+	/// @param yMinMax Y 成分の最小値と最大値
+	/// @param seed シード値
+	/// @param parallelize 複数のスレッドで並列に生成するか
+	void RandomFillVec2(std::span<Vec2> dst, const std::pair<double, double>& xMinMax, const std::pair<double, double>& yMinMax, uint64 seed, Parallelize parallelize = Parallelize::No);
+}
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <span>
 # include "Common.hpp"
 # include "PointVector.hpp"
 # include "ColorHSV.hpp"
@@ -2054,6 +2055,24 @@ namespace s3d
 		[[nodiscard]]
 		static constexpr RectF FromPoints(position_type a, position_type b) noexcept;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	DrawBatch
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の長方形をまとめて描きます。
+		/// @param rects 長方形の配列
+		/// @param color 長方形の色
+		/// @remark 頂点バッファをまとめて確保するため、`draw()` を繰り返し呼ぶよりも高速です。
+		static void DrawBatch(std::span<const RectF> rects, const ColorF& color = Palette::White);
+
+		/// @brief 複数の長方形を、それぞれ指定した色でまとめて描きます。
+		/// @param rects 長方形の配列
+		/// @param colors それぞれの長方形の色
+		/// @remark `rects` と `colors` の要素数が異なる場合、少ないほうの要素数だけ描きます。
+		static void DrawBatch(std::span<const RectF> rects, std::span<const ColorF> colors);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	operator <<
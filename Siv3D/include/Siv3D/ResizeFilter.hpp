@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Types.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	ResizeFilter
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 画像の拡大縮小に使うフィルタ
+	enum class ResizeFilter : uint8
+	{
+		/// @brief 拡大時は CatmullRom, 縮小時は Mitchell を使う（デフォルト）
+		Default,
+
+		/// @brief ボックスフィルタ。整数倍の縮小では面積平均と同じ結果になる
+		Box,
+
+		/// @brief 三角フィルタ。拡大時はバイリニア補間と同じ結果になる
+		Triangle,
+
+		/// @brief 3 次 B スプライン。ぼけやすいが、リンギングが生じない
+		CubicBSpline,
+
+		/// @brief Catmull-Rom スプライン。シャープだが、リンギングが生じやすい
+		CatmullRom,
+
+		/// @brief Mitchell-Netravali フィルタ (B = 1/3, C = 1/3)
+		Mitchell,
+
+		/// @brief 最近傍補間
+		Nearest,
+	};
+}
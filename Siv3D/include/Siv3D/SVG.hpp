@@ -15,6 +15,7 @@
 # include "StringView.hpp"
 # include "IReader.hpp"
 # include "PointVector.hpp"
+# include "RectF.hpp"
 # include "ColorHSV.hpp"
 # include "Image.hpp"
 # include "Optional.hpp"
@@ -33,6 +34,12 @@ namespace s3d
 	{
 	public:
 
+		/// @brief renderRegion() で用いるタイルの一辺の大きさ（ピクセル）
+		static constexpr int32 TileSize = 256;
+
+		/// @brief タイルキャッシュに保持するタイルの最大数のデフォルト値
+		static constexpr size_t DefaultTileCacheCapacity = 128;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	(constructor)
@@ -213,6 +220,51 @@ namespace s3d
 		[[nodiscard]]
 		Image render(const Optional<Size>& maxSize = unspecified, const Color& background = Color{ 0, 0 }, PremultiplyAlpha premultiplyAlpha = PremultiplyAlpha::Yes) const;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	renderRegion
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief SVG の一部の領域を、指定した拡大率で Image にレンダリングします。
+		/// @param region レンダリングする領域（SVG の座標系）
+		/// @param scale 拡大率
+		/// @param background 無色部分の背景色
+		/// @param premultiplyAlpha レンダリング結果にアルファ乗算を適用するか
+		/// @param parallelize タイルを複数のスレッドで並列にレンダリングするか
+		/// @return レンダリング結果。region を scale 倍した範囲を含む最小のピクセル単位の矩形が出力されます。その大きさが Image::MaxWidth, Image::MaxHeight を超える場合は空の画像を返します。
+		/// @remark 内部では拡大率ごとに TileSize 四方のタイルに分割してレンダリングし、タイルをキャッシュに保存します。
+		/// @remark 同じ拡大率で表示範囲を移動した場合、新たに見えるようになったタイルだけがレンダリングされます。
+		/// @remark 並列化する場合、スレッドごとに SVG を読み込み直した文書でレンダリングします。text 要素を含む SVG は並列化されません。
+		[[nodiscard]]
+		Image renderRegion(const RectF& region, double scale, const Color& background = Color{ 0, 0 },
+			PremultiplyAlpha premultiplyAlpha = PremultiplyAlpha::Yes, Parallelize parallelize = Parallelize::Yes) const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setTileCacheCapacity, getTileCacheCapacity
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief renderRegion() のタイルキャッシュに保持するタイルの最大数を設定します。
+		/// @param capacity タイルの最大数。0 の場合はキャッシュを使用しません。
+		/// @remark 上限を超えると、最も長い間使われていないタイルから破棄されます。
+		void setTileCacheCapacity(size_t capacity);
+
+		/// @brief renderRegion() のタイルキャッシュに保持するタイルの最大数を返します。
+		/// @return タイルの最大数
+		[[nodiscard]]
+		size_t getTileCacheCapacity() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clearTileCache
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief renderRegion() のタイルキャッシュを消去します。
+		void clearTileCache();
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	Load
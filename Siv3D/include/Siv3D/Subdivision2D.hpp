@@ -12,6 +12,7 @@
 # pragma once
 # include "Common.hpp"
 # include "Array.hpp"
+# include "PredefinedYesNo.hpp"
 # include "PointVector.hpp"
 # include "2DShapes.hpp"
 # include "VoronoiCell.hpp"
@@ -133,6 +134,19 @@ namespace s3d
 
 		void addPoints(const Array<Vec2>& points);
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addPointsBulk
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 複数の点を、空間的に近い点が連続するよう並べ替えてから一括で追加します。 | Adds multiple points at once, reordering them so that spatially close points are inserted consecutively.
+		/// @param points 追加する点の配列 | Points to add
+		/// @param parallelize 挿入順序の計算を並列化するか | Whether to parallelize the computation of the insertion order
+		/// @return 各点の頂点 ID の配列（`points` と同じ順序） | Vertex IDs of the added points, in the same order as `points`
+		/// @remark 挿入は BRIO (Biased Randomized Insertion Order) と Hilbert 曲線順で行われるため、`addPoints()` よりも大幅に高速です。 | Insertion follows BRIO (Biased Randomized Insertion Order) with Hilbert curve ordering, which is much faster than `addPoints()`.
+		Array<VertexID> addPointsBulk(const Array<Vec2>& points, Parallelize parallelize = Parallelize::Yes);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	findNearestVertex
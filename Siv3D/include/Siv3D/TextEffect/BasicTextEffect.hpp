@@ -31,6 +31,13 @@ namespace s3d
 
 			void draw(const TextureRegion& textureRegion, const GlyphContext& glyphContext) const override;
 
+			void drawBatch(const Texture& texture, std::span<const GlyphQuad> glyphQuads, std::span<const GlyphContext> glyphContexts) const override;
+
+			/// @brief オブジェクトの型が `BasicTextEffect` そのものである場合に true を返します。
+			/// @remark 派生クラスではオーバーライドした `draw()` が呼ばれるよう false を返します。`draw()` と同じ結果をまとめて描画できる派生クラスは、オーバーライドして true を返してください。
+			[[nodiscard]]
+			bool isBatchable() const noexcept override;
+
 		protected:
 
 			/// @brief 描画時に使用する色
@@ -22,6 +22,8 @@ namespace s3d
 		public:
 
 			constexpr void draw(const TextureRegion&, const GlyphContext&) const override {}
+
+			constexpr void drawBatch(const Texture&, std::span<const GlyphQuad>, std::span<const GlyphContext>) const override {}
 		};
 	}
 }
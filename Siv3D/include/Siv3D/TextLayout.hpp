@@ -0,0 +1,304 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Font.hpp"
+# include "TextStyle.hpp"
+# include "ResolvedGlyph.hpp"
+
+namespace s3d
+{
+	struct ITextEffect;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	TextLayout
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 指定した幅で折り返したテキストのレイアウトを保持するクラス
+	/// @remark グリフの解決結果と改行位置を段落（`\n` で区切られた範囲）ごとにキャッシュし、編集時には変更された段落だけを再レイアウトします。
+	/// @remark 描画時には表示領域に含まれる行だけを描画するため、数万行のチャットログやテキストエディタの描画に適しています。
+	class TextLayout
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		TextLayout() = default;
+
+		/// @brief テキストレイアウトを作成します。
+		/// @param font フォント
+		/// @param fontSize フォントサイズ
+		/// @param width 折り返し幅
+		/// @param textStyle テキストのスタイル
+		[[nodiscard]]
+		TextLayout(const Font& font, double fontSize, double width, const TextStyle& textStyle = TextStyle::Default());
+
+		/// @brief テキストレイアウトを作成します。
+		/// @param font フォント
+		/// @param fontSize フォントサイズ
+		/// @param width 折り返し幅
+		/// @param text テキスト
+		/// @param textStyle テキストのスタイル
+		[[nodiscard]]
+		TextLayout(const Font& font, double fontSize, double width, StringView text, const TextStyle& textStyle = TextStyle::Default());
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setText
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief テキストを置き換え、すべての段落を再レイアウトします。
+		/// @param text 新しいテキスト
+		void setText(StringView text);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	getText
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief テキスト全体を返します。
+		/// @return テキスト全体
+		[[nodiscard]]
+		String getText() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	append
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief テキストの末尾に文字列を追加します。
+		/// @param text 追加する文字列
+		/// @remark 再レイアウトされるのは最後の段落と新しく追加された段落だけです。
+		void append(StringView text);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	insert
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 指定した位置に文字列を挿入します。
+		/// @param index 挿入する位置（テキスト全体における文字のインデックス）
+		/// @param text 挿入する文字列
+		/// @remark 再レイアウトされるのは挿入位置を含む段落と新しく作られた段落だけです。
+		void insert(size_t index, StringView text);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	erase
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 指定した範囲の文字を削除します。
+		/// @param index 削除を開始する位置（テキスト全体における文字のインデックス）
+		/// @param count 削除する文字数
+		/// @remark 再レイアウトされるのは削除範囲を含む段落だけです。
+		void erase(size_t index, size_t count);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clear
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief テキストを空にします。
+		void clear();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	setWidth
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 折り返し幅を変更します。
+		/// @param width 新しい折り返し幅
+		/// @remark 幅が変わった場合、グリフの解決結果は再利用し、改行位置だけを計算し直します。
+		void setWidth(double width);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	width
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 折り返し幅を返します。
+		/// @return 折り返し幅
+		[[nodiscard]]
+		double width() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	height
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief レイアウト全体の高さを返します。
+		/// @return レイアウト全体の高さ
+		[[nodiscard]]
+		double height() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	lineHeight
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 1 行の高さを返します。
+		/// @return 1 行の高さ
+		[[nodiscard]]
+		double lineHeight() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_lines
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 折り返しを含めた行数を返します。
+		/// @return 行数
+		[[nodiscard]]
+		size_t num_lines() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_paragraphs
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 段落数を返します。
+		/// @return 段落数
+		[[nodiscard]]
+		size_t num_paragraphs() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	num_characters
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 改行文字を含めたテキスト全体の文字数を返します。
+		/// @return 文字数
+		[[nodiscard]]
+		size_t num_characters() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	region
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief レイアウト全体の領域を返します。
+		/// @param pos レイアウトの左上の座標
+		/// @return レイアウト全体の領域
+		[[nodiscard]]
+		RectF region(const Vec2& pos = Vec2{ 0, 0 }) const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	draw
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief テキストを描画します。
+		/// @param pos レイアウトの左上の座標
+		/// @param color 文字の色
+		/// @return レイアウト全体の領域
+		RectF draw(const Vec2& pos, const ColorF& color = Palette::White) const;
+
+		/// @brief テキストのうち、指定した表示領域と Y 方向に重なる行だけを描画します。
+		/// @param pos レイアウトの左上の座標
+		/// @param viewport 表示領域
+		/// @param color 文字の色
+		/// @return レイアウト全体の領域
+		RectF draw(const Vec2& pos, const RectF& viewport, const ColorF& color = Palette::White) const;
+
+		/// @brief テキストを描画します。
+		/// @param pos レイアウトの左上の座標
+		/// @param textEffect テキストエフェクト
+		/// @return レイアウト全体の領域
+		RectF draw(const Vec2& pos, const ITextEffect& textEffect) const;
+
+		/// @brief テキストのうち、指定した表示領域と Y 方向に重なる行だけを描画します。
+		/// @param pos レイアウトの左上の座標
+		/// @param viewport 表示領域
+		/// @param textEffect テキストエフェクト
+		/// @return レイアウト全体の領域
+		RectF draw(const Vec2& pos, const RectF& viewport, const ITextEffect& textEffect) const;
+
+	private:
+
+		struct LineLayout
+		{
+			/// @brief 行のグリフの解決結果（`ResolvedGlyph::pos` は段落のテキストにおけるインデックス）
+			Array<ResolvedGlyph> glyphs;
+
+			/// @brief 各グリフのペン位置の、行頭からの X 方向のオフセット
+			Array<double> xOffsets;
+		};
+
+		struct Paragraph
+		{
+			/// @brief 段落のテキスト（`\n` を含まない）
+			String text;
+
+			/// @brief 各行のレイアウト
+			Array<LineLayout> lines;
+
+			/// @brief 各グリフの X 方向の進み幅
+			Array<double> xAdvances;
+		};
+
+		Font m_font;
+
+		TextStyle m_textStyle = TextStyle::Default();
+
+		double m_fontSize = 0.0;
+
+		double m_width = 0.0;
+
+		double m_lineHeight = 0.0;
+
+		Array<Paragraph> m_paragraphs;
+
+		/// @brief 各段落の先頭の行番号（末尾に総行数）
+		Array<size_t> m_lineOffsets;
+
+		/// @brief 各段落の先頭の文字のインデックス（末尾に総文字数 + 1）
+		Array<size_t> m_textOffsets;
+
+		[[nodiscard]]
+		Paragraph makeParagraph(StringView text) const;
+
+		void breakLines(Paragraph& paragraph, const Array<ResolvedGlyph>& resolvedGlyphs) const;
+
+		void replaceParagraphs(size_t first, size_t last, StringView text);
+
+		[[nodiscard]]
+		std::pair<size_t, size_t> locate(size_t index) const noexcept;
+
+		/// @brief 指定した段落以降の行番号と文字のインデックスを更新します。
+		/// @param first 最初に更新する段落のインデックス（それより前の段落は変更されていない必要があります）
+		void updateOffsets(size_t first);
+	};
+}
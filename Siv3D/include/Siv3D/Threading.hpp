@@ -11,6 +11,7 @@
 
 # pragma once
 # include "Common.hpp"
+# include "FunctionRef.hpp"
 
 namespace s3d
 {
@@ -26,5 +27,18 @@ namespace s3d
 		/// @return サポートされるスレッド数 | Number of concurrent threads supported
 		[[nodiscard]]
 		size_t GetConcurrency() noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ParallelFor
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 範囲 [0, count) を分割し、複数のスレッドで並列に処理します。 | Splits the range [0, count) into chunks and processes them in parallel on multiple threads.
+		/// @param count 要素数 | Number of elements
+		/// @param f 各チャンクに対して呼ばれる関数 `f(begin, end)` | Function called for each chunk as `f(begin, end)`
+		/// @param minChunkSize 1 つのチャンクに含める最小の要素数 | Minimum number of elements in a chunk
+		/// @remark `count` が `minChunkSize` 以下の場合は、呼び出し元のスレッドで処理します。 | If `count` is less than or equal to `minChunkSize`, the work is done on the calling thread.
+		void ParallelFor(size_t count, FunctionRef<void(size_t, size_t)> f, size_t minChunkSize = 1);
 	}
 }
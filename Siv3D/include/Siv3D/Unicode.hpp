@@ -26,6 +26,7 @@
 //	String FromUTF32(std::u32string_view s);
 //	std::string ToAscii(StringView asciiText);
 //	std::string ToUTF8(StringView s);
+//	void AppendUTF8(std::string& dst, StringView s);
 //	std::u16string ToUTF16(StringView s);
 //	std::wstring ToWstring(std::string_view s);
 //	std::wstring ToWstring(StringView s);
@@ -149,6 +150,18 @@ namespace s3d
 		[[nodiscard]]
 		std::string ToUTF8(StringView s);
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	AppendUTF8
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief String を UTF-8 に変換して、既存の文字列の末尾に追加します。 | Converts String to UTF-8 and appends it to an existing string.
+		/// @param dst 追加先の文字列 | The string to append to
+		/// @param s 変換する文字列 | The string to convert
+		/// @remark 入力が不正な場合は何も追加しません。 | Nothing is appended if the input is invalid.
+		void AppendUTF8(std::string& dst, StringView s);
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	ToUTF16
@@ -25,7 +25,19 @@ namespace s3d
 	struct alignas(16) Vertex2D
 	{
 		/// @brief 2D 描画のインデックス配列に使われる型
+		/// @remark `SIV3D_VERTEX2D_INDEX32` が 1 の場合は uint32 になります。
+	# if SIV3D_VERTEX2D_INDEX32
+		using IndexType = uint32;
+	# else
 		using IndexType = uint16;
+	# endif
+
+		/// @brief 1 回の描画バッチに含められる頂点数の上限
+		static constexpr uint32 MaxBatchVertexCount = ((sizeof(IndexType) == 2) ? 65535 : (1 << 18));
+
+		/// @brief 1 回の描画バッチに含められるインデックス数の上限
+		/// @remark 頂点数の上限とは独立しています。16-bit インデックスでは、インデックス数自体が IndexType で表せる範囲に制限されます。
+		static constexpr uint32 MaxBatchIndexCount = ((sizeof(IndexType) == 2) ? 65535 : (1 << 20));
 
 		/// @brief 位置
 		Float2 pos;
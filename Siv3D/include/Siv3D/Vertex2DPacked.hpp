@@ -0,0 +1,81 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include "Common.hpp"
+# include "PointVector.hpp"
+# include "Color.hpp"
+# include "HalfFloat.hpp"
+# include "Vertex2D.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	Vertex2DPacked
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 色を 8-bit UNORM で格納する、GPU 転送用の 2D 図形の頂点データ (20 bytes)
+	struct Vertex2DPacked
+	{
+		/// @brief 位置
+		Float2 pos;
+
+		/// @brief UV 座標
+		Float2 tex;
+
+		/// @brief 色
+		Color color;
+	};
+
+	static_assert(sizeof(Vertex2DPacked) == 20);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Vertex2DPackedHalf
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 色を 8-bit UNORM, UV 座標を半精度浮動小数点数で格納する、GPU 転送用の 2D 図形の頂点データ (16 bytes)
+	struct Vertex2DPackedHalf
+	{
+		/// @brief 位置
+		Float2 pos;
+
+		/// @brief UV 座標
+		HalfFloat tex[2];
+
+		/// @brief 色
+		Color color;
+	};
+
+	static_assert(sizeof(Vertex2DPackedHalf) == 16);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	PackVertex2D
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief Vertex2D の配列を Vertex2DPacked に変換します。
+	/// @param src 変換元の頂点配列
+	/// @param dst 変換先。`src.size()` 個以上の要素を書き込める必要があります。
+	/// @remark 色の各成分は [0.0, 1.0] の範囲にクランプされます。
+	void PackVertex2D(std::span<const Vertex2D> src, Vertex2DPacked* dst) noexcept;
+
+	/// @brief Vertex2D の配列を Vertex2DPackedHalf に変換します。
+	/// @param src 変換元の頂点配列
+	/// @param dst 変換先。`src.size()` 個以上の要素を書き込める必要があります。
+	/// @remark 色の各成分は [0.0, 1.0] の範囲にクランプされます。
+	void PackVertex2D(std::span<const Vertex2D> src, Vertex2DPackedHalf* dst) noexcept;
+}
@@ -2026,6 +2026,43 @@ namespace s3d
 		return std::move(sort_by(std::forward<Fty>(f)));
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	sort_natural, sorted_natural
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type, class Allocator>
+	Array<Type, Allocator>& Array<Type, Allocator>::sort_natural() &
+		requires std::same_as<value_type, String>
+	{
+		SortNatural(m_container);
+		return *this;
+	}
+
+	template <class Type, class Allocator>
+	Array<Type, Allocator> Array<Type, Allocator>::sort_natural() &&
+		requires std::same_as<value_type, String>
+	{
+		return std::move(sort_natural());
+	}
+
+	template <class Type, class Allocator>
+	Array<Type, Allocator> Array<Type, Allocator>::sorted_natural() const&
+		requires std::same_as<value_type, String>
+	{
+		Array result(*this);
+		result.sort_natural();
+		return result;
+	}
+
+	template <class Type, class Allocator>
+	Array<Type, Allocator> Array<Type, Allocator>::sorted_natural() &&
+		requires std::same_as<value_type, String>
+	{
+		return std::move(sort_natural());
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	stable_partition
@@ -288,5 +288,19 @@ namespace s3d
 
 		return result;
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	parallel_sort_natural
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <class Type, class Allocator>
+	Array<Type, Allocator>& Array<Type, Allocator>::parallel_sort_natural() &
+		requires std::same_as<value_type, String>
+	{
+		SortNatural(m_container, Parallelize::Yes);
+		return *this;
+	}
 }
 
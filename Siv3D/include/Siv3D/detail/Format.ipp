@@ -63,4 +63,43 @@ namespace s3d
 			Apply(formatData, args...);
 		}
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	FormatTo
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <Concept::Formattable... Args>
+	inline void FormatTo(String& out, const Args&... args)
+	{
+		FormatData formatData{ std::move(out) };
+
+		try
+		{
+			(Formatter(formatData, args), ...);
+		}
+		catch (...)
+		{
+			out = std::move(formatData.string);
+			throw;
+		}
+
+		out = std::move(formatData.string);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	FormatUTF8To
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <Concept::Formattable... Args>
+	inline void FormatUTF8To(std::string& out, const Args&... args)
+	{
+		FormatData formatData{ detail::AcquireFormatBuffer() };
+		(Formatter(formatData, args), ...);
+		Unicode::AppendUTF8(out, formatData.string);
+		detail::ReleaseFormatBuffer(std::move(formatData.string));
+	}
 }
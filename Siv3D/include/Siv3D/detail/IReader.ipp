@@ -45,4 +45,15 @@ namespace s3d
 	{
 		return (lookahead(std::addressof(dst), sizeof(dst)) == sizeof(dst));
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	data
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline const void* IReader::data() const noexcept
+	{
+		return nullptr;
+	}
 }
@@ -0,0 +1,119 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	getScaleDenominator
+	//
+	////////////////////////////////////////////////////////////////
+
+	constexpr int32 ImageDecodeOptions::getScaleDenominator() const noexcept
+	{
+		if (scaleDenominator <= 1)
+		{
+			return 1;
+		}
+		else if (scaleDenominator <= 2)
+		{
+			return 2;
+		}
+		else if (scaleDenominator <= 4)
+		{
+			return 4;
+		}
+		else
+		{
+			return 8;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getScaledSize
+	//
+	////////////////////////////////////////////////////////////////
+
+	constexpr Size ImageDecodeOptions::getScaledSize(const Size& size) const noexcept
+	{
+		const int32 denominator = getScaleDenominator();
+
+		return{ ((size.x + denominator - 1) / denominator), ((size.y + denominator - 1) / denominator) };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getSourceRect
+	//
+	////////////////////////////////////////////////////////////////
+
+	constexpr Rect ImageDecodeOptions::getSourceRect(const Size& imageSize) const noexcept
+	{
+		if (not sourceRect)
+		{
+			return{ 0, 0, imageSize };
+		}
+
+		const int32 left	= Max(sourceRect->x, 0);
+		const int32 top		= Max(sourceRect->y, 0);
+		const int32 right	= Min((sourceRect->x + sourceRect->w), imageSize.x);
+		const int32 bottom	= Min((sourceRect->y + sourceRect->h), imageSize.y);
+
+		if ((right <= left) || (bottom <= top))
+		{
+			return{ 0, 0, 0, 0 };
+		}
+
+		return{ left, top, (right - left), (bottom - top) };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getOutputSize
+	//
+	////////////////////////////////////////////////////////////////
+
+	constexpr Size ImageDecodeOptions::getOutputSize(const Size& imageSize) const noexcept
+	{
+		const Size regionSize = getSourceRect(imageSize).size;
+
+		if ((regionSize.x == 0) || (regionSize.y == 0))
+		{
+			return{ 0, 0 };
+		}
+
+		const Size scaledSize = getScaledSize(regionSize);
+
+		if ((not maxSize) || ((scaledSize.x <= maxSize->x) && (scaledSize.y <= maxSize->y)))
+		{
+			return scaledSize;
+		}
+
+		const double scale = Min((static_cast<double>(Max(maxSize->x, 1)) / scaledSize.x), (static_cast<double>(Max(maxSize->y, 1)) / scaledSize.y));
+
+		return{ Max(static_cast<int32>(scaledSize.x * scale + 0.5), 1), Max(static_cast<int32>(scaledSize.y * scale + 0.5), 1) };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isFullDecode
+	//
+	////////////////////////////////////////////////////////////////
+
+	constexpr bool ImageDecodeOptions::isFullDecode(const Size& imageSize) const noexcept
+	{
+		return ((getSourceRect(imageSize) == Rect{ 0, 0, imageSize })
+			&& (getOutputSize(imageSize) == imageSize));
+	}
+}
@@ -33,6 +33,18 @@ namespace s3d
 			return Decode(std::make_unique<Reader>(std::forward<Reader>(reader)), premultiplyAlpha, decoderName);
 		}
 
+		template <ReaderObject Reader>
+		Image Decode(Reader&& reader, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+		{
+			return Decode(std::make_unique<Reader>(std::forward<Reader>(reader)), options, imageFormat);
+		}
+
+		template <ReaderObject Reader>
+		Image Decode(Reader&& reader, const ImageDecodeOptions& options, const StringView decoderName)
+		{
+			return Decode(std::make_unique<Reader>(std::forward<Reader>(reader)), options, decoderName);
+		}
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	DecodeGray16
@@ -0,0 +1,126 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	template <Concept::Formattable... Args>
+	inline InlineFormat<N>::InlineFormat(const Args&... args)
+	{
+		FormatData formatData{ detail::AcquireFormatBuffer() };
+		(Formatter(formatData, args), ...);
+
+		m_length = formatData.string.size();
+
+		if (m_length <= N)
+		{
+			std::char_traits<char32>::copy(m_buffer, formatData.string.data(), m_length);
+			m_buffer[m_length] = U'\0';
+			detail::ReleaseFormatBuffer(std::move(formatData.string));
+		}
+		else
+		{
+			m_overflow = std::move(formatData.string);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	data
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline const char32* InlineFormat<N>::data() const noexcept
+	{
+		return (isInline() ? m_buffer : m_overflow.c_str());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline size_t InlineFormat<N>::size() const noexcept
+	{
+		return m_length;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isEmpty
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline bool InlineFormat<N>::isEmpty() const noexcept
+	{
+		return (m_length == 0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isInline
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline bool InlineFormat<N>::isInline() const noexcept
+	{
+		return (m_length <= N);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	view
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline StringView InlineFormat<N>::view() const noexcept
+	{
+		return{ data(), m_length };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator StringView
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline InlineFormat<N>::operator StringView() const noexcept
+	{
+		return view();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	str
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <size_t N>
+	inline String InlineFormat<N>::str() const
+	{
+		return String{ view() };
+	}
+}
@@ -0,0 +1,118 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	data
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline const char32* InternedString::data() const noexcept
+	{
+		if (m_entry)
+		{
+			return reinterpret_cast<const char32*>(m_entry + 1);
+		}
+
+		return U"";
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	size, length
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline size_t InternedString::size() const noexcept
+	{
+		return (m_entry ? m_entry->length : 0);
+	}
+
+	inline size_t InternedString::length() const noexcept
+	{
+		return size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isEmpty
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline bool InternedString::isEmpty() const noexcept
+	{
+		return (m_entry == nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	view
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline StringView InternedString::view() const noexcept
+	{
+		return{ data(), size() };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator StringView
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline InternedString::operator StringView() const noexcept
+	{
+		return view();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	str
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline String InternedString::str() const
+	{
+		return String{ view() };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	hash
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline uint64 InternedString::hash() const noexcept
+	{
+		if (m_entry)
+		{
+			return m_entry->hash;
+		}
+
+		return StringView{}.hash();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	swap
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline void InternedString::swap(InternedString& other) noexcept
+	{
+		std::swap(m_entry, other.m_entry);
+	}
+}
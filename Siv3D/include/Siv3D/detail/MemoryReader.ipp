@@ -126,4 +126,15 @@ namespace s3d
 	{
 		return (lookahead(std::addressof(dst), sizeof(dst)) == sizeof(dst));
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	data
+	//
+	////////////////////////////////////////////////////////////////
+
+	inline const void* MemoryReader::data() const noexcept
+	{
+		return m_blob.data();
+	}
 }
@@ -122,4 +122,15 @@ namespace s3d
 	{
 		return (lookahead(std::addressof(dst), sizeof(dst)) == sizeof(dst));
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	data
+	//
+	////////////////////////////////////////////////////////////////
+
+	constexpr const void* MemoryViewReader::data() const noexcept
+	{
+		return m_base;
+	}
 }
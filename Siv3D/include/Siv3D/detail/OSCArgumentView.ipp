@@ -0,0 +1,70 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	inline bool OSCArgumentView::getBool() const
+	{
+		return std::get<bool>(value);
+	}
+
+	inline char OSCArgumentView::getChar() const
+	{
+		return std::get<char>(value);
+	}
+
+	inline int32 OSCArgumentView::getInt32() const
+	{
+		return std::get<int32>(value);
+	}
+
+	inline int64 OSCArgumentView::getInt64() const
+	{
+		return std::get<int64>(value);
+	}
+
+	inline float OSCArgumentView::getFloat() const
+	{
+		return std::get<float>(value);
+	}
+
+	inline double OSCArgumentView::getDouble() const
+	{
+		return std::get<double>(value);
+	}
+
+	inline uint32 OSCArgumentView::getMIDIMessage() const
+	{
+		return std::get<uint32>(value);
+	}
+
+	inline uint64 OSCArgumentView::getTimeTag() const
+	{
+		return std::get<uint64>(value);
+	}
+
+	inline Color OSCArgumentView::getColor() const
+	{
+		return std::get<Color>(value);
+	}
+
+	inline std::string_view OSCArgumentView::getString() const
+	{
+		return std::get<std::string_view>(value);
+	}
+
+	inline std::span<const Byte> OSCArgumentView::getBlob() const
+	{
+		return std::get<std::span<const Byte>>(value);
+	}
+}
@@ -1131,6 +1131,127 @@ namespace s3d
 		batchOctaveNoiseNormalized01(first, size.x, size.y, baseX, baseY, xStep, yStep, z, parameters, std::move(convert));
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	fractalNoise
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <Concept::FloatingPoint Float>
+	BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::fractalNoise(value_type x, value_type y, const FractalType type, const Parameters parameters) const noexcept
+	{
+		if (parameters.octaves <= 0)
+		{
+			return 0;
+		}
+
+		value_type result = 0;
+		value_type amplitude = 1;
+
+		for (int32 i = 0; i < parameters.octaves; ++i)
+		{
+			result += (FractalOctave(noise(x, y), type) * amplitude);
+			x *= 2;
+			y *= 2;
+			amplitude *= parameters.persistence;
+		}
+
+		return (result / AmplitudeSum(parameters));
+	}
+
+	template <Concept::FloatingPoint Float>
+	BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::fractalNoise(const Vector2D<value_type> xy, const FractalType type, const Parameters parameters) const noexcept
+	{
+		return fractalNoise(xy.x, xy.y, type, parameters);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	batchFractalNoise
+	//
+	////////////////////////////////////////////////////////////////
+
+	template <Concept::FloatingPoint Float>
+	template <class OutputIterator, class Converter>
+	void BasicPerlinNoise<Float>::batchFractalNoise(OutputIterator first, const int32 width, const int32 height,
+		const value_type baseX, const value_type baseY, const value_type xStep, const value_type yStep,
+		const FractalType type, const Parameters parameters, Converter convert, const Parallelize parallelize) const
+	{
+		if ((width <= 0) || (height <= 0))
+		{
+			return;
+		}
+
+		// 各オクターブの X 方向の項は全行で共通なので事前計算する。
+		// 自動ベクトル化しやすいよう、オクターブごとに FractalLaneCount の倍数の長さで並べる。
+		const int32 octaves = Max(parameters.octaves, 0);
+		const int32 stride = (((width + (FractalLaneCount - 1)) / FractalLaneCount) * FractalLaneCount);
+
+		FractalColumns columns;
+		columns.stride = stride;
+		columns.permA.resize(static_cast<size_t>(octaves) * stride);
+		columns.permB.resize(static_cast<size_t>(octaves) * stride);
+		columns.fx.resize(static_cast<size_t>(octaves) * stride);
+		{
+			value_type frequency = 1;
+
+			for (int32 octave = 0; octave < octaves; ++octave)
+			{
+				const size_t offset = (static_cast<size_t>(octave) * stride);
+
+				for (int32 x = 0; x < stride; ++x)
+				{
+					// fractalNoise() と同じ座標になるよう (base + i * step) * frequency で評価する。
+					const value_type currentX = ((baseX + (static_cast<value_type>(x) * xStep)) * frequency);
+					const value_type _x = std::floor(currentX);
+					const int32 ix = (static_cast<int32>(_x) & 255);
+
+					columns.permA[offset + x] = m_perm[ix];
+					columns.permB[offset + x] = m_perm[ix + 1];
+					columns.fx[offset + x] = (currentX - _x);
+				}
+
+				frequency *= 2;
+			}
+		}
+
+		if constexpr (std::random_access_iterator<OutputIterator>)
+		{
+			if (parallelize)
+			{
+				// 1 タスクあたりの点の数が少なすぎるとスレッドの起動コストが上回るため、行をまとめて分割する。
+				const size_t minRowsPerTask = Max<size_t>(1, (size_t{ 16384 } / static_cast<size_t>(width)));
+
+				Threading::ParallelFor(static_cast<size_t>(height), [&](const size_t beginY, const size_t endY)
+					{
+						for (size_t y = beginY; y < endY; ++y)
+						{
+							OutputIterator it = (first + static_cast<std::iter_difference_t<OutputIterator>>(y * static_cast<size_t>(width)));
+							const value_type rowY = (baseY + (static_cast<value_type>(y) * yStep));
+							fractalNoiseRow(it, width, rowY, columns, type, parameters, convert);
+						}
+					}, minRowsPerTask);
+
+				return;
+			}
+		}
+
+		for (int32 y = 0; y < height; ++y)
+		{
+			const value_type rowY = (baseY + (static_cast<value_type>(y) * yStep));
+			fractalNoiseRow(first, width, rowY, columns, type, parameters, convert);
+		}
+	}
+
+	template <Concept::FloatingPoint Float>
+	template <class OutputIterator, class Converter>
+	void BasicPerlinNoise<Float>::batchFractalNoise(OutputIterator first, const Size size,
+		const value_type baseX, const value_type baseY, const value_type xStep, const value_type yStep,
+		const FractalType type, const Parameters parameters, Converter convert, const Parallelize parallelize) const
+	{
+		batchFractalNoise(first, size.x, size.y, baseX, baseY, xStep, yStep, type, parameters, std::move(convert), parallelize);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	serialize, deserialize
@@ -1212,4 +1333,162 @@ namespace s3d
 
 		return sum;
 	}
+
+	template <Concept::FloatingPoint Float>
+	constexpr BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::FractalOctave(const value_type n, const FractalType type) noexcept
+	{
+		switch (type)
+		{
+		case FractalType::Turbulence:
+			return (n < 0 ? -n : n);
+		case FractalType::Ridged:
+			{
+				const value_type r = (value_type(1) - (n < 0 ? -n : n));
+				return (r * r);
+			}
+		default:
+			return n;
+		}
+	}
+
+	// Gradients[hash & 15] との内積を、表を引かずに比較と選択だけで求める（SIMD 化のため）。
+	template <Concept::FloatingPoint Float>
+	constexpr BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::GradBranchless(const int32 hash, const value_type x, const value_type y, const value_type z) noexcept
+	{
+		const int32 h = (hash & 15);
+		const value_type u = ((h < 8) ? x : y);
+		const value_type v = ((h < 4) ? y : (((h == 12) || (h == 14)) ? x : z));
+		return (((h & 1) ? -u : u) + ((h & 2) ? -v : v));
+	}
+
+	// X 方向の FractalLaneCount 点ごとに、順列表の参照と補間計算を分けて行う。
+	// 補間計算は固定長の配列に対するループになるため、コンパイラによって SIMD 化される。
+	// 各点の演算の順序は noise(x, y) と同じにしてあるため、fractalNoise() と同じ結果になる。
+	template <Concept::FloatingPoint Float>
+	template <class OutputIterator, class Converter>
+	void BasicPerlinNoise<Float>::fractalNoiseRow(OutputIterator& it, const int32 width, const value_type rowY,
+		const FractalColumns& columns, const FractalType type, const Parameters parameters, Converter& convert) const
+	{
+		constexpr int32 L = FractalLaneCount;
+
+		// 2D ノイズの z は常に EntropyZ
+		const value_type _z = std::floor(EntropyZ);
+		const int32 iz = (static_cast<int32>(_z) & 255);
+		const value_type fz = (EntropyZ - _z);
+		const value_type fz_minus_1 = (fz - 1);
+		const value_type w = Fade(fz);
+
+		const value_type ampSum = ((0 < parameters.octaves) ? AmplitudeSum(parameters) : value_type(1));
+
+		alignas(32) int32 hashes[8][L];
+		alignas(32) value_type n[L];
+		alignas(32) value_type sum[L];
+
+		for (int32 x0 = 0; x0 < width; x0 += L)
+		{
+			for (int32 lane = 0; lane < L; ++lane)
+			{
+				sum[lane] = 0;
+			}
+
+			value_type frequency = 1;
+			value_type amplitude = 1;
+
+			for (int32 octave = 0; octave < parameters.octaves; ++octave)
+			{
+				const value_type currentY = (rowY * frequency);
+				const value_type _y = std::floor(currentY);
+				const int32 iy = (static_cast<int32>(_y) & 255);
+				const value_type fy = (currentY - _y);
+				const value_type fy_minus_1 = (fy - 1);
+				const value_type v = Fade(fy);
+
+				const size_t offset = ((static_cast<size_t>(octave) * columns.stride) + x0);
+				const int32* pPermA = (columns.permA.data() + offset);
+				const int32* pPermB = (columns.permB.data() + offset);
+				const value_type* pFx = (columns.fx.data() + offset);
+
+				// 順列表の参照
+				for (int32 lane = 0; lane < L; ++lane)
+				{
+					const int32 A = (pPermA[lane] + iy);
+					const int32 B = (pPermB[lane] + iy);
+					const int32 AA = (m_perm[A] + iz);
+					const int32 AB = (m_perm[A + 1] + iz);
+					const int32 BA = (m_perm[B] + iz);
+					const int32 BB = (m_perm[B + 1] + iz);
+
+					hashes[0][lane] = m_perm[AA];
+					hashes[1][lane] = m_perm[BA];
+					hashes[2][lane] = m_perm[AB];
+					hashes[3][lane] = m_perm[BB];
+					hashes[4][lane] = m_perm[AA + 1];
+					hashes[5][lane] = m_perm[BA + 1];
+					hashes[6][lane] = m_perm[AB + 1];
+					hashes[7][lane] = m_perm[BB + 1];
+				}
+
+				// 補間
+				for (int32 lane = 0; lane < L; ++lane)
+				{
+					const value_type fx = pFx[lane];
+					const value_type fx_minus_1 = (fx - 1);
+					const value_type u = Fade(fx);
+
+					const value_type p0 = GradBranchless(hashes[0][lane], fx, fy, fz);
+					const value_type p1 = GradBranchless(hashes[1][lane], fx_minus_1, fy, fz);
+					const value_type p2 = GradBranchless(hashes[2][lane], fx, fy_minus_1, fz);
+					const value_type p3 = GradBranchless(hashes[3][lane], fx_minus_1, fy_minus_1, fz);
+					const value_type p4 = GradBranchless(hashes[4][lane], fx, fy, fz_minus_1);
+					const value_type p5 = GradBranchless(hashes[5][lane], fx_minus_1, fy, fz_minus_1);
+					const value_type p6 = GradBranchless(hashes[6][lane], fx, fy_minus_1, fz_minus_1);
+					const value_type p7 = GradBranchless(hashes[7][lane], fx_minus_1, fy_minus_1, fz_minus_1);
+
+					const value_type q0 = Lerp(p0, p1, u);
+					const value_type q1 = Lerp(p2, p3, u);
+					const value_type q2 = Lerp(p4, p5, u);
+					const value_type q3 = Lerp(p6, p7, u);
+
+					const value_type r0 = Lerp(q0, q1, v);
+					const value_type r1 = Lerp(q2, q3, v);
+
+					n[lane] = Lerp(r0, r1, w);
+				}
+
+				// 合成（分岐をループの外に出す）
+				switch (type)
+				{
+				case FractalType::Turbulence:
+					for (int32 lane = 0; lane < L; ++lane)
+					{
+						sum[lane] += (FractalOctave(n[lane], FractalType::Turbulence) * amplitude);
+					}
+					break;
+				case FractalType::Ridged:
+					for (int32 lane = 0; lane < L; ++lane)
+					{
+						sum[lane] += (FractalOctave(n[lane], FractalType::Ridged) * amplitude);
+					}
+					break;
+				default:
+					for (int32 lane = 0; lane < L; ++lane)
+					{
+						sum[lane] += (n[lane] * amplitude);
+					}
+					break;
+				}
+
+				frequency *= 2;
+				amplitude *= parameters.persistence;
+			}
+
+			const int32 count = Min(L, (width - x0));
+
+			for (int32 lane = 0; lane < count; ++lane)
+			{
+				*it = convert(sum[lane] / ampSum);
+				++it;
+			}
+		}
+	}
 }
@@ -0,0 +1,205 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <poll.h>
+# include <cstring>
+# include "ChildProcessDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief ファイルディスクリプタが読み書き可能になるまで待機します。
+		static void WaitForFD(const int32 fd, const short events)
+		{
+			pollfd pfd{ .fd = fd, .events = events, .revents = 0 };
+			::poll(&pfd, 1, -1);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	PipeInputBuffer
+	//
+	////////////////////////////////////////////////////////////////
+
+	PipeInputBuffer::PipeInputBuffer(PosixProcess& process)
+		: m_process{ process } {}
+
+	PipeInputBuffer::int_type PipeInputBuffer::underflow()
+	{
+		if (gptr() < egptr())
+		{
+			return traits_type::to_int_type(*gptr());
+		}
+
+		for (;;)
+		{
+			const Optional<size_t> result = m_process.tryRead(m_buffer, sizeof(m_buffer));
+
+			if (not result)
+			{
+				return traits_type::eof();
+			}
+
+			if (*result)
+			{
+				setg(m_buffer, m_buffer, (m_buffer + *result));
+				return traits_type::to_int_type(*gptr());
+			}
+
+			WaitForFD(m_process.readFD(), POLLIN);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	PipeOutputBuffer
+	//
+	////////////////////////////////////////////////////////////////
+
+	PipeOutputBuffer::PipeOutputBuffer(PosixProcess& process)
+		: m_process{ process }
+	{
+		setp(m_buffer, (m_buffer + sizeof(m_buffer)));
+	}
+
+	PipeOutputBuffer::int_type PipeOutputBuffer::overflow(const int_type ch)
+	{
+		if (not flushBuffer())
+		{
+			return traits_type::eof();
+		}
+
+		if (not traits_type::eq_int_type(ch, traits_type::eof()))
+		{
+			*pptr() = traits_type::to_char_type(ch);
+			pbump(1);
+		}
+
+		return traits_type::not_eof(ch);
+	}
+
+	int PipeOutputBuffer::sync()
+	{
+		return (flushBuffer() ? 0 : -1);
+	}
+
+	bool PipeOutputBuffer::flushBuffer()
+	{
+		const char* p = pbase();
+		const char* const pEnd = pptr();
+
+		while (p < pEnd)
+		{
+			const Optional<size_t> result = m_process.tryWrite(p, static_cast<size_t>(pEnd - p));
+
+			if (not result)
+			{
+				setp(m_buffer, (m_buffer + sizeof(m_buffer)));
+				return false;
+			}
+
+			if (*result)
+			{
+				p += *result;
+			}
+			else
+			{
+				WaitForFD(m_process.writeFD(), POLLOUT);
+			}
+		}
+
+		setp(m_buffer, (m_buffer + sizeof(m_buffer)));
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	ChildProcessDetail
+	//
+	////////////////////////////////////////////////////////////////
+
+	ChildProcess::ChildProcessDetail::ChildProcessDetail() {}
+
+	ChildProcess::ChildProcessDetail::ChildProcessDetail(const FilePathView path, const Array<String>& commands, const Pipe pipe)
+	{
+		m_process.spawn(path, commands, pipe);
+	}
+
+	ChildProcess::ChildProcessDetail::~ChildProcessDetail()
+	{
+		m_oPipeStream.flush();
+	}
+
+	bool ChildProcess::ChildProcessDetail::isValid() const
+	{
+		return m_process.isValid();
+	}
+
+	bool ChildProcess::ChildProcessDetail::isRunning()
+	{
+		return m_process.isRunning();
+	}
+
+	void ChildProcess::ChildProcessDetail::wait()
+	{
+		m_oPipeStream.flush();
+		m_process.wait();
+	}
+
+	void ChildProcess::ChildProcessDetail::terminate()
+	{
+		m_process.terminate();
+	}
+
+	Optional<int32> ChildProcess::ChildProcessDetail::getExitCode()
+	{
+		return m_process.getExitCode();
+	}
+
+	std::istream& ChildProcess::ChildProcessDetail::istream()
+	{
+		return m_iPipeStream;
+	}
+
+	std::ostream& ChildProcess::ChildProcessDetail::ostream()
+	{
+		return m_oPipeStream;
+	}
+
+	Optional<size_t> ChildProcess::ChildProcessDetail::tryRead(void* dst, const size_t size)
+	{
+		// istream() がバッファに読み込み済みのデータを先に返す
+		if (const std::streamsize buffered = m_inputBuffer.in_avail();
+			0 < buffered)
+		{
+			return static_cast<size_t>(m_inputBuffer.sgetn(static_cast<char*>(dst), Min(static_cast<std::streamsize>(size), buffered)));
+		}
+
+		return m_process.tryRead(dst, size);
+	}
+
+	Optional<size_t> ChildProcess::ChildProcessDetail::tryWrite(const void* src, const size_t size)
+	{
+		// ostream() で書き込んだデータの順序を保つ
+		m_oPipeStream.flush();
+
+		return m_process.tryWrite(src, size);
+	}
+
+	void ChildProcess::ChildProcessDetail::closeStdIn()
+	{
+		m_oPipeStream.flush();
+		m_process.closeStdIn();
+	}
+}
@@ -0,0 +1,103 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <istream>
+# include <ostream>
+# include <Siv3D/ChildProcess.hpp>
+# include <Siv3D/ChildProcess/PosixProcess.hpp>
+
+namespace s3d
+{
+	/// @brief ノンブロッキングのパイプを、必要に応じて待機しながら読み込む streambuf
+	class PipeInputBuffer : public std::streambuf
+	{
+	public:
+
+		explicit PipeInputBuffer(PosixProcess& process);
+
+	protected:
+
+		int_type underflow() override;
+
+	private:
+
+		PosixProcess& m_process;
+
+		char m_buffer[4096];
+	};
+
+	/// @brief ノンブロッキングのパイプに、必要に応じて待機しながら書き込む streambuf
+	class PipeOutputBuffer : public std::streambuf
+	{
+	public:
+
+		explicit PipeOutputBuffer(PosixProcess& process);
+
+	protected:
+
+		int_type overflow(int_type ch) override;
+
+		int sync() override;
+
+	private:
+
+		PosixProcess& m_process;
+
+		char m_buffer[4096];
+
+		bool flushBuffer();
+	};
+
+	class ChildProcess::ChildProcessDetail
+	{
+	public:
+
+		ChildProcessDetail();
+
+		ChildProcessDetail(const FilePathView path, const Array<String>& commands, Pipe pipe);
+
+		~ChildProcessDetail();
+
+		bool isValid() const;
+
+		bool isRunning();
+
+		void wait();
+
+		void terminate();
+
+		Optional<int32> getExitCode();
+
+		std::istream& istream();
+
+		std::ostream& ostream();
+
+		Optional<size_t> tryRead(void* dst, size_t size);
+
+		Optional<size_t> tryWrite(const void* src, size_t size);
+
+		void closeStdIn();
+
+	private:
+
+		PosixProcess m_process;
+
+		PipeInputBuffer m_inputBuffer{ m_process };
+
+		PipeOutputBuffer m_outputBuffer{ m_process };
+
+		std::istream m_iPipeStream{ &m_inputBuffer };
+
+		std::ostream m_oPipeStream{ &m_outputBuffer };
+	};
+}
@@ -0,0 +1,191 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <sys/stat.h>
+# include <sys/syscall.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <dirent.h>
+# include <ctime>
+# include <Siv3D/DirectoryEntry.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/DirectoryWalker/DirectoryWalkerDetail.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief getdents64 が返すエントリ
+		struct LinuxDirent64
+		{
+			uint64 d_ino;
+
+			int64 d_off;
+
+			uint16 d_reclen;
+
+			uint8 d_type;
+
+			char d_name[];
+		};
+
+		/// @brief getdents64 で一度に読み込むバッファのサイズ
+		constexpr size_t DirentBufferSize = (32 * 1024);
+
+		[[nodiscard]]
+		static DirectoryEntryType FromDType(const uint8 type) noexcept
+		{
+			switch (type)
+			{
+			case DT_REG:
+				return DirectoryEntryType::File;
+			case DT_DIR:
+				return DirectoryEntryType::Directory;
+			case DT_LNK:
+				return DirectoryEntryType::SymbolicLink;
+			default:
+				return DirectoryEntryType::Other;
+			}
+		}
+
+		[[nodiscard]]
+		static DirectoryEntryType FromMode(const uint32 mode) noexcept
+		{
+			if (S_ISREG(mode))
+			{
+				return DirectoryEntryType::File;
+			}
+			else if (S_ISDIR(mode))
+			{
+				return DirectoryEntryType::Directory;
+			}
+			else if (S_ISLNK(mode))
+			{
+				return DirectoryEntryType::SymbolicLink;
+			}
+			else
+			{
+				return DirectoryEntryType::Other;
+			}
+		}
+
+		[[nodiscard]]
+		static constexpr bool IsCurrentOrParentDirectory(const char* name) noexcept
+		{
+			return ((name[0] == '.')
+				&& ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0'))));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryEntry::writeTime
+	//
+	////////////////////////////////////////////////////////////////
+
+	DateTime DirectoryEntry::writeTime() const
+	{
+		const ::time_t seconds = static_cast<::time_t>(writeTimeNs / 1'000'000'000);
+		const int32 milliseconds = static_cast<int32>((writeTimeNs % 1'000'000'000) / 1'000'000);
+
+		::tm lt;
+		::localtime_r(&seconds, &lt);
+		return{ (1900 + lt.tm_year),
+				(1 + lt.tm_mon),
+				(lt.tm_mday),
+				lt.tm_hour,
+				lt.tm_min,
+				lt.tm_sec,
+				milliseconds };
+	}
+
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	ReadDirectory
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ReadDirectory(const FilePath& directory, const bool fetchMetadata, const FunctionRef<bool(DirectoryEntry&&)> f)
+		{
+			const int32 fd = ::open(directory.toUTF8().c_str(), (O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+
+			if (fd == -1)
+			{
+				return;
+			}
+
+			alignas(LinuxDirent64) uint8 buffer[DirentBufferSize];
+
+			for (;;)
+			{
+				// readdir() と異なり、1 回のシステムコールで多数のエントリを読み込む
+				const long numBytes = ::syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+
+				if (numBytes <= 0)
+				{
+					break;
+				}
+
+				for (long offset = 0; offset < numBytes;)
+				{
+					const LinuxDirent64* dirent = reinterpret_cast<const LinuxDirent64*>(buffer + offset);
+					offset += dirent->d_reclen;
+
+					if (IsCurrentOrParentDirectory(dirent->d_name))
+					{
+						continue;
+					}
+
+					DirectoryEntry entry{ .type = FromDType(dirent->d_type) };
+
+					// d_type をサポートしないファイルシステムでは、種類を得るためにも statx が必要
+					if (fetchMetadata || (dirent->d_type == DT_UNKNOWN))
+					{
+						struct statx sx;
+
+						// ディレクトリの fd からの相対パスで問い合わせることで、パスの解決を省略する
+						if (::statx(fd, dirent->d_name, (AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT | AT_STATX_DONT_SYNC),
+							(STATX_TYPE | STATX_SIZE | STATX_MTIME), &sx) != 0)
+						{
+							// 列挙中に削除された
+							continue;
+						}
+
+						entry.type = FromMode(sx.stx_mode);
+
+						if (fetchMetadata)
+						{
+							entry.size = (entry.isFile() ? sx.stx_size : 0);
+							entry.writeTimeNs = ((static_cast<int64>(sx.stx_mtime.tv_sec) * 1'000'000'000) + sx.stx_mtime.tv_nsec);
+						}
+					}
+
+					entry.path = (directory + Unicode::FromUTF8(dirent->d_name));
+
+					if (entry.isDirectory())
+					{
+						entry.path.push_back(U'/');
+					}
+
+					if (not f(std::move(entry)))
+					{
+						::close(fd);
+						return;
+					}
+				}
+			}
+
+			::close(fd);
+		}
+	}
+}
@@ -0,0 +1,467 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <sys/eventfd.h>
+# include <sys/stat.h>
+# include <poll.h>
+# include <dirent.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <cerrno>
+# include <cstring>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/RangeFormatter.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Unicode.hpp>
+# include "DirectoryWatcherDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 監視するイベント
+		/// @remark IN_DELETE_SELF, IN_MOVE_SELF を受け取ったディレクトリの watch は、続く IN_IGNORED で破棄します。
+		constexpr uint32 WatchMask = (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO
+			| IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR | IN_DONT_FOLLOW | IN_EXCL_UNLINK);
+
+		/// @brief 一度に読み込むイベントのバッファサイズ
+		constexpr size_t EventBufferSize = (64 * 1024);
+
+		[[nodiscard]]
+		static bool IsDirectoryEntry(DIR* dir, const dirent* entry)
+		{
+			if (entry->d_type != DT_UNKNOWN)
+			{
+				return (entry->d_type == DT_DIR);
+			}
+
+			// d_type をサポートしないファイルシステムの場合
+			struct stat s;
+
+			if (::fstatat(::dirfd(dir), entry->d_name, &s, AT_SYMLINK_NOFOLLOW) != 0)
+			{
+				return false;
+			}
+
+			return S_ISDIR(s.st_mode);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWatcher::DirectoryWatcherDetail::~DirectoryWatcherDetail()
+	{
+		// スレッドに終了シグナルを送り、終了を待機する
+		if (m_thread.joinable())
+		{
+			const uint64 value = 1;
+			[[maybe_unused]] const ssize_t result = ::write(m_stopEventFD, &value, sizeof(value));
+
+			m_thread.join();
+		}
+
+		// リソースの破棄
+		{
+			if (m_inotifyFD != -1)
+			{
+				::close(m_inotifyFD);
+				m_inotifyFD = -1;
+
+				LOG_INFO(fmt::format("ℹ️ DirectoryWatcher: Stopped watching `{}`", m_directory));
+			}
+
+			if (m_stopEventFD != -1)
+			{
+				::close(m_stopEventFD);
+				m_stopEventFD = -1;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	start
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& debounceTime)
+	{
+		if (directory.isEmpty()
+			|| (not FileSystem::IsDirectory(directory)))
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcherDetail::start(): `{}` is not a directory", directory.toUTF8()));
+			return false;
+		}
+
+		m_directory = FileSystem::FullPath(directory);
+		m_extensionFilter.set(applicableExtensions);
+		m_fileChanges.setDebounceTime(debounceTime);
+
+		m_inotifyFD = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+		if (m_inotifyFD == -1)
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcher: inotify_init1() failed ({})", std::strerror(errno)));
+			return false;
+		}
+
+		m_stopEventFD = ::eventfd(0, (EFD_NONBLOCK | EFD_CLOEXEC));
+
+		if (m_stopEventFD == -1)
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcher: eventfd() failed ({})", std::strerror(errno)));
+			return false;
+		}
+
+		// 監視を始めた時点で存在するファイルは通知しない
+		if (not addWatchRecursive(m_directory, false))
+		{
+			return false;
+		}
+
+		// スレッドの開始後は m_watches をスレッドが書き換えるため、先に数を取得しておく
+		const size_t numDirectories = m_watches.size();
+
+		m_thread = std::jthread{ DirectoryWatcherDetail::Run, this };
+
+		if (m_extensionFilter)
+		{
+			LOG_INFO(fmt::format("ℹ️ DirectoryWatcher: Started to watch `{}` ({} directories). applicableExtensions = {}", m_directory, numDirectories, Format(m_extensionFilter.getSortedExtensions())));
+		}
+		else
+		{
+			LOG_INFO(fmt::format("ℹ️ DirectoryWatcher: Started to watch `{}` ({} directories)", m_directory, numDirectories));
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isActive
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::isActive() const
+	{
+		return m_thread.joinable();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	extractChanges
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DirectoryWatcher::DirectoryWatcherDetail::extractChanges(Array<FileChange>& fileChanges)
+	{
+		m_fileChanges.extract(fileChanges);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clearChanges
+	//
+	////////////////////////////////////////////////////////////////
+
+	void DirectoryWatcher::DirectoryWatcherDetail::clearChanges()
+	{
+		m_fileChanges.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	directory
+	//
+	////////////////////////////////////////////////////////////////
+
+	const FilePath& DirectoryWatcher::DirectoryWatcherDetail::directory() const noexcept
+	{
+		return m_directory;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	applicableExtensions
+	//
+	////////////////////////////////////////////////////////////////
+
+	const Array<String>& DirectoryWatcher::DirectoryWatcherDetail::applicableExtensions() const
+	{
+		return m_extensionFilter.getSortedExtensions();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::addWatchRecursive(const FilePath& directory, const bool reportContents)
+	{
+		const std::string directoryUTF8 = directory.toUTF8();
+
+		// 先に watch を追加してから列挙することで、その間に作成されたファイルの取りこぼしを防ぐ
+		const int32 wd = ::inotify_add_watch(m_inotifyFD, directoryUTF8.c_str(), WatchMask);
+
+		if (wd == -1)
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcher: inotify_add_watch() failed. `{}` ({})", directoryUTF8, std::strerror(errno)));
+			return false;
+		}
+
+		m_watches[wd] = directory;
+
+		DIR* dir = ::opendir(directoryUTF8.c_str());
+
+		if (not dir)
+		{
+			return true;
+		}
+
+		while (const dirent* entry = ::readdir(dir))
+		{
+			const std::string_view name{ entry->d_name };
+
+			if ((name == ".") || (name == ".."))
+			{
+				continue;
+			}
+
+			FilePath path = (directory + Unicode::FromUTF8(name));
+
+			if (IsDirectoryEntry(dir, entry))
+			{
+				path.push_back(U'/');
+
+				if (reportContents)
+				{
+					report(path, FileAction::Added, true);
+				}
+
+				addWatchRecursive(path, reportContents);
+			}
+			else if (reportContents)
+			{
+				report(std::move(path), FileAction::Added, false);
+			}
+		}
+
+		::closedir(dir);
+
+		return true;
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::removeWatchRecursive(const FilePath& directory)
+	{
+		for (auto it = m_watches.begin(); it != m_watches.end();)
+		{
+			if (it->second.starts_with(directory))
+			{
+				::inotify_rm_watch(m_inotifyFD, it->first);
+				m_watches.erase(it++);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::renameWatchRecursive(const FilePath& from, const FilePath& to)
+	{
+		// 移動したディレクトリ以下の watch descriptor は有効なままなので、パスだけを置き換える
+		for (auto& [wd, path] : m_watches)
+		{
+			if (path.starts_with(from))
+			{
+				path = (to + path.substr(from.size()));
+			}
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::onEvent(const inotify_event& event)
+	{
+		if (event.mask & IN_Q_OVERFLOW)
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWatcher: inotify event queue overflowed. Some changes in `{}` may be lost", m_directory));
+			return;
+		}
+
+		if (event.mask & IN_IGNORED)
+		{
+			m_watches.erase(event.wd);
+			return;
+		}
+
+		const auto it = m_watches.find(event.wd);
+
+		if ((it == m_watches.end())
+			|| (event.len == 0)) // 監視しているディレクトリ自身へのイベント
+		{
+			return;
+		}
+
+		const bool isDirectory = (event.mask & IN_ISDIR);
+		FilePath path = (it->second + Unicode::FromUTF8(std::string_view{ event.name }));
+
+		if (isDirectory)
+		{
+			path.push_back(U'/');
+		}
+
+		// ディレクトリ内での名前の変更
+		if ((event.mask & IN_MOVED_TO)
+			&& m_pendingMove
+			&& (m_pendingMove->cookie == event.cookie))
+		{
+			const PendingMove from = std::move(*m_pendingMove);
+			m_pendingMove.reset();
+
+			if (isDirectory)
+			{
+				renameWatchRecursive(from.path, path);
+			}
+
+			report(from.path, FileAction::Removed, isDirectory);
+			report(std::move(path), FileAction::Added, isDirectory);
+			return;
+		}
+
+		// 直前の IN_MOVED_FROM に対応する IN_MOVED_TO は来なかった
+		flushPendingMove();
+
+		if (event.mask & IN_MOVED_FROM)
+		{
+			m_pendingMove = PendingMove{ event.cookie, std::move(path), isDirectory };
+		}
+		else if (event.mask & IN_CREATE)
+		{
+			report(path, FileAction::Added, isDirectory);
+
+			// watch を追加する前に作られたファイルも通知する
+			if (isDirectory)
+			{
+				addWatchRecursive(path, true);
+			}
+		}
+		else if (event.mask & IN_MOVED_TO) // 監視対象外からの移動
+		{
+			report(path, FileAction::Added, isDirectory);
+
+			if (isDirectory)
+			{
+				addWatchRecursive(path, false);
+			}
+		}
+		else if (event.mask & IN_DELETE)
+		{
+			report(std::move(path), FileAction::Removed, isDirectory);
+		}
+		else if (event.mask & IN_MODIFY)
+		{
+			report(std::move(path), FileAction::Modified, isDirectory);
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::flushPendingMove()
+	{
+		if (not m_pendingMove)
+		{
+			return;
+		}
+
+		// 監視対象外への移動
+		if (m_pendingMove->isDirectory)
+		{
+			removeWatchRecursive(m_pendingMove->path);
+		}
+
+		report(std::move(m_pendingMove->path), FileAction::Removed, m_pendingMove->isDirectory);
+
+		m_pendingMove.reset();
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::report(FilePath path, const FileAction action, const bool isDirectory)
+	{
+		if ((not isDirectory) && m_extensionFilter) // 拡張子フィルタがある場合
+		{
+			if (not m_extensionFilter.includes(FileSystem::Extension(path)))
+			{
+				return;
+			}
+		}
+
+		m_fileChanges.add(std::move(path), action);
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::Run(DirectoryWatcherDetail* watcher)
+	{
+		alignas(inotify_event) uint8 buffer[EventBufferSize];
+
+		pollfd fds[2] =
+		{
+			{ .fd = watcher->m_inotifyFD, .events = POLLIN, .revents = 0 },
+			{ .fd = watcher->m_stopEventFD, .events = POLLIN, .revents = 0 },
+		};
+
+		for (;;)
+		{
+			const int32 timeout = (watcher->m_pendingMove ? MoveTimeoutMillisec : -1);
+			const int32 result = ::poll(fds, 2, timeout);
+
+			if (result == -1)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				LOG_FAIL(fmt::format("❌ DirectoryWatcher: poll() failed ({})", std::strerror(errno)));
+				return;
+			}
+
+			if (fds[1].revents & POLLIN)
+			{
+				return;
+			}
+
+			if (result == 0)
+			{
+				watcher->flushPendingMove();
+				continue;
+			}
+
+			if (not (fds[0].revents & POLLIN))
+			{
+				continue;
+			}
+
+			const ssize_t size = ::read(watcher->m_inotifyFD, buffer, sizeof(buffer));
+
+			if (size <= 0)
+			{
+				continue;
+			}
+
+			for (const uint8* p = buffer; p < (buffer + size);)
+			{
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+				watcher->onEvent(*event);
+				p += (sizeof(inotify_event) + event->len);
+			}
+		}
+	}
+}
@@ -0,0 +1,141 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <thread>
+# include <Siv3D/DirectoryWatcher.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/ExtensionFilter/ExtensionFilter.hpp>
+# include <Siv3D/DirectoryWatcher/FileChangeCoalescer.hpp>
+# include <sys/inotify.h>
+
+namespace s3d
+{
+	class DirectoryWatcher::DirectoryWatcherDetail
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		DirectoryWatcherDetail() = default;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(destructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		~DirectoryWatcherDetail();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	start
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& debounceTime);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	isActive
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool isActive() const;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	extractChanges
+		//
+		////////////////////////////////////////////////////////////////
+
+		void extractChanges(Array<FileChange>& fileChanges);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	clearChanges
+		//
+		////////////////////////////////////////////////////////////////
+
+		void clearChanges();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	directory
+		//
+		////////////////////////////////////////////////////////////////
+
+		const FilePath& directory() const noexcept;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	applicableExtensions
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		const Array<String>& applicableExtensions() const;
+
+	private:
+
+		/// @brief IN_MOVED_FROM に対応する IN_MOVED_TO を待つ時間 [ミリ秒]
+		static constexpr int32 MoveTimeoutMillisec = 50;
+
+		/// @brief 対応する IN_MOVED_TO をまだ受け取っていない IN_MOVED_FROM
+		struct PendingMove
+		{
+			uint32 cookie = 0;
+
+			FilePath path;
+
+			bool isDirectory = false;
+		};
+
+		FilePath m_directory;
+
+		ExtensionFilter m_extensionFilter;
+
+		/// @brief inotify のファイルディスクリプタ
+		int32 m_inotifyFD = -1;
+
+		/// @brief 停止通知用の eventfd
+		int32 m_stopEventFD = -1;
+
+		/// @brief watch descriptor と、監視しているディレクトリのフルパス（末尾は '/'）の対応
+		/// @remark start() の後は監視スレッドからのみアクセスします。
+		HashMap<int32, FilePath> m_watches;
+
+		Optional<PendingMove> m_pendingMove;
+
+		FileChangeCoalescer m_fileChanges;
+
+		std::jthread m_thread;
+
+		bool addWatchRecursive(const FilePath& directory, bool reportContents);
+
+		void removeWatchRecursive(const FilePath& directory);
+
+		void renameWatchRecursive(const FilePath& from, const FilePath& to);
+
+		void onEvent(const inotify_event& event);
+
+		void flushPendingMove();
+
+		void report(FilePath path, FileAction action, bool isDirectory);
+
+		static void Run(DirectoryWatcherDetail* watcher);
+	};
+}
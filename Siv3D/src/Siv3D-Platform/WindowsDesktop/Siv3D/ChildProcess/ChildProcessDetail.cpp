@@ -63,6 +63,7 @@ namespace s3d
 			break;
 		}
 
+		m_pipe = pipe;
 		m_launched = m_child.valid();
 	}
 
@@ -116,4 +117,78 @@ namespace s3d
 	{
 		return m_oPipeStream;
 	}
+
+	Optional<size_t> ChildProcess::ChildProcessDetail::tryRead(void* dst, const size_t size)
+	{
+		if ((not m_launched)
+			|| ((m_pipe != Pipe::StdIn) && (m_pipe != Pipe::StdInOut))
+			|| (not m_iPipeStream.pipe().is_open()))
+		{
+			return none;
+		}
+
+		// istream() がバッファに読み込み済みのデータを先に返す
+		if (const std::streamsize buffered = m_iPipeStream.rdbuf()->in_avail();
+			0 < buffered)
+		{
+			return static_cast<size_t>(m_iPipeStream.rdbuf()->sgetn(static_cast<char*>(dst), Min(static_cast<std::streamsize>(size), buffered)));
+		}
+
+		const HANDLE handle = m_iPipeStream.pipe().native_source();
+		DWORD available = 0;
+
+		if (not ::PeekNamedPipe(handle, nullptr, 0, nullptr, &available, nullptr))
+		{
+			// 子プロセスが標準出力を閉じた (ERROR_BROKEN_PIPE)
+			return none;
+		}
+
+		if (available == 0)
+		{
+			return 0;
+		}
+
+		DWORD readBytes = 0;
+
+		if (not ::ReadFile(handle, dst, static_cast<DWORD>(Min<size_t>(size, available)), &readBytes, nullptr))
+		{
+			return none;
+		}
+
+		return readBytes;
+	}
+
+	Optional<size_t> ChildProcess::ChildProcessDetail::tryWrite(const void* src, const size_t size)
+	{
+		if ((not m_launched)
+			|| ((m_pipe != Pipe::StdOut) && (m_pipe != Pipe::StdInOut))
+			|| (not m_oPipeStream.pipe().is_open()))
+		{
+			return none;
+		}
+
+		// ostream() で書き込んだデータの順序を保つ
+		m_oPipeStream.flush();
+
+		DWORD writtenBytes = 0;
+
+		// 匿名パイプはノンブロッキングにできないため、空きが無い場合はブロックする
+		if (not ::WriteFile(m_oPipeStream.pipe().native_sink(), src, static_cast<DWORD>(Min<size_t>(size, UINT32_MAX)), &writtenBytes, nullptr))
+		{
+			return none;
+		}
+
+		return writtenBytes;
+	}
+
+	void ChildProcess::ChildProcessDetail::closeStdIn()
+	{
+		if ((m_pipe != Pipe::StdOut) && (m_pipe != Pipe::StdInOut))
+		{
+			return;
+		}
+
+		m_oPipeStream.flush();
+		m_oPipeStream.pipe().close();
+	}
 }
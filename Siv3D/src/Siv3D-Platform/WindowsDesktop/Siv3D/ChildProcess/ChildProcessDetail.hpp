@@ -46,6 +46,12 @@ namespace s3d
 
 		std::ostream& ostream();
 
+		Optional<size_t> tryRead(void* dst, size_t size);
+
+		Optional<size_t> tryWrite(const void* src, size_t size);
+
+		void closeStdIn();
+
 	private:
 
 		boost::process::v1::opstream m_oPipeStream;
@@ -54,6 +60,8 @@ namespace s3d
 
 		boost::process::v1::child m_child;
 
+		Pipe m_pipe = Pipe::None;
+
 		bool m_launched = false;
 	};
 }
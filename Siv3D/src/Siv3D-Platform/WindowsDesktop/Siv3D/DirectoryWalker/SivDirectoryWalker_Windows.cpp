@@ -0,0 +1,128 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/DirectoryEntry.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/DirectoryWalker/DirectoryWalkerDetail.hpp>
+# include <Siv3D/FileSystem/WindowsFileSystem.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 1601-01-01 から 1970-01-01 までの FILETIME の値（100 ナノ秒単位）
+		constexpr int64 UnixEpochFileTime = 116'444'736'000'000'000;
+
+		[[nodiscard]]
+		static constexpr int64 ToUnixTimeNs(const FILETIME& fileTime) noexcept
+		{
+			const int64 ticks = static_cast<int64>((static_cast<uint64>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime);
+			return ((ticks - UnixEpochFileTime) * 100);
+		}
+
+		[[nodiscard]]
+		static constexpr FILETIME ToFileTime(const int64 unixTimeNs) noexcept
+		{
+			const uint64 ticks = static_cast<uint64>((unixTimeNs / 100) + UnixEpochFileTime);
+			return{ .dwLowDateTime = static_cast<DWORD>(ticks), .dwHighDateTime = static_cast<DWORD>(ticks >> 32) };
+		}
+
+		[[nodiscard]]
+		static constexpr bool IsCurrentOrParentDirectory(const WIN32_FIND_DATAW& data) noexcept
+		{
+			return ((data.cFileName[0] == L'.')
+				&& ((data.cFileName[1] == L'\0') || ((data.cFileName[1] == L'.') && (data.cFileName[2] == L'\0'))));
+		}
+
+		[[nodiscard]]
+		static DirectoryEntryType ToEntryType(const DWORD dwFileAttributes) noexcept
+		{
+			// シンボリックリンクやジャンクションはたどらない
+			if (dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+			{
+				return DirectoryEntryType::SymbolicLink;
+			}
+			else if (detail::IsDirectory(dwFileAttributes))
+			{
+				return DirectoryEntryType::Directory;
+			}
+			else
+			{
+				return DirectoryEntryType::File;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryEntry::writeTime
+	//
+	////////////////////////////////////////////////////////////////
+
+	DateTime DirectoryEntry::writeTime() const
+	{
+		return detail::FileTimeToTime(ToFileTime(writeTimeNs));
+	}
+
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	ReadDirectory
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ReadDirectory(const FilePath& directory, [[maybe_unused]] const bool fetchMetadata, const FunctionRef<bool(DirectoryEntry&&)> f)
+		{
+			// FindFirstFileExW は列挙と同時にサイズと最終更新日時を返すため、fetchMetadata による違いはない
+			WIN32_FIND_DATAW data;
+			HANDLE hFind = ::FindFirstFileExW((Unicode::ToWstring(directory) + L'*').c_str(), FindExInfoBasic, &data,
+				FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+
+			if (hFind == INVALID_HANDLE_VALUE)
+			{
+				return;
+			}
+
+			do
+			{
+				// "." と ".." はスキップする
+				if (IsCurrentOrParentDirectory(data))
+				{
+					continue;
+				}
+
+				DirectoryEntry entry{ .type = ToEntryType(data.dwFileAttributes) };
+
+				if (entry.isFile())
+				{
+					entry.size = detail::GetFileSize(data.nFileSizeHigh, data.nFileSizeLow);
+				}
+
+				entry.writeTimeNs = ToUnixTimeNs(data.ftLastWriteTime);
+				entry.path = (directory + Unicode::FromWstring(data.cFileName));
+
+				if (entry.isDirectory())
+				{
+					entry.path.push_back(U'/');
+				}
+
+				if (not f(std::move(entry)))
+				{
+					break;
+				}
+
+			} while (::FindNextFileW(hFind, &data));
+
+			::FindClose(hFind);
+		}
+	}
+}
@@ -121,7 +121,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions)
+	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& debounceTime)
 	{
 		if (directory.isEmpty()
 			|| (not FileSystem::IsDirectory(directory)))
@@ -132,6 +132,7 @@ namespace s3d
 
 		m_directory = FileSystem::FullPath(directory);
 		m_extensionFilter.set(applicableExtensions);
+		m_fileChanges.setDebounceTime(debounceTime);
 
 		m_initSignal = false;
 		m_initResult = false;
@@ -161,11 +162,7 @@ namespace s3d
 
 	void DirectoryWatcher::DirectoryWatcherDetail::extractChanges(Array<FileChange>& fileChanges)
 	{
-		std::lock_guard lock{ m_fileChanges.mutex };
-
-		fileChanges.swap(m_fileChanges.fileChanges);
-
-		m_fileChanges.fileChanges.clear();
+		m_fileChanges.extract(fileChanges);
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -176,9 +173,7 @@ namespace s3d
 
 	void DirectoryWatcher::DirectoryWatcherDetail::clearChanges()
 	{
-		std::lock_guard lock{ m_fileChanges.mutex };
-
-		m_fileChanges.fileChanges.clear();
+		m_fileChanges.clear();
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -358,8 +353,6 @@ namespace s3d
 			return;
 		}
 
-		std::lock_guard lock{ m_fileChanges.mutex };
-
 		if (m_pReadDirectoryChangesExW)
 		{
 			for (const uint8* pInfo = m_backBuffer.data();;)
@@ -375,12 +368,12 @@ namespace s3d
 				{
 					if (m_extensionFilter.includes(FileSystem::Extension(localPath)))
 					{
-						m_fileChanges.fileChanges.emplace_back(fullPath, action);
+						m_fileChanges.add(fullPath, action);
 					}
 				}
 				else
 				{
-					m_fileChanges.fileChanges.emplace_back(fullPath, action);
+					m_fileChanges.add(fullPath, action);
 				}
 
 				if (notifyInfo->NextEntryOffset == 0)
@@ -415,12 +408,12 @@ namespace s3d
 				{
 					if (m_extensionFilter.includes(FileSystem::Extension(localPath)))
 					{
-						m_fileChanges.fileChanges.emplace_back(fullPath, action);
+						m_fileChanges.add(fullPath, action);
 					}
 				}
 				else
 				{
-					m_fileChanges.fileChanges.emplace_back(fullPath, action);
+					m_fileChanges.add(fullPath, action);
 				}
 
 				if (notifyInfo->NextEntryOffset == 0)
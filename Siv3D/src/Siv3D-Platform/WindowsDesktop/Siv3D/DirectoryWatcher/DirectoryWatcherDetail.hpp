@@ -9,10 +9,11 @@
 //
 //-----------------------------------------------
 
+# include <atomic>
 # include <thread>
-# include <mutex>
 # include <Siv3D/DirectoryWatcher.hpp>
 # include <Siv3D/ExtensionFilter/ExtensionFilter.hpp>
+# include <Siv3D/DirectoryWatcher/FileChangeCoalescer.hpp>
 # include <Siv3D/Windows/Windows.hpp>
 
 namespace s3d
@@ -43,7 +44,7 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool start(const FilePathView directory, const Array<String>& applicableExtensions);
+		bool start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& debounceTime);
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -126,13 +127,7 @@ namespace s3d
 
 		OverlappedWrapper m_overlapped{};
 
-		struct FileChanges
-		{
-			std::mutex mutex;
-
-			Array<FileChange> fileChanges;
-		
-		} m_fileChanges;
+		FileChangeCoalescer m_fileChanges;
 
 		bool init();
 
@@ -17,6 +17,7 @@
 # include <Siv3D/Mat3x3.hpp>
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/GlyphQuad.hpp>
 # include <Siv3D/Pattern/PatternParameters.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
 # include <Siv3D/Error/InternalEngineError.hpp>
@@ -117,11 +118,25 @@ namespace s3d
 		
 		// 標準 InputLayout を作成
 		{
+		# if (SIV3D_VERTEX2D_PACKED == 2)
+			const D3D11_INPUT_ELEMENT_DESC layout[3] = {
+				{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,       0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0,  8, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM,     0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			};
+		# elif (SIV3D_VERTEX2D_PACKED == 1)
+			const D3D11_INPUT_ELEMENT_DESC layout[3] = {
+				{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,       0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0,  8, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM,     0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			};
+		# else
 			const D3D11_INPUT_ELEMENT_DESC layout[3] = {
 				{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,       0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 				{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0,  8, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 				{ "COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 			};
+		# endif
 
 			{
 				const Blob& bytecode = SIV3D_ENGINE(EngineShader)->getVS(EngineVS::Shape2D).getBytecode();
@@ -387,6 +402,22 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRects
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::addRects(std::span<const RectF> rects, const Float4& color)
+	{
+		Vertex2DBuilder::BuildRectBatches(std::bind_front(&CRenderer2D_D3D11::createBuffer, this), rects, color, std::bind_front(&CRenderer2D_D3D11::pushShapeDraw, this));
+	}
+
+	void CRenderer2D_D3D11::addRects(std::span<const RectF> rects, std::span<const ColorF> colors)
+	{
+		Vertex2DBuilder::BuildRectBatches(std::bind_front(&CRenderer2D_D3D11::createBuffer, this), rects, colors, std::bind_front(&CRenderer2D_D3D11::pushShapeDraw, this));
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addRectFrame
@@ -499,6 +530,22 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircles
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::addCircles(std::span<const Circle> circles, const Float4& color)
+	{
+		Vertex2DBuilder::BuildCircleBatches(std::bind_front(&CRenderer2D_D3D11::createBuffer, this), circles, color, getMaxScaling(), std::bind_front(&CRenderer2D_D3D11::pushShapeDraw, this));
+	}
+
+	void CRenderer2D_D3D11::addCircles(std::span<const Circle> circles, std::span<const ColorF> colors)
+	{
+		Vertex2DBuilder::BuildCircleBatches(std::bind_front(&CRenderer2D_D3D11::createBuffer, this), circles, colors, getMaxScaling(), std::bind_front(&CRenderer2D_D3D11::pushShapeDraw, this));
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addCircleFrame
@@ -1432,6 +1479,31 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addGlyphQuads
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_D3D11::addGlyphQuads(const Texture& texture, const std::span<const GlyphQuad> glyphQuads, const Float4& color)
+	{
+		Vertex2DBuilder::BuildGlyphQuadBatches(std::bind_front(&CRenderer2D_D3D11::createBuffer, this), glyphQuads, color, [&](const Vertex2D::IndexType indexCount)
+			{
+				if (not m_currentCustomShader.vs)
+				{
+					m_commandManager.pushEngineVS(m_engineShader.vsShape);
+				}
+
+				if (not m_currentCustomShader.ps)
+				{
+					m_commandManager.pushEnginePS(m_engineShader.psTexture);
+				}
+
+				m_commandManager.pushPSTexture(0, texture);
+				m_commandManager.pushDraw(indexCount);
+			});
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addTexturedRoundRect
@@ -2143,8 +2215,23 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	Vertex2DBufferPointer CRenderer2D_D3D11::createBuffer(const uint16 vertexCount, const uint32 indexCount)
+	Vertex2DBufferPointer CRenderer2D_D3D11::createBuffer(const Vertex2D::IndexType vertexCount, const uint32 indexCount)
 	{
 		return m_vertexBufferManager2D.requestBuffer(vertexCount, indexCount, m_commandManager);
 	}
+
+	void CRenderer2D_D3D11::pushShapeDraw(const Vertex2D::IndexType indexCount)
+	{
+		if (not m_currentCustomShader.vs)
+		{
+			m_commandManager.pushEngineVS(m_engineShader.vsShape);
+		}
+
+		if (not m_currentCustomShader.ps)
+		{
+			m_commandManager.pushEnginePS(m_engineShader.psShape);
+		}
+
+		m_commandManager.pushDraw(indexCount);
+	}
 }
@@ -84,6 +84,16 @@ namespace s3d
 
 		void addRect(const FloatRect& rect, const PatternParameters& pattern) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addRects(std::span<const RectF> rects, const Float4& color) override;
+
+		void addRects(std::span<const RectF> rects, std::span<const ColorF> colors) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addRectFrame
@@ -112,6 +122,16 @@ namespace s3d
 
 		void addCircle(const Float2& center, float r, const PatternParameters& pattern) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addCircles(std::span<const Circle> circles, const Float4& color) override;
+
+		void addCircles(std::span<const Circle> circles, std::span<const ColorF> colors) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addCircleFrame
@@ -326,6 +346,14 @@ namespace s3d
 
 		void addTexturedQuad(const Texture& texture, const FloatQuad& quad, const FloatRect& uv, const Float4(&colors)[4]) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	addGlyphQuads
+		//
+		////////////////////////////////////////////////////////////////
+
+		void addGlyphQuads(const Texture& texture, std::span<const GlyphQuad> glyphQuads, const Float4& color) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	addTexturedRoundRect
@@ -594,6 +622,9 @@ namespace s3d
 
 		std::unique_ptr<Texture> m_shadowTexture;
 
-		Vertex2DBufferPointer createBuffer(uint16 vertexCount, uint32 indexCount);
+		Vertex2DBufferPointer createBuffer(Vertex2D::IndexType vertexCount, uint32 indexCount);
+
+		/// @brief 図形用のシェーダを設定し、描画コマンドを追加します。
+		void pushShapeDraw(Vertex2D::IndexType indexCount);
 	};
 }
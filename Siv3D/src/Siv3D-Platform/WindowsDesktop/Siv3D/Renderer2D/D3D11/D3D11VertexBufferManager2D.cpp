@@ -62,7 +62,7 @@ namespace s3d
 		{
 			const D3D11_BUFFER_DESC desc =
 			{
-				.ByteWidth				= (sizeof(Vertex2D) * VertexBufferSize),
+				.ByteWidth				= (sizeof(GPUVertex) * VertexBufferSize),
 				.Usage					= D3D11_USAGE_DYNAMIC,
 				.BindFlags				= D3D11_BIND_VERTEX_BUFFER,
 				.CPUAccessFlags			= D3D11_CPU_ACCESS_WRITE,
@@ -103,8 +103,14 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	Vertex2DBufferPointer D3D11VertexBufferManager2D::requestBuffer(const uint16 vertexCount, const uint32 indexCount, D3D11Renderer2DCommandManager& commandManager)
+	Vertex2DBufferPointer D3D11VertexBufferManager2D::requestBuffer(const Vertex2D::IndexType vertexCount, const uint32 indexCount, D3D11Renderer2DCommandManager& commandManager)
 	{
+		// 1 つのバッチに収まらない要求
+		if ((VertexBufferSize < vertexCount) || (IndexBufferSize < indexCount))
+		{
+			return{ nullptr, 0, 0 };
+		}
+
 		// VB
 		{
 			const uint32 vertexArrayWritePosTarget = (m_vertexArrayWritePos + vertexCount);
@@ -195,7 +201,7 @@ namespace s3d
 	void D3D11VertexBufferManager2D::setBuffers()
 	{
 		ID3D11Buffer* const pBuf[1] = { m_vertexBuffer.Get() };
-		constexpr UINT Stride = sizeof(Vertex2D);
+		constexpr UINT Stride = sizeof(GPUVertex);
 		constexpr UINT Offset = 0;
 		m_context->IASetVertexBuffers(0, 1, pBuf, &Stride, &Offset);
 
@@ -243,10 +249,15 @@ namespace s3d
 
 			if (SUCCEEDED(m_context->Map(m_vertexBuffer.Get(), 0, mapType, 0, &res)))
 			{
-				if (Vertex2D* const p = static_cast<Vertex2D*>(res.pData))
+				if (GPUVertex* const p = static_cast<GPUVertex*>(res.pData))
 				{
-					Vertex2D* const pDst = (p + m_vertexBufferWritePos);		
+					GPUVertex* const pDst = (p + m_vertexBufferWritePos);
+
+				# if SIV3D_VERTEX2D_PACKED
+					PackVertex2D(std::span{ pSrc, vertexCount }, pDst);
+				# else
 					std::memcpy(pDst, pSrc, (sizeof(Vertex2D) * vertexCount));
+				# endif
 				}
 
 				m_context->Unmap(m_vertexBuffer.Get(), 0);
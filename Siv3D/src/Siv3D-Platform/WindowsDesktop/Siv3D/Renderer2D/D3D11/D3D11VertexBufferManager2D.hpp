@@ -12,6 +12,7 @@
 # pragma once
 # include <Siv3D/Array.hpp>
 # include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Vertex2DPacked.hpp>
 # include <Siv3D/Renderer/D3D11/D3D11.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBufferPointer.hpp>
 # include "BatchInfo2D.hpp"
@@ -29,7 +30,7 @@ namespace s3d
 		bool init(ID3D11Device* device, ID3D11DeviceContext* context);
 
 		[[nodiscard]]
-		Vertex2DBufferPointer requestBuffer(uint16 vertexCount, uint32 indexCount, D3D11Renderer2DCommandManager& commandManager);
+		Vertex2DBufferPointer requestBuffer(Vertex2D::IndexType vertexCount, uint32 indexCount, D3D11Renderer2DCommandManager& commandManager);
 
 		[[nodiscard]]
 		size_t num_batches() const noexcept;
@@ -49,8 +50,19 @@ namespace s3d
 		static constexpr uint32 MaxVertexArraySize		= (1 << 22);	// 4,194,304
 		static constexpr uint32 MaxIndexArraySize		= (1 << 22);	// 4,194,304
 
-		static constexpr uint32 VertexBufferSize		= 65535;
-		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 262,144
+		static constexpr uint32 VertexBufferSize		= Vertex2D::MaxBatchVertexCount;
+		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 262,144 (16-bit index)
+
+		static_assert(Vertex2D::MaxBatchIndexCount <= IndexBufferSize);
+
+		/// @brief GPU の頂点バッファに格納する頂点の型
+	# if (SIV3D_VERTEX2D_PACKED == 2)
+		using GPUVertex = Vertex2DPackedHalf;
+	# elif (SIV3D_VERTEX2D_PACKED == 1)
+		using GPUVertex = Vertex2DPacked;
+	# else
+		using GPUVertex = Vertex2D;
+	# endif
 
 		struct BatchBufferPos
 		{
@@ -59,4 +59,19 @@ namespace s3d
 	{
 		return m_detail->ostream();
 	}
+
+	Optional<size_t> ChildProcess::ChildProcessDetail::tryRead(void* dst, const size_t size)
+	{
+		return m_detail->tryRead(dst, size);
+	}
+
+	Optional<size_t> ChildProcess::ChildProcessDetail::tryWrite(const void* src, const size_t size)
+	{
+		return m_detail->tryWrite(src, size);
+	}
+
+	void ChildProcess::ChildProcessDetail::closeStdIn()
+	{
+		m_detail->closeStdIn();
+	}
 }
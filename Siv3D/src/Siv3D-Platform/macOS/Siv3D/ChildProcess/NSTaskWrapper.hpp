@@ -57,6 +57,12 @@ namespace s3d
 		
 		std::ostream& ostream();
 		
+		Optional<size_t> tryRead(void* dst, size_t size);
+		
+		Optional<size_t> tryWrite(const void* src, size_t size);
+		
+		void closeStdIn();
+		
 	private:
 		
 		NSTask* m_task = nullptr;
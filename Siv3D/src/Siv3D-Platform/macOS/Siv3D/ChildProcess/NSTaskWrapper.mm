@@ -9,6 +9,9 @@
 //
 //-----------------------------------------------
 
+# include <unistd.h>
+# include <fcntl.h>
+# include <cerrno>
 # include <Foundation/Foundation.h>
 # include "NSTaskWrapper.hpp"
 
@@ -142,4 +145,63 @@ namespace s3d
 	{
 		return m_os;
 	}
+	
+	Optional<size_t> NSTaskWrapper::tryRead(void* dst, const size_t size)
+	{
+		if ((not isValid()) || (not m_readHandle))
+		{
+			return none;
+		}
+		
+		const int fd = [m_readHandle fileDescriptor];
+		::fcntl(fd, F_SETFL, (::fcntl(fd, F_GETFL) | O_NONBLOCK));
+		
+		const ssize_t result = ::read(fd, dst, size);
+		
+		if (0 < result)
+		{
+			return static_cast<size_t>(result);
+		}
+		else if ((result == -1) && ((errno == EAGAIN) || (errno == EINTR)))
+		{
+			return 0;
+		}
+		
+		return none;
+	}
+	
+	Optional<size_t> NSTaskWrapper::tryWrite(const void* src, const size_t size)
+	{
+		if ((not isValid()) || (not m_writeHandle))
+		{
+			return none;
+		}
+		
+		const int fd = [m_writeHandle fileDescriptor];
+		::fcntl(fd, F_SETFL, (::fcntl(fd, F_GETFL) | O_NONBLOCK));
+		::fcntl(fd, F_SETNOSIGPIPE, 1);
+		
+		const ssize_t result = ::write(fd, src, size);
+		
+		if (0 <= result)
+		{
+			return static_cast<size_t>(result);
+		}
+		else if ((errno == EAGAIN) || (errno == EINTR))
+		{
+			return 0;
+		}
+		
+		return none;
+	}
+	
+	void NSTaskWrapper::closeStdIn()
+	{
+		if (m_writeHandle)
+		{
+			[m_writeHandle closeFile];
+			m_writeHandle = nullptr;
+			m_os.setWriteHandle(nullptr);
+		}
+	}
 }
@@ -0,0 +1,155 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <dirent.h>
+# include <ctime>
+# include <Siv3D/DirectoryEntry.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/DirectoryWalker/DirectoryWalkerDetail.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		[[nodiscard]]
+		static DirectoryEntryType FromDType(const uint8 type) noexcept
+		{
+			switch (type)
+			{
+			case DT_REG:
+				return DirectoryEntryType::File;
+			case DT_DIR:
+				return DirectoryEntryType::Directory;
+			case DT_LNK:
+				return DirectoryEntryType::SymbolicLink;
+			default:
+				return DirectoryEntryType::Other;
+			}
+		}
+
+		[[nodiscard]]
+		static DirectoryEntryType FromMode(const mode_t mode) noexcept
+		{
+			if (S_ISREG(mode))
+			{
+				return DirectoryEntryType::File;
+			}
+			else if (S_ISDIR(mode))
+			{
+				return DirectoryEntryType::Directory;
+			}
+			else if (S_ISLNK(mode))
+			{
+				return DirectoryEntryType::SymbolicLink;
+			}
+			else
+			{
+				return DirectoryEntryType::Other;
+			}
+		}
+
+		[[nodiscard]]
+		static constexpr bool IsCurrentOrParentDirectory(const char* name) noexcept
+		{
+			return ((name[0] == '.')
+				&& ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0'))));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	DirectoryEntry::writeTime
+	//
+	////////////////////////////////////////////////////////////////
+
+	DateTime DirectoryEntry::writeTime() const
+	{
+		const ::time_t seconds = static_cast<::time_t>(writeTimeNs / 1'000'000'000);
+		const int32 milliseconds = static_cast<int32>((writeTimeNs % 1'000'000'000) / 1'000'000);
+
+		::tm lt;
+		::localtime_r(&seconds, &lt);
+		return{ (1900 + lt.tm_year),
+				(1 + lt.tm_mon),
+				(lt.tm_mday),
+				lt.tm_hour,
+				lt.tm_min,
+				lt.tm_sec,
+				milliseconds };
+	}
+
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	ReadDirectory
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ReadDirectory(const FilePath& directory, const bool fetchMetadata, const FunctionRef<bool(DirectoryEntry&&)> f)
+		{
+			DIR* dir = ::opendir(directory.toUTF8().c_str());
+
+			if (not dir)
+			{
+				return;
+			}
+
+			const int32 fd = ::dirfd(dir);
+
+			while (const dirent* d = ::readdir(dir))
+			{
+				if (IsCurrentOrParentDirectory(d->d_name))
+				{
+					continue;
+				}
+
+				DirectoryEntry entry{ .type = FromDType(d->d_type) };
+
+				if (fetchMetadata || (d->d_type == DT_UNKNOWN))
+				{
+					struct stat s;
+
+					// ディレクトリの fd からの相対パスで問い合わせることで、パスの解決を省略する
+					if (::fstatat(fd, d->d_name, &s, AT_SYMLINK_NOFOLLOW) != 0)
+					{
+						// 列挙中に削除された
+						continue;
+					}
+
+					entry.type = FromMode(s.st_mode);
+
+					if (fetchMetadata)
+					{
+						entry.size = (entry.isFile() ? static_cast<uint64>(s.st_size) : 0);
+						entry.writeTimeNs = ((static_cast<int64>(s.st_mtimespec.tv_sec) * 1'000'000'000) + s.st_mtimespec.tv_nsec);
+					}
+				}
+
+				entry.path = (directory + Unicode::FromUTF8(d->d_name));
+
+				if (entry.isDirectory())
+				{
+					entry.path.push_back(U'/');
+				}
+
+				if (not f(std::move(entry)))
+				{
+					break;
+				}
+			}
+
+			::closedir(dir);
+		}
+	}
+}
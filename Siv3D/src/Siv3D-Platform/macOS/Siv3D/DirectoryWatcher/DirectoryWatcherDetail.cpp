@@ -58,7 +58,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions)
+	bool DirectoryWatcher::DirectoryWatcherDetail::start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& debounceTime)
 	{
 		if (directory.isEmpty()
 			|| (not FileSystem::IsDirectory(directory)))
@@ -69,6 +69,7 @@ namespace s3d
 
 		m_directory = FileSystem::FullPath(directory);
 		m_extensionFilter.set(applicableExtensions);
+		m_fileChanges.setDebounceTime(debounceTime);
 
 		CFStringRef fullPath = CFStringCreateWithBytes(kCFAllocatorDefault,
 													   reinterpret_cast<const uint8*>(m_directory.c_str()),
@@ -134,11 +135,7 @@ namespace s3d
 
 	void DirectoryWatcher::DirectoryWatcherDetail::extractChanges(Array<FileChange>& fileChanges)
 	{
-		std::lock_guard lock{ m_fileChanges.mutex };
-
-		fileChanges.assign(m_fileChanges.fileChanges.begin(), m_fileChanges.fileChanges.end());
-
-		m_fileChanges.fileChanges.clear();
+		m_fileChanges.extract(fileChanges);
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -149,9 +146,7 @@ namespace s3d
 
 	void DirectoryWatcher::DirectoryWatcherDetail::clearChanges()
 	{
-		std::lock_guard lock{ m_fileChanges.mutex };
-
-		m_fileChanges.fileChanges.clear();
+		m_fileChanges.clear();
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -192,8 +187,6 @@ namespace s3d
 		char32_t buffer[2048];
 		CFArrayRef eventPathArray = (CFArrayRef)paths;
 		
-		std::lock_guard lock{ m_fileChanges.mutex };
-		
 		for (size_t i = 0; i < eventCount; ++i)
 		{
 			const FSEventStreamEventFlags flag = flags[i];
@@ -259,12 +252,12 @@ namespace s3d
 			{
 				if (m_extensionFilter.includes(FileSystem::Extension(fullPath)))
 				{
-					m_fileChanges.fileChanges.push_back({ std::move(fullPath), action });
+					m_fileChanges.add(std::move(fullPath), action);
 				}
 			}
 			else
 			{
-				m_fileChanges.fileChanges.push_back({ std::move(fullPath), action });
+				m_fileChanges.add(std::move(fullPath), action);
 			}
 		}
 	}
@@ -9,9 +9,10 @@
 //
 //-----------------------------------------------
 
-# include <mutex>
+# include <atomic>
 # include <Siv3D/DirectoryWatcher.hpp>
 # include <Siv3D/ExtensionFilter/ExtensionFilter.hpp>
+# include <Siv3D/DirectoryWatcher/FileChangeCoalescer.hpp>
 # include <CoreServices/CoreServices.h>
 
 namespace s3d
@@ -42,7 +43,7 @@ namespace s3d
 		//
 		////////////////////////////////////////////////////////////////
 
-		bool start(const FilePathView directory, const Array<String>& applicableExtensions);
+		bool start(const FilePathView directory, const Array<String>& applicableExtensions, const Duration& debounceTime);
 
 		////////////////////////////////////////////////////////////////
 		//
@@ -97,13 +98,7 @@ namespace s3d
 		
 		std::atomic<bool> m_abort = false;
 
-		struct FileChanges
-		{
-			std::mutex mutex;
-
-			Array<FileChange> fileChanges;
-		
-		} m_fileChanges;
+		FileChangeCoalescer m_fileChanges;
 		
 		void onFileChange(const size_t eventCount, void* paths, const FSEventStreamEventFlags flags[]);
 		
@@ -17,6 +17,7 @@
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/GlyphQuad.hpp>
 # include <Siv3D/Pattern/PatternParameters.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
 # include <Siv3D/Error/InternalEngineError.hpp>
@@ -374,6 +375,22 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addRects
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::addRects(std::span<const RectF> rects, const Float4& color)
+	{
+		Vertex2DBuilder::BuildRectBatches(std::bind_front(&CRenderer2D_Metal::createBuffer, this), rects, color, std::bind_front(&CRenderer2D_Metal::pushShapeDraw, this));
+	}
+
+	void CRenderer2D_Metal::addRects(std::span<const RectF> rects, std::span<const ColorF> colors)
+	{
+		Vertex2DBuilder::BuildRectBatches(std::bind_front(&CRenderer2D_Metal::createBuffer, this), rects, colors, std::bind_front(&CRenderer2D_Metal::pushShapeDraw, this));
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addRectFrame
@@ -486,6 +503,22 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addCircles
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::addCircles(std::span<const Circle> circles, const Float4& color)
+	{
+		Vertex2DBuilder::BuildCircleBatches(std::bind_front(&CRenderer2D_Metal::createBuffer, this), circles, color, getMaxScaling(), std::bind_front(&CRenderer2D_Metal::pushShapeDraw, this));
+	}
+
+	void CRenderer2D_Metal::addCircles(std::span<const Circle> circles, std::span<const ColorF> colors)
+	{
+		Vertex2DBuilder::BuildCircleBatches(std::bind_front(&CRenderer2D_Metal::createBuffer, this), circles, colors, getMaxScaling(), std::bind_front(&CRenderer2D_Metal::pushShapeDraw, this));
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addCircleFrame
@@ -1417,6 +1450,31 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addGlyphQuads
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CRenderer2D_Metal::addGlyphQuads(const Texture& texture, const std::span<const GlyphQuad> glyphQuads, const Float4& color)
+	{
+		Vertex2DBuilder::BuildGlyphQuadBatches(std::bind_front(&CRenderer2D_Metal::createBuffer, this), glyphQuads, color, [&](const Vertex2D::IndexType indexCount)
+			{
+				if (not m_currentCustomShader.vs)
+				{
+					m_commandManager.pushEngineVS(m_engineShader.vsShape);
+				}
+
+				if (not m_currentCustomShader.ps)
+				{
+					m_commandManager.pushEnginePS(m_engineShader.psTexture);
+				}
+
+				m_commandManager.pushPSTexture(0, texture);
+				m_commandManager.pushDraw(indexCount);
+			});
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	addTexturedRoundRect
@@ -1674,7 +1732,8 @@ namespace s3d
 						LOG_COMMAND(fmt::format("Draw[{}] indexCount = {}, startIndexLocation = {}", command.index, indexCount, commandState.startIndexLocation));
 						
 						// indexBufferOffset, 4 の倍数でなくても大丈夫？
-						renderCommandEncoder->drawIndexedPrimitives(MTL::PrimitiveType::PrimitiveTypeTriangle, indexCount, MTL::IndexTypeUInt16, m_vertexBufferManager.getIndexBuffer(), (sizeof(Vertex2D::IndexType) * commandState.startIndexLocation));
+						constexpr MTL::IndexType IndexType = ((sizeof(Vertex2D::IndexType) == 2) ? MTL::IndexTypeUInt16 : MTL::IndexTypeUInt32);
+						renderCommandEncoder->drawIndexedPrimitives(MTL::PrimitiveType::PrimitiveTypeTriangle, indexCount, IndexType, m_vertexBufferManager.getIndexBuffer(), (sizeof(Vertex2D::IndexType) * commandState.startIndexLocation));
 						commandState.startIndexLocation += indexCount;
 						
 						++stat.drawCalls;
@@ -2195,8 +2254,23 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	Vertex2DBufferPointer CRenderer2D_Metal::createBuffer(const uint16 vertexCount, const uint32 indexCount)
+	Vertex2DBufferPointer CRenderer2D_Metal::createBuffer(const Vertex2D::IndexType vertexCount, const uint32 indexCount)
 	{
 		return m_vertexBufferManager.requestBuffer(vertexCount, indexCount);
 	}
+
+	void CRenderer2D_Metal::pushShapeDraw(const Vertex2D::IndexType indexCount)
+	{
+		if (not m_currentCustomShader.vs)
+		{
+			m_commandManager.pushEngineVS(m_engineShader.vsShape);
+		}
+
+		if (not m_currentCustomShader.ps)
+		{
+			m_commandManager.pushEnginePS(m_engineShader.psShape);
+		}
+
+		m_commandManager.pushDraw(indexCount);
+	}
 }
@@ -44,7 +44,7 @@ namespace s3d
 			return m_buffers[m_bufferIndex].indexBuffer.buffer.get();
 		}
 
-		Vertex2DBufferPointer requestBuffer(uint16 vertexCount, uint32 indexCount);
+		Vertex2DBufferPointer requestBuffer(Vertex2D::IndexType vertexCount, uint32 indexCount);
 		
 		bool hasBatch() const noexcept;
 		
@@ -60,7 +60,11 @@ namespace s3d
 		
 		static constexpr uint32 MaxIndexBufferSize		= (1 << 22);	// 4,194,304
 		
-		static constexpr uint32 MaxVertexCountPerDraw	= 65535;
+		static constexpr uint32 MaxVertexCountPerDraw	= Vertex2D::MaxBatchVertexCount;
+
+		static constexpr uint32 MaxIndexCountPerDraw	= Vertex2D::MaxBatchIndexCount;
+
+		static_assert((MaxVertexCountPerDraw <= MaxVertexBufferSize) && (MaxIndexCountPerDraw <= MaxIndexBufferSize));
 		
 		struct VertexBuffer
 		{
@@ -128,7 +132,7 @@ namespace s3d
 			
 			IndexBuffer indexBuffer;
 			
-			Vertex2DBufferPointer requestBuffer(MTL::Device* device, uint16 vertexCount, uint32 indexCount);
+			Vertex2DBufferPointer requestBuffer(MTL::Device* device, Vertex2D::IndexType vertexCount, uint32 indexCount);
 		};
 		
 		MTL::Device* m_device = nullptr;
@@ -50,7 +50,7 @@ namespace s3d
 		m_buffers[m_bufferIndex].indexBuffer.writePos	= 0;
 	}
 
-	Vertex2DBufferPointer MetalVertexBufferManager2D::requestBuffer(const uint16 vertexCount, const uint32 indexCount)
+	Vertex2DBufferPointer MetalVertexBufferManager2D::requestBuffer(const Vertex2D::IndexType vertexCount, const uint32 indexCount)
 	{
 		return m_buffers[m_bufferIndex].requestBuffer(m_device, vertexCount, indexCount);
 	}
@@ -65,7 +65,7 @@ namespace s3d
 		return m_buffers[m_bufferIndex].indexBuffer.writePos;
 	}
 
-	Vertex2DBufferPointer MetalVertexBufferManager2D::Buffer::requestBuffer(MTL::Device* device, const uint16 vertexCount, const uint32 indexCount)
+	Vertex2DBufferPointer MetalVertexBufferManager2D::Buffer::requestBuffer(MTL::Device* device, const Vertex2D::IndexType vertexCount, const uint32 indexCount)
 	{
 		// VB
 		{
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include "CSystem.hpp"
+# include <Siv3D/Engine/EngineInitializer.hpp>
 # include <Siv3D/LicenseManager/ILicenseManager.hpp>
 # include <Siv3D/RegExp/IRegExp.hpp>
 # include <Siv3D/EngineResource/IEngineResource.hpp>
@@ -65,31 +66,35 @@ namespace s3d
 		SIV3D_ENGINE(EngineResource)->init();
 		SIV3D_ENGINE(Profiler)->init();
 		SIV3D_ENGINE(Window)->init();
-		SIV3D_ENGINE(MediaTranscoder)->init();
-		SIV3D_ENGINE(ImageDecoder)->init();
-		SIV3D_ENGINE(ImageEncoder)->init();
-		SIV3D_ENGINE(PDFRenderer)->init();
-		SIV3D_ENGINE(AudioDecoder)->init();
-		SIV3D_ENGINE(AudioEncoder)->init();
-		SIV3D_ENGINE(Cursor)->init();
-		SIV3D_ENGINE(CursorStyle)->init();
-		SIV3D_ENGINE(Keyboard)->init();
-		SIV3D_ENGINE(Mouse)->init();
-		SIV3D_ENGINE(Clipboard)->init();
-		SIV3D_ENGINE(DragDrop)->init();
-		SIV3D_ENGINE(Audio)->init();
-		SIV3D_ENGINE(Renderer)->init();
-		SIV3D_ENGINE(Renderer2D)->init();
-		SIV3D_ENGINE(ScreenCapture)->init();
-		SIV3D_ENGINE(Font)->init();
-		SIV3D_ENGINE(Emoji)->init();
-		SIV3D_ENGINE(Icon)->init();
-		SIV3D_ENGINE(GUI)->init();
-		SIV3D_ENGINE(Print)->init();
-		SIV3D_ENGINE(Effect)->init();
-		SIV3D_ENGINE(TextToSpeech)->init();
-		SIV3D_ENGINE(NativeShare)->init();
-		SIV3D_ENGINE(Notifications)->init();
+
+		// 他のコンポーネントやメインスレッドに依存しないコンポーネントは、ワーカースレッドで並行して初期化する
+		EngineInitializer initializer;
+		initializer.add("MediaTranscoder", []() { SIV3D_ENGINE(MediaTranscoder)->init(); });
+		const auto imageDecoder = initializer.addAsync("ImageDecoder", []() { SIV3D_ENGINE(ImageDecoder)->init(); });
+		initializer.addAsync("ImageEncoder", []() { SIV3D_ENGINE(ImageEncoder)->init(); });
+		initializer.addAsync("PDFRenderer", []() { SIV3D_ENGINE(PDFRenderer)->init(); });
+		initializer.addAsync("AudioDecoder", []() { SIV3D_ENGINE(AudioDecoder)->init(); });
+		initializer.addAsync("AudioEncoder", []() { SIV3D_ENGINE(AudioEncoder)->init(); });
+		initializer.add("Cursor", []() { SIV3D_ENGINE(Cursor)->init(); });
+		initializer.add("CursorStyle", []() { SIV3D_ENGINE(CursorStyle)->init(); });
+		initializer.add("Keyboard", []() { SIV3D_ENGINE(Keyboard)->init(); });
+		initializer.add("Mouse", []() { SIV3D_ENGINE(Mouse)->init(); });
+		initializer.add("Clipboard", []() { SIV3D_ENGINE(Clipboard)->init(); });
+		initializer.add("DragDrop", []() { SIV3D_ENGINE(DragDrop)->init(); });
+		initializer.add("Audio", []() { SIV3D_ENGINE(Audio)->init(); });
+		initializer.add("Renderer", []() { SIV3D_ENGINE(Renderer)->init(); }, { imageDecoder });
+		initializer.add("Renderer2D", []() { SIV3D_ENGINE(Renderer2D)->init(); }, { imageDecoder });
+		initializer.add("ScreenCapture", []() { SIV3D_ENGINE(ScreenCapture)->init(); });
+		const auto font = initializer.add("Font", []() { SIV3D_ENGINE(Font)->init(); });
+		const auto emoji = initializer.addAsync("Emoji", []() { SIV3D_ENGINE(Emoji)->init(); }, { font });
+		const auto icon = initializer.addAsync("Icon", []() { SIV3D_ENGINE(Icon)->init(); }, { font });
+		initializer.add("GUI", []() { SIV3D_ENGINE(GUI)->init(); }, { emoji, icon });
+		initializer.add("Print", []() { SIV3D_ENGINE(Print)->init(); }, { emoji, icon });
+		initializer.add("Effect", []() { SIV3D_ENGINE(Effect)->init(); });
+		initializer.add("TextToSpeech", []() { SIV3D_ENGINE(TextToSpeech)->init(); });
+		initializer.add("NativeShare", []() { SIV3D_ENGINE(NativeShare)->init(); });
+		initializer.add("Notifications", []() { SIV3D_ENGINE(Notifications)->init(); });
+		initializer.run();
 
 		LOG_INFO("✅ Siv3D engine has initialized");
 	}
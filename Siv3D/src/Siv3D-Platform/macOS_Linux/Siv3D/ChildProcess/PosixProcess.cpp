@@ -0,0 +1,516 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <unistd.h>
+# include <fcntl.h>
+# include <signal.h>
+# include <spawn.h>
+# include <sys/wait.h>
+# include <cerrno>
+# include <pthread.h>
+# include <mutex>
+# include <thread>
+# include <vector>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "PosixProcess.hpp"
+
+extern char** environ;
+
+namespace s3d
+{
+	namespace
+	{
+		static bool MakePipe(int (&fds)[2])
+		{
+		# if SIV3D_PLATFORM(LINUX)
+
+			return (::pipe2(fds, O_CLOEXEC) == 0);
+
+		# else
+
+			if (::pipe(fds) != 0)
+			{
+				return false;
+			}
+
+			::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+			::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+			return true;
+
+		# endif
+		}
+
+		static void CloseFD(int32& fd) noexcept
+		{
+			if (fd != -1)
+			{
+				::close(fd);
+				fd = -1;
+			}
+		}
+
+		static void SetNonBlocking(const int32 fd) noexcept
+		{
+			::fcntl(fd, F_SETFL, (::fcntl(fd, F_GETFL) | O_NONBLOCK));
+		}
+
+		/// @brief 子プロセスが標準入力を閉じていても SIGPIPE を発生させずに書き込みます。
+		[[nodiscard]]
+		static ssize_t WriteWithoutSigPipe(const int32 fd, const void* src, const size_t size) noexcept
+		{
+		# if defined(F_SETNOSIGPIPE)
+
+			// ファイルディスクリプタに F_SETNOSIGPIPE を設定済み
+			return ::write(fd, src, size);
+
+		# else
+
+			sigset_t sigPipeMask;
+			::sigemptyset(&sigPipeMask);
+			::sigaddset(&sigPipeMask, SIGPIPE);
+
+			sigset_t oldMask;
+			::pthread_sigmask(SIG_BLOCK, &sigPipeMask, &oldMask);
+
+			// すでに保留中の SIGPIPE は消費しないようにする
+			sigset_t pending;
+			::sigpending(&pending);
+			const bool alreadyPending = (::sigismember(&pending, SIGPIPE) == 1);
+
+			const ssize_t result = ::write(fd, src, size);
+
+			if ((result == -1) && (errno == EPIPE) && (not alreadyPending))
+			{
+				const int savedErrno = errno;
+				const timespec zero{};
+				::sigtimedwait(&sigPipeMask, nullptr, &zero);
+				errno = savedErrno;
+			}
+
+			::pthread_sigmask(SIG_SETMASK, &oldMask, nullptr);
+
+			return result;
+
+		# endif
+		}
+
+		/// @brief 切り離した子プロセスの終了を確認する間隔
+		constexpr auto DetachedChildPollInterval = std::chrono::milliseconds{ 100 };
+
+		/// @brief 切り離した実行中の子プロセスの一覧
+		struct DetachedChildren
+		{
+			std::mutex mutex;
+
+			std::vector<pid_t> pids;
+
+			/// @brief 回収用のスレッドが動いているか
+			bool reaperRunning = false;
+		};
+
+		[[nodiscard]]
+		static DetachedChildren& GetDetachedChildren()
+		{
+			// 回収用のスレッドが終了時の破棄と競合しないよう、意図的に破棄しない
+			static DetachedChildren* const detachedChildren = new DetachedChildren;
+			return *detachedChildren;
+		}
+
+		/// @brief 終了した子プロセスを回収し、一覧から取り除きます。`mutex` をロックした状態で呼んでください。
+		static void ReapExitedChildren(std::vector<pid_t>& pids) noexcept
+		{
+			std::erase_if(pids, [](const pid_t pid)
+				{
+					int status = 0;
+					pid_t result;
+
+					do
+					{
+						result = ::waitpid(pid, &status, WNOHANG);
+					} while ((result == -1) && (errno == EINTR));
+
+					// 回収済み、またはすでに存在しない（ECHILD）場合は取り除く
+					return (result != 0);
+				});
+		}
+
+		/// @brief 切り離した子プロセスがすべて回収されるまで、一定間隔で終了を確認します。
+		static void RunReaper()
+		{
+			DetachedChildren& children = GetDetachedChildren();
+
+			for (;;)
+			{
+				{
+					std::lock_guard lock{ children.mutex };
+
+					ReapExitedChildren(children.pids);
+
+					if (children.pids.empty())
+					{
+						children.reaperRunning = false;
+						return;
+					}
+				}
+
+				std::this_thread::sleep_for(DetachedChildPollInterval);
+			}
+		}
+
+		/// @brief 実行中の子プロセスを切り離し、終了したときにゾンビにならないよう回収用のスレッドに任せます。
+		/// @remark 回収用のスレッドは、切り離した子プロセスの数によらず 1 つです。子プロセスを終了させることはありません。
+		static void ReapInBackground(const pid_t pid) noexcept
+		{
+			DetachedChildren& children = GetDetachedChildren();
+
+			std::lock_guard lock{ children.mutex };
+
+			ReapExitedChildren(children.pids);
+
+			try
+			{
+				children.pids.push_back(pid);
+
+				if (not children.reaperRunning)
+				{
+					std::thread{ RunReaper }.detach();
+					children.reaperRunning = true;
+				}
+			}
+			catch (...)
+			{
+				// スレッドを作成できない場合は一覧に残しておき、次に子プロセスを切り離すときに回収を試みる
+			}
+		}
+	}
+
+	PosixProcess::PosixProcess(PosixProcess&& other) noexcept
+		: m_pid{ std::exchange(other.m_pid, -1) }
+		, m_readFD{ std::exchange(other.m_readFD, -1) }
+		, m_writeFD{ std::exchange(other.m_writeFD, -1) }
+		, m_exitCode{ std::exchange(other.m_exitCode, none) } {}
+
+	PosixProcess::~PosixProcess()
+	{
+		release();
+	}
+
+	PosixProcess& PosixProcess::operator =(PosixProcess&& other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			m_pid		= std::exchange(other.m_pid, -1);
+			m_readFD	= std::exchange(other.m_readFD, -1);
+			m_writeFD	= std::exchange(other.m_writeFD, -1);
+			m_exitCode	= std::exchange(other.m_exitCode, none);
+		}
+
+		return *this;
+	}
+
+	bool PosixProcess::spawn(const FilePathView path, const Array<String>& commands, const Pipe pipe)
+	{
+		release();
+
+		const std::string pathUTF8 = Unicode::ToUTF8(path);
+
+		std::vector<std::string> args;
+		args.reserve(commands.size() + 1);
+		args.push_back(pathUTF8);
+
+		for (const auto& command : commands)
+		{
+			args.push_back(command.toUTF8());
+		}
+
+		std::vector<char*> argv;
+		argv.reserve(args.size() + 1);
+
+		for (auto& arg : args)
+		{
+			argv.push_back(arg.data());
+		}
+
+		argv.push_back(nullptr);
+
+		// Pipe::StdIn: 子プロセスの標準出力を読み込む, Pipe::StdOut: 子プロセスの標準入力に書き込む
+		const bool readOutput = ((pipe == Pipe::StdIn) || (pipe == Pipe::StdInOut));
+		const bool writeInput = ((pipe == Pipe::StdOut) || (pipe == Pipe::StdInOut));
+
+		int outputPipe[2] = { -1, -1 };
+		int inputPipe[2] = { -1, -1 };
+
+		if ((readOutput && (not MakePipe(outputPipe)))
+			|| (writeInput && (not MakePipe(inputPipe))))
+		{
+			LOG_FAIL("❌ PosixProcess::spawn(): Failed to create a pipe");
+			CloseFD(outputPipe[0]);
+			CloseFD(outputPipe[1]);
+			return false;
+		}
+
+		posix_spawn_file_actions_t actions;
+		::posix_spawn_file_actions_init(&actions);
+
+		// パイプはすべて O_CLOEXEC なので、dup2 した標準入出力以外は子プロセスでは閉じられる
+		if (readOutput)
+		{
+			::posix_spawn_file_actions_adddup2(&actions, outputPipe[1], STDOUT_FILENO);
+		}
+
+		if (writeInput)
+		{
+			::posix_spawn_file_actions_adddup2(&actions, inputPipe[0], STDIN_FILENO);
+		}
+
+		// 親プロセスのシグナルマスクや SIGPIPE の設定を引き継がない
+		posix_spawnattr_t attributes;
+		::posix_spawnattr_init(&attributes);
+		{
+			sigset_t defaultSignals;
+			::sigemptyset(&defaultSignals);
+			::sigaddset(&defaultSignals, SIGPIPE);
+			::posix_spawnattr_setsigdefault(&attributes, &defaultSignals);
+
+			sigset_t emptyMask;
+			::sigemptyset(&emptyMask);
+			::posix_spawnattr_setsigmask(&attributes, &emptyMask);
+
+			::posix_spawnattr_setflags(&attributes, (POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK));
+		}
+
+		pid_t pid = -1;
+		const int result = (FileSystem::Exists(path)
+			? ::posix_spawn(&pid, pathUTF8.c_str(), &actions, &attributes, argv.data(), environ)
+			: ::posix_spawnp(&pid, pathUTF8.c_str(), &actions, &attributes, argv.data(), environ));
+
+		::posix_spawnattr_destroy(&attributes);
+		::posix_spawn_file_actions_destroy(&actions);
+
+		// 子プロセス側の端を閉じる
+		CloseFD(outputPipe[1]);
+		CloseFD(inputPipe[0]);
+
+		if (result != 0)
+		{
+			LOG_FAIL(fmt::format("❌ PosixProcess::spawn(): Failed to spawn `{}` (error: {})", pathUTF8, result));
+			CloseFD(outputPipe[0]);
+			CloseFD(inputPipe[1]);
+			return false;
+		}
+
+		if (outputPipe[0] != -1)
+		{
+			SetNonBlocking(outputPipe[0]);
+		}
+
+		if (inputPipe[1] != -1)
+		{
+			SetNonBlocking(inputPipe[1]);
+
+		# if defined(F_SETNOSIGPIPE)
+			::fcntl(inputPipe[1], F_SETNOSIGPIPE, 1);
+		# endif
+		}
+
+		m_pid		= pid;
+		m_readFD	= outputPipe[0];
+		m_writeFD	= inputPipe[1];
+		m_exitCode.reset();
+
+		return true;
+	}
+
+	bool PosixProcess::isValid() const noexcept
+	{
+		return (m_pid != -1);
+	}
+
+	bool PosixProcess::isRunning()
+	{
+		reap(false);
+		return (isValid() && (not m_exitCode));
+	}
+
+	void PosixProcess::wait()
+	{
+		reap(true);
+	}
+
+	void PosixProcess::terminate()
+	{
+		if ((not isValid()) || m_exitCode)
+		{
+			return;
+		}
+
+		::kill(m_pid, SIGKILL);
+		reap(true);
+	}
+
+	Optional<int32> PosixProcess::getExitCode()
+	{
+		reap(false);
+		return m_exitCode;
+	}
+
+	Optional<size_t> PosixProcess::tryRead(void* dst, const size_t size)
+	{
+		if (m_readFD == -1)
+		{
+			return none;
+		}
+
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		for (;;)
+		{
+			const ssize_t result = ::read(m_readFD, dst, size);
+
+			if (0 < result)
+			{
+				return static_cast<size_t>(result);
+			}
+			else if (result == 0)
+			{
+				return none; // EOF
+			}
+			else if (errno == EINTR)
+			{
+				continue;
+			}
+			else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+			{
+				return 0;
+			}
+			else
+			{
+				return none;
+			}
+		}
+	}
+
+	Optional<size_t> PosixProcess::tryWrite(const void* src, const size_t size)
+	{
+		if (m_writeFD == -1)
+		{
+			return none;
+		}
+
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		for (;;)
+		{
+			const ssize_t result = WriteWithoutSigPipe(m_writeFD, src, size);
+
+			if (0 <= result)
+			{
+				return static_cast<size_t>(result);
+			}
+			else if (errno == EINTR)
+			{
+				continue;
+			}
+			else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+			{
+				return 0;
+			}
+			else
+			{
+				return none;
+			}
+		}
+	}
+
+	void PosixProcess::closeStdIn()
+	{
+		CloseFD(m_writeFD);
+	}
+
+	void PosixProcess::closeStdOut()
+	{
+		CloseFD(m_readFD);
+	}
+
+	int32 PosixProcess::readFD() const noexcept
+	{
+		return m_readFD;
+	}
+
+	int32 PosixProcess::writeFD() const noexcept
+	{
+		return m_writeFD;
+	}
+
+	void PosixProcess::reap(const bool block)
+	{
+		if ((not isValid()) || m_exitCode)
+		{
+			return;
+		}
+
+		int status = 0;
+		pid_t result;
+
+		do
+		{
+			result = ::waitpid(m_pid, &status, (block ? 0 : WNOHANG));
+		} while ((result == -1) && (errno == EINTR));
+
+		if (result == m_pid)
+		{
+			if (WIFEXITED(status))
+			{
+				m_exitCode = WEXITSTATUS(status);
+			}
+			else if (WIFSIGNALED(status))
+			{
+				// シェルと同様に 128 + シグナル番号とする
+				m_exitCode = (128 + WTERMSIG(status));
+			}
+		}
+		else if (result == -1)
+		{
+			// すでに回収されている（ECHILD）
+			m_exitCode = -1;
+		}
+	}
+
+	void PosixProcess::release() noexcept
+	{
+		CloseFD(m_readFD);
+		CloseFD(m_writeFD);
+
+		if (isValid())
+		{
+			// 終了済みであれば回収する。実行中の場合は切り離し、終了後に回収用のスレッドで回収する
+			reap(false);
+
+			if (not m_exitCode)
+			{
+				ReapInBackground(m_pid);
+			}
+		}
+
+		m_pid = -1;
+		m_exitCode.reset();
+	}
+}
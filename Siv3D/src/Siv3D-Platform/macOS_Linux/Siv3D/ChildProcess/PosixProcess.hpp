@@ -0,0 +1,102 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <sys/types.h>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Pipe.hpp>
+
+namespace s3d
+{
+	/// @brief posix_spawn で起動した子プロセスと、そのパイプ（親プロセス側はノンブロッキング）
+	class PosixProcess
+	{
+	public:
+
+		[[nodiscard]]
+		PosixProcess() = default;
+
+		PosixProcess(const PosixProcess&) = delete;
+
+		[[nodiscard]]
+		PosixProcess(PosixProcess&& other) noexcept;
+
+		~PosixProcess();
+
+		PosixProcess& operator =(const PosixProcess&) = delete;
+
+		PosixProcess& operator =(PosixProcess&& other) noexcept;
+
+		/// @brief 子プロセスを起動します。
+		/// @param path 実行するプログラムのパス。存在しない場合は PATH から検索します。
+		/// @param commands コマンド引数
+		/// @param pipe パイプ通信の設定
+		/// @return 起動に成功した場合 true, それ以外の場合は false
+		bool spawn(FilePathView path, const Array<String>& commands, Pipe pipe);
+
+		[[nodiscard]]
+		bool isValid() const noexcept;
+
+		[[nodiscard]]
+		bool isRunning();
+
+		void wait();
+
+		void terminate();
+
+		[[nodiscard]]
+		Optional<int32> getExitCode();
+
+		/// @brief 子プロセスの標準出力から、ブロックせずに読み込めるだけのデータを読み込みます。
+		/// @return 読み込んだサイズ。現在読み込めるデータが無い場合は 0, 標準出力が閉じられた場合やエラーの場合は none
+		[[nodiscard]]
+		Optional<size_t> tryRead(void* dst, size_t size);
+
+		/// @brief 子プロセスの標準入力に、ブロックせずに書き込めるだけのデータを書き込みます。
+		/// @return 書き込んだサイズ。パイプが一杯の場合は 0, 標準入力が閉じられた場合やエラーの場合は none
+		[[nodiscard]]
+		Optional<size_t> tryWrite(const void* src, size_t size);
+
+		void closeStdIn();
+
+		void closeStdOut();
+
+		/// @brief 子プロセスの標準出力を読み込むファイルディスクリプタを返します。
+		/// @return ファイルディスクリプタ。パイプが無い場合は -1
+		[[nodiscard]]
+		int32 readFD() const noexcept;
+
+		/// @brief 子プロセスの標準入力に書き込むファイルディスクリプタを返します。
+		/// @return ファイルディスクリプタ。パイプが無い場合は -1
+		[[nodiscard]]
+		int32 writeFD() const noexcept;
+
+	private:
+
+		pid_t m_pid = -1;
+
+		int32 m_readFD = -1;
+
+		int32 m_writeFD = -1;
+
+		Optional<int32> m_exitCode;
+
+		/// @brief 子プロセスが終了していれば回収して終了コードを記録します。
+		/// @param block 終了を待つ場合 true
+		void reap(bool block);
+
+		void release() noexcept;
+	};
+}
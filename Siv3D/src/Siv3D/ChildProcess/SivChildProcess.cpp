@@ -137,4 +137,37 @@ namespace s3d
 	{
 		return pImpl->ostream();
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	tryRead
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<size_t> ChildProcess::tryRead(void* dst, const size_t size)
+	{
+		return pImpl->tryRead(dst, size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	tryWrite
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<size_t> ChildProcess::tryWrite(const void* src, const size_t size)
+	{
+		return pImpl->tryWrite(src, size);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	closeStdIn
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ChildProcess::closeStdIn()
+	{
+		pImpl->closeStdIn();
+	}
 }
@@ -1067,6 +1067,22 @@ namespace s3d
 		return Circle{ p0, p1, p2 };
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	DrawBatch
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Circle::DrawBatch(const std::span<const Circle> circles, const ColorF& color)
+	{
+		SIV3D_ENGINE(Renderer2D)->addCircles(circles, color.toFloat4());
+	}
+
+	void Circle::DrawBatch(const std::span<const Circle> circles, const std::span<const ColorF> colors)
+	{
+		SIV3D_ENGINE(Renderer2D)->addCircles(circles, colors);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	Formatter
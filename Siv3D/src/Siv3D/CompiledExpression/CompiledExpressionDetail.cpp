@@ -0,0 +1,299 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include <cmath>
+# include <utility>
+# include "CompiledExpressionDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief スタック上に `stride` 間隔で並んだ引数で、各行の関数を呼び出します。
+		template <size_t N>
+		static void CallFunction(const mu::generic_callable_type& function, double* first, const size_t count, const size_t stride)
+		{
+			[&]<size_t... K>(std::index_sequence<K...>)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					first[i] = function.call_fun<N>(first[K * stride + i]...);
+				}
+			}(std::make_index_sequence<N>{});
+		}
+
+		static void CallFunction(const mu::generic_callable_type& function, const uint32 argc, double* first, const size_t count, const size_t stride)
+		{
+			switch (argc)
+			{
+			case 0: CallFunction<0>(function, first, count, stride); break;
+			case 1: CallFunction<1>(function, first, count, stride); break;
+			case 2: CallFunction<2>(function, first, count, stride); break;
+			case 3: CallFunction<3>(function, first, count, stride); break;
+			case 4: CallFunction<4>(function, first, count, stride); break;
+			case 5: CallFunction<5>(function, first, count, stride); break;
+			case 6: CallFunction<6>(function, first, count, stride); break;
+			case 7: CallFunction<7>(function, first, count, stride); break;
+			case 8: CallFunction<8>(function, first, count, stride); break;
+			case 9: CallFunction<9>(function, first, count, stride); break;
+			case 10: CallFunction<10>(function, first, count, stride); break;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompiledExpression::CompiledExpressionDetail::CompiledExpressionDetail(Array<Instruction>&& program, const size_t numColumns, const size_t stackSize, const size_t maxMultiArgs)
+		: m_program{ std::move(program) }
+		, m_numColumns{ numColumns }
+		, m_stackSize{ stackSize }
+		, m_maxMultiArgs{ maxMultiArgs } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_columns
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t CompiledExpression::CompiledExpressionDetail::num_columns() const noexcept
+	{
+		return m_numColumns;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	evalRows
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CompiledExpression::CompiledExpressionDetail::evalRows(const double* const* columns, const size_t begin, const size_t end, double* out) const
+	{
+		// 評価用のスタックはスレッドごとに使い回す
+		thread_local Array<double> sharedWorkspace;
+		thread_local bool sharedWorkspaceInUse = false;
+
+		// 数式の中の関数から別の数式を評価した場合は、使用中のスタックを壊さないよう別に確保する
+		Array<double> nestedWorkspace;
+		const bool nested = std::exchange(sharedWorkspaceInUse, true);
+		Array<double>& workspace = (nested ? nestedWorkspace : sharedWorkspace);
+
+		const size_t workspaceSize = ((m_stackSize * BlockSize) + m_maxMultiArgs);
+
+		if (workspace.size() < workspaceSize)
+		{
+			workspace.resize(workspaceSize);
+		}
+
+		double* stack = workspace.data();
+		double* args = (stack + (m_stackSize * BlockSize));
+
+		for (size_t offset = begin; offset < end; offset += BlockSize)
+		{
+			const size_t count = std::min(BlockSize, (end - offset));
+			evalBlock(columns, offset, count, (out + offset), stack, args);
+		}
+
+		sharedWorkspaceInUse = nested;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	evalBlock
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CompiledExpression::CompiledExpressionDetail::evalBlock(const double* const* columns, const size_t offset, const size_t count, double* out, double* stack, double* args) const
+	{
+		// スタックの各要素は BlockSize 行分の値を持ち、命令ごとにすべての行をまとめて処理する
+		size_t depth = 0;
+
+		const auto slot = [stack](const size_t index) { return (stack + (index * BlockSize)); };
+
+		const auto binary = [&](auto op)
+		{
+			--depth;
+			double* lhs = slot(depth - 1);
+			const double* rhs = slot(depth);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				lhs[i] = op(lhs[i], rhs[i]);
+			}
+		};
+
+		for (const auto& instruction : m_program)
+		{
+			switch (instruction.op)
+			{
+			case OpCode::Constant:
+				{
+					double* dst = slot(depth++);
+					std::fill_n(dst, count, instruction.a);
+					break;
+				}
+			case OpCode::Column:
+				{
+					double* dst = slot(depth++);
+					const double* src = (columns[instruction.index] + offset);
+					std::copy_n(src, count, dst);
+					break;
+				}
+			case OpCode::ColumnPow2:
+				{
+					double* dst = slot(depth++);
+					const double* src = (columns[instruction.index] + offset);
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						dst[i] = (src[i] * src[i]);
+					}
+
+					break;
+				}
+			case OpCode::ColumnPow3:
+				{
+					double* dst = slot(depth++);
+					const double* src = (columns[instruction.index] + offset);
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						dst[i] = (src[i] * src[i] * src[i]);
+					}
+
+					break;
+				}
+			case OpCode::ColumnPow4:
+				{
+					double* dst = slot(depth++);
+					const double* src = (columns[instruction.index] + offset);
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						dst[i] = (src[i] * src[i] * src[i] * src[i]);
+					}
+
+					break;
+				}
+			case OpCode::ColumnMulAdd:
+				{
+					double* dst = slot(depth++);
+					const double* src = (columns[instruction.index] + offset);
+					const double a = instruction.a;
+					const double b = instruction.b;
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						dst[i] = (src[i] * a + b);
+					}
+
+					break;
+				}
+			case OpCode::LessEqual:
+				binary([](double x, double y) { return static_cast<double>(x <= y); });
+				break;
+			case OpCode::GreaterEqual:
+				binary([](double x, double y) { return static_cast<double>(x >= y); });
+				break;
+			case OpCode::NotEqual:
+				binary([](double x, double y) { return static_cast<double>(x != y); });
+				break;
+			case OpCode::Equal:
+				binary([](double x, double y) { return static_cast<double>(x == y); });
+				break;
+			case OpCode::Less:
+				binary([](double x, double y) { return static_cast<double>(x < y); });
+				break;
+			case OpCode::Greater:
+				binary([](double x, double y) { return static_cast<double>(x > y); });
+				break;
+			case OpCode::Add:
+				binary([](double x, double y) { return (x + y); });
+				break;
+			case OpCode::Subtract:
+				binary([](double x, double y) { return (x - y); });
+				break;
+			case OpCode::Multiply:
+				binary([](double x, double y) { return (x * y); });
+				break;
+			case OpCode::Divide:
+				binary([](double x, double y) { return (x / y); });
+				break;
+			case OpCode::Pow:
+				binary([](double x, double y) { return std::pow(x, y); });
+				break;
+			case OpCode::LogicalAnd:
+				binary([](double x, double y) { return static_cast<double>(x && y); });
+				break;
+			case OpCode::LogicalOr:
+				binary([](double x, double y) { return static_cast<double>(x || y); });
+				break;
+			case OpCode::If:
+			case OpCode::Else:
+				break;
+			case OpCode::EndIf:
+				{
+					depth -= 2;
+					double* condition = slot(depth - 1);
+					const double* onTrue = slot(depth);
+					const double* onFalse = slot(depth + 1);
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						condition[i] = ((condition[i] != 0) ? onTrue[i] : onFalse[i]);
+					}
+
+					break;
+				}
+			case OpCode::Function:
+				{
+					const uint32 argc = instruction.index;
+
+					if (argc == 0)
+					{
+						++depth;
+					}
+					else
+					{
+						depth -= (argc - 1);
+					}
+
+					CallFunction(instruction.function, argc, slot(depth - 1), count, BlockSize);
+					break;
+				}
+			case OpCode::MultiArgFunction:
+				{
+					const uint32 argc = instruction.index;
+					depth -= (argc - 1);
+					double* first = slot(depth - 1);
+
+					for (size_t i = 0; i < count; ++i)
+					{
+						for (size_t k = 0; k < argc; ++k)
+						{
+							args[k] = first[k * BlockSize + i];
+						}
+
+						first[i] = instruction.function.call_multfun(args, static_cast<int>(argc));
+					}
+
+					break;
+				}
+			}
+		}
+
+		std::copy_n(slot(0), count, out);
+	}
+}
@@ -0,0 +1,119 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/CompiledExpression.hpp>
+# include <Siv3D/Array.hpp>
+# include <ThirdParty/muparser/muParser.h>
+
+namespace s3d
+{
+	class CompiledExpression::CompiledExpressionDetail
+	{
+	public:
+
+		enum class OpCode : uint8
+		{
+			Constant,
+
+			Column,
+
+			ColumnPow2,
+
+			ColumnPow3,
+
+			ColumnPow4,
+
+			// column * a + b
+			ColumnMulAdd,
+
+			LessEqual,
+
+			GreaterEqual,
+
+			NotEqual,
+
+			Equal,
+
+			Less,
+
+			Greater,
+
+			Add,
+
+			Subtract,
+
+			Multiply,
+
+			Divide,
+
+			Pow,
+
+			LogicalAnd,
+
+			LogicalOr,
+
+			// 条件の値をスタックに残したまま、両方の分岐を評価する
+			If,
+
+			Else,
+
+			// [条件, 真の値, 偽の値] を選択結果 1 つに置き換える
+			EndIf,
+
+			Function,
+
+			MultiArgFunction,
+		};
+
+		struct Instruction
+		{
+			OpCode op = OpCode::Constant;
+
+			// 列のインデックス、または関数の引数の数
+			uint32 index = 0;
+
+			double a = 0.0;
+
+			double b = 0.0;
+
+			mu::generic_callable_type function{};
+		};
+
+		/// @brief 一度に評価する行数
+		static constexpr size_t BlockSize = 64;
+
+		[[nodiscard]]
+		CompiledExpressionDetail(Array<Instruction>&& program, size_t numColumns, size_t stackSize, size_t maxMultiArgs);
+
+		[[nodiscard]]
+		size_t num_columns() const noexcept;
+
+		/// @brief 行 [begin, end) を評価します。
+		/// @param columns 各列の先頭へのポインタ
+		/// @param begin 最初の行
+		/// @param end 最後の行の次
+		/// @param out 結果の格納先（行 0 の位置）
+		void evalRows(const double* const* columns, size_t begin, size_t end, double* out) const;
+
+	private:
+
+		Array<Instruction> m_program;
+
+		size_t m_numColumns = 0;
+
+		size_t m_stackSize = 0;
+
+		size_t m_maxMultiArgs = 0;
+
+		void evalBlock(const double* const* columns, size_t offset, size_t count, double* out, double* stack, double* args) const;
+	};
+}
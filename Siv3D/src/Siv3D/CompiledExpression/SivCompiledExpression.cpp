@@ -0,0 +1,146 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <Siv3D/CompiledExpression.hpp>
+# include <Siv3D/Threading.hpp>
+# include "CompiledExpressionDetail.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief この行数を超える場合、複数のスレッドで分割して評価する
+		constexpr size_t ParallelChunkSize = (1 << 14);
+
+		/// @brief `eval()` で、列へのポインタをヒープを確保せずに扱える最大の列数
+		constexpr size_t MaxInlineColumns = 16;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompiledExpression::CompiledExpression(std::shared_ptr<const CompiledExpressionDetail>&& detail) noexcept
+		: pImpl{ std::move(detail) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isValid
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompiledExpression::isValid() const noexcept
+	{
+		return static_cast<bool>(pImpl);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompiledExpression::operator bool() const noexcept
+	{
+		return static_cast<bool>(pImpl);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_columns
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t CompiledExpression::num_columns() const noexcept
+	{
+		return (pImpl ? pImpl->num_columns() : 0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	eval
+	//
+	////////////////////////////////////////////////////////////////
+
+	double CompiledExpression::eval(const std::initializer_list<double> values) const
+	{
+		return eval(std::span<const double>{ values.begin(), values.end() });
+	}
+
+	double CompiledExpression::eval(const std::span<const double> values) const
+	{
+		if ((not pImpl) || (values.size() != pImpl->num_columns()))
+		{
+			return Math::NaN;
+		}
+
+		// 呼び出しごとにヒープを確保しないよう、列が少ない場合はスタック上の配列を使う
+		std::array<const double*, MaxInlineColumns> inlineColumns;
+		Array<const double*> heapColumns;
+		const double** columns = inlineColumns.data();
+
+		if (MaxInlineColumns < values.size())
+		{
+			heapColumns.resize(values.size());
+			columns = heapColumns.data();
+		}
+
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			columns[i] = &values[i];
+		}
+
+		double result = Math::NaN;
+		pImpl->evalRows(columns, 0, 1, &result);
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	evalColumns
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool CompiledExpression::evalColumns(const std::initializer_list<std::span<const double>> columns, const std::span<double> out) const
+	{
+		return evalColumns(std::span<const std::span<const double>>{ columns.begin(), columns.end() }, out);
+	}
+
+	bool CompiledExpression::evalColumns(const std::span<const std::span<const double>> columns, const std::span<double> out) const
+	{
+		if ((not pImpl) || (columns.size() != pImpl->num_columns()))
+		{
+			return false;
+		}
+
+		Array<const double*> pColumns(Arg::reserve = columns.size());
+
+		for (const auto& column : columns)
+		{
+			if (column.size() < out.size())
+			{
+				return false;
+			}
+
+			pColumns << column.data();
+		}
+
+		Threading::ParallelFor(out.size(), [&](const size_t begin, const size_t end)
+		{
+			pImpl->evalRows(pColumns.data(), begin, end, out.data());
+		}, ParallelChunkSize);
+
+		return true;
+	}
+}
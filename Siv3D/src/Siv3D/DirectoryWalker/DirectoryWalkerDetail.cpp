@@ -0,0 +1,224 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "DirectoryWalkerDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWalker::DirectoryWalkerDetail::~DirectoryWalkerDetail()
+	{
+		// 列挙を中断し、ワーカーの終了を待機する
+		{
+			std::lock_guard lock{ m_mutex };
+			m_canceled = true;
+		}
+
+		m_workCV.notify_all();
+		m_spaceCV.notify_all();
+
+		m_workers.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	start
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWalker::DirectoryWalkerDetail::start(const FilePathView directory, const DirectoryWalkerOptions& options)
+	{
+		if (directory.isEmpty()
+			|| (not FileSystem::IsDirectory(directory)))
+		{
+			LOG_FAIL(fmt::format("❌ DirectoryWalker: `{}` is not a directory", directory.toUTF8()));
+			return false;
+		}
+
+		m_directory = FileSystem::FullPath(directory);
+		m_options = options;
+		m_directories.push_back(m_directory);
+
+		const size_t numThreads = (m_options.numThreads ? m_options.numThreads : Threading::GetConcurrency());
+
+		// 再帰しない場合、列挙するディレクトリは 1 つだけ
+		const size_t numWorkers = (m_options.recursive ? Max<size_t>(numThreads, 1) : 1);
+
+		m_workers.reserve(numWorkers);
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_workers.emplace_back(&DirectoryWalkerDetail::work, this);
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	next
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWalker::DirectoryWalkerDetail::next(DirectoryEntry& entry)
+	{
+		if (m_readBatch.size() <= m_readIndex)
+		{
+			{
+				std::unique_lock lock{ m_mutex };
+
+				m_outputCV.wait(lock, [this]() { return ((not m_batches.empty()) || isFinished()); });
+
+				if (m_batches.empty())
+				{
+					return false;
+				}
+
+				m_readBatch = std::move(m_batches.front());
+				m_batches.pop_front();
+			}
+
+			m_spaceCV.notify_one();
+			m_readIndex = 0;
+		}
+
+		entry = std::move(m_readBatch[m_readIndex++]);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	directory
+	//
+	////////////////////////////////////////////////////////////////
+
+	const FilePath& DirectoryWalker::DirectoryWalkerDetail::directory() const noexcept
+	{
+		return m_directory;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWalker::DirectoryWalkerDetail::isFinished() const noexcept
+	{
+		return (m_directories.isEmpty() && (m_numActiveWorkers == 0));
+	}
+
+	bool DirectoryWalker::DirectoryWalkerDetail::publish(Array<DirectoryEntry>& batch, Array<FilePath>& subdirectories)
+	{
+		std::unique_lock lock{ m_mutex };
+
+		// 他のワーカーがすぐに取りかかれるよう、サブディレクトリを先に公開する
+		if (subdirectories)
+		{
+			m_directories.append(std::make_move_iterator(subdirectories.begin()), std::make_move_iterator(subdirectories.end()));
+			subdirectories.clear();
+			m_workCV.notify_all();
+		}
+
+		if (batch)
+		{
+			m_spaceCV.wait(lock, [this]() { return (m_canceled || (m_batches.size() < MaxPendingBatches)); });
+
+			if (m_canceled)
+			{
+				return false;
+			}
+
+			m_batches.push_back(std::move(batch));
+			batch.clear();
+			batch.reserve(BatchSize);
+			m_outputCV.notify_one();
+		}
+
+		return (not m_canceled);
+	}
+
+	void DirectoryWalker::DirectoryWalkerDetail::work()
+	{
+		Array<DirectoryEntry> batch;
+		batch.reserve(BatchSize);
+
+		Array<FilePath> subdirectories;
+
+		for (;;)
+		{
+			FilePath directory;
+			{
+				std::unique_lock lock{ m_mutex };
+
+				m_workCV.wait(lock, [this]() { return (m_canceled || (not m_directories.isEmpty()) || (m_numActiveWorkers == 0)); });
+
+				// 中断された場合、またはすべてのワーカーが待機していて列挙するディレクトリも残っていない場合
+				if (m_canceled || m_directories.isEmpty())
+				{
+					return;
+				}
+
+				directory = std::move(m_directories.back());
+				m_directories.pop_back();
+				++m_numActiveWorkers;
+			}
+
+			detail::ReadDirectory(directory, m_options.fetchMetadata, [&](DirectoryEntry&& entry)
+			{
+				if (m_options.recursive
+					&& entry.isDirectory()
+					&& ((not m_options.directoryFilter) || m_options.directoryFilter(entry)))
+				{
+					subdirectories.push_back(entry.path);
+				}
+
+				if (m_options.filter && (not m_options.filter(entry)))
+				{
+					return true;
+				}
+
+				batch.push_back(std::move(entry));
+
+				if (batch.size() < BatchSize)
+				{
+					return true;
+				}
+
+				return publish(batch, subdirectories);
+			});
+
+			publish(batch, subdirectories);
+
+			bool finished = false;
+			{
+				std::lock_guard lock{ m_mutex };
+				--m_numActiveWorkers;
+				finished = isFinished();
+			}
+
+			if (finished)
+			{
+				m_workCV.notify_all();
+				m_outputCV.notify_all();
+			}
+		}
+	}
+}
@@ -0,0 +1,124 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <condition_variable>
+# include <deque>
+# include <thread>
+# include <Siv3D/DirectoryWalker.hpp>
+# include <Siv3D/FunctionRef.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief ディレクトリ直下のエントリを列挙します。（プラットフォームごとに実装）
+		/// @param directory ディレクトリの絶対パス。末尾は '/'
+		/// @param fetchMetadata ファイルのサイズと最終更新日時を取得する場合 true
+		/// @param f 各エントリに対して呼ばれる関数。false を返すと列挙を中断します。
+		void ReadDirectory(const FilePath& directory, bool fetchMetadata, FunctionRef<bool(DirectoryEntry&&)> f);
+	}
+
+	class DirectoryWalker::DirectoryWalkerDetail
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(constructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		DirectoryWalkerDetail() = default;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	(destructor)
+		//
+		////////////////////////////////////////////////////////////////
+
+		~DirectoryWalkerDetail();
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	start
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool start(FilePathView directory, const DirectoryWalkerOptions& options);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	next
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool next(DirectoryEntry& entry);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	directory
+		//
+		////////////////////////////////////////////////////////////////
+
+		[[nodiscard]]
+		const FilePath& directory() const noexcept;
+
+	private:
+
+		/// @brief 1 つのバッチに含めるエントリの数
+		static constexpr size_t BatchSize = 1024;
+
+		/// @brief 取り出されていないバッチの上限。これを超えるとワーカーは取り出されるまで待機します。
+		static constexpr size_t MaxPendingBatches = 64;
+
+		FilePath m_directory;
+
+		DirectoryWalkerOptions m_options;
+
+		std::mutex m_mutex;
+
+		/// @brief 列挙するディレクトリが追加されたとき、または列挙が終わったときに通知
+		std::condition_variable m_workCV;
+
+		/// @brief バッチが追加されたとき、または列挙が終わったときに通知
+		std::condition_variable m_outputCV;
+
+		/// @brief バッチが取り出されたとき、または中断されたときに通知
+		std::condition_variable m_spaceCV;
+
+		/// @brief これから列挙するディレクトリ
+		/// @remark 末尾から取り出す（深さ優先）ことで、保持するディレクトリの数を抑えます。
+		Array<FilePath> m_directories;
+
+		/// @brief ディレクトリを列挙中のワーカーの数
+		size_t m_numActiveWorkers = 0;
+
+		std::deque<Array<DirectoryEntry>> m_batches;
+
+		bool m_canceled = false;
+
+		/// @brief 取り出し中のバッチ（呼び出し元のスレッドのみがアクセス）
+		Array<DirectoryEntry> m_readBatch;
+
+		size_t m_readIndex = 0;
+
+		Array<std::jthread> m_workers;
+
+		[[nodiscard]]
+		bool isFinished() const noexcept;
+
+		bool publish(Array<DirectoryEntry>& batch, Array<FilePath>& subdirectories);
+
+		void work();
+	};
+}
@@ -0,0 +1,163 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/DirectoryWalker.hpp>
+# include "DirectoryWalkerDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	Iterator
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWalker::Iterator::Iterator(DirectoryWalker* walker)
+		: m_walker{ walker }
+	{
+		++(*this);
+	}
+
+	DirectoryWalker::Iterator& DirectoryWalker::Iterator::operator ++()
+	{
+		if (m_walker && (not m_walker->next(m_entry)))
+		{
+			m_walker = nullptr;
+		}
+
+		return *this;
+	}
+
+	void DirectoryWalker::Iterator::operator ++(int)
+	{
+		++(*this);
+	}
+
+	const DirectoryEntry& DirectoryWalker::Iterator::operator *() const noexcept
+	{
+		return m_entry;
+	}
+
+	const DirectoryEntry* DirectoryWalker::Iterator::operator ->() const noexcept
+	{
+		return &m_entry;
+	}
+
+	bool DirectoryWalker::Iterator::operator ==(std::default_sentinel_t) const noexcept
+	{
+		return (m_walker == nullptr);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWalker::DirectoryWalker(const FilePathView directory, const DirectoryWalkerOptions& options)
+		: pImpl{ std::make_shared<DirectoryWalkerDetail>() }
+	{
+		if (not pImpl->start(directory, options))
+		{
+			pImpl.reset();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isOpen
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWalker::isOpen() const noexcept
+	{
+		return static_cast<bool>(pImpl);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWalker::operator bool() const noexcept
+	{
+		return isOpen();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	next
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool DirectoryWalker::next(DirectoryEntry& entry)
+	{
+		if (not pImpl)
+		{
+			return false;
+		}
+
+		return pImpl->next(entry);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	readAll
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<DirectoryEntry> DirectoryWalker::readAll()
+	{
+		Array<DirectoryEntry> entries;
+
+		for (DirectoryEntry entry; next(entry);)
+		{
+			entries.push_back(std::move(entry));
+		}
+
+		return entries;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	directory
+	//
+	////////////////////////////////////////////////////////////////
+
+	const FilePath& DirectoryWalker::directory() const noexcept
+	{
+		static const FilePath EmptyPath;
+
+		if (not pImpl)
+		{
+			return EmptyPath;
+		}
+
+		return pImpl->directory();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	begin, end
+	//
+	////////////////////////////////////////////////////////////////
+
+	DirectoryWalker::Iterator DirectoryWalker::begin()
+	{
+		return Iterator{ this };
+	}
+
+	std::default_sentinel_t DirectoryWalker::end() const noexcept
+	{
+		return std::default_sentinel;
+	}
+}
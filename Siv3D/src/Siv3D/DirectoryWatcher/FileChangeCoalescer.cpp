@@ -0,0 +1,175 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include <Siv3D/Time.hpp>
+# include "FileChangeCoalescer.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 同じパスに対する 2 つの操作を 1 つにまとめます。
+		/// @return まとめた操作。操作が打ち消し合う場合は none
+		[[nodiscard]]
+		static Optional<FileAction> Merge(const FileAction previous, const FileAction next) noexcept
+		{
+			if (previous == FileAction::Added)
+			{
+				// 追加されてすぐに削除されたファイルは通知しない
+				if (next == FileAction::Removed)
+				{
+					return none;
+				}
+
+				return FileAction::Added;
+			}
+
+			if (previous == FileAction::Removed)
+			{
+				// 削除されて同じパスに作り直されたファイルは、更新として通知する
+				if ((next == FileAction::Added) || (next == FileAction::Modified))
+				{
+					return FileAction::Modified;
+				}
+
+				return FileAction::Removed;
+			}
+
+			return next;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setDebounceTime
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::setDebounceTime(const Duration& debounceTime)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_debounceTimeUs = static_cast<int64>(std::max(debounceTime.count(), 0.0) * 1'000'000);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::add(FilePath path, const FileAction action)
+	{
+		add(std::move(path), action, Time::GetMicrosec());
+	}
+
+	void FileChangeCoalescer::add(FilePath path, const FileAction action, const int64 timeUs)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (m_debounceTimeUs == 0)
+		{
+			m_readyChanges.push_back({ std::move(path), action });
+			return;
+		}
+
+		if (auto it = m_pendingChanges.find(path);
+			it != m_pendingChanges.end())
+		{
+			if (const auto merged = Merge(it->second.action, action))
+			{
+				it->second.action = *merged;
+				it->second.lastTimeUs = timeUs;
+			}
+			else
+			{
+				m_pendingChanges.erase(it);
+			}
+
+			return;
+		}
+
+		m_pendingChanges.emplace(std::move(path), PendingChange{ action, m_sequence++, timeUs });
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	extract
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::extract(Array<FileChange>& fileChanges)
+	{
+		extract(fileChanges, Time::GetMicrosec());
+	}
+
+	void FileChangeCoalescer::extract(Array<FileChange>& fileChanges, const int64 timeUs)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		flush(timeUs);
+
+		fileChanges.clear();
+
+		fileChanges.swap(m_readyChanges);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_pendingChanges.clear();
+
+		m_readyChanges.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	void FileChangeCoalescer::flush(const int64 timeUs)
+	{
+		if (m_pendingChanges.empty())
+		{
+			return;
+		}
+
+		Array<std::pair<uint64, FileChange>> settled;
+
+		for (auto it = m_pendingChanges.begin(); it != m_pendingChanges.end();)
+		{
+			if ((timeUs - it->second.lastTimeUs) < m_debounceTimeUs)
+			{
+				++it;
+				continue;
+			}
+
+			settled.emplace_back(it->second.sequence, FileChange{ it->first, it->second.action });
+			m_pendingChanges.erase(it++);
+		}
+
+		std::ranges::sort(settled, {}, &std::pair<uint64, FileChange>::first);
+
+		for (auto& [sequence, change] : settled)
+		{
+			m_readyChanges.push_back(std::move(change));
+		}
+	}
+}
@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <Siv3D/FileChange.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Duration.hpp>
+
+namespace s3d
+{
+	/// @brief 同じパスに対する短時間の連続した変更を 1 つの FileChange にまとめるクラス
+	/// @remark 通知を受け取るスレッドと、変更を取り出すスレッドが異なっていても安全に使えます。
+	class FileChangeCoalescer
+	{
+	public:
+
+		/// @brief 変更をまとめる時間を設定します。
+		/// @param debounceTime 最後の変更からこの時間が経過するまで、同じパスの変更をまとめます。0 の場合はまとめずにすぐ取り出せるようにします。
+		void setDebounceTime(const Duration& debounceTime);
+
+		/// @brief 変更を追加します。
+		/// @param path ファイルパス
+		/// @param action ファイルの操作
+		void add(FilePath path, FileAction action);
+
+		/// @brief 変更を追加します。
+		/// @param path ファイルパス
+		/// @param action ファイルの操作
+		/// @param timeUs 変更が通知された時刻 [マイクロ秒]
+		void add(FilePath path, FileAction action, int64 timeUs);
+
+		/// @brief まとめる時間が経過した変更を、最初に通知された順に取り出します。
+		/// @param fileChanges 取り出した変更の格納先
+		void extract(Array<FileChange>& fileChanges);
+
+		/// @brief まとめる時間が経過した変更を、最初に通知された順に取り出します。
+		/// @param fileChanges 取り出した変更の格納先
+		/// @param timeUs 現在の時刻 [マイクロ秒]
+		void extract(Array<FileChange>& fileChanges, int64 timeUs);
+
+		/// @brief すべての変更を破棄します。
+		void clear();
+
+	private:
+
+		struct PendingChange
+		{
+			FileAction action = FileAction::Unknown;
+
+			/// @brief 最初に通知された順番
+			uint64 sequence = 0;
+
+			/// @brief 最後に通知された時刻 [マイクロ秒]
+			int64 lastTimeUs = 0;
+		};
+
+		std::mutex m_mutex;
+
+		int64 m_debounceTimeUs = 0;
+
+		uint64 m_sequence = 0;
+
+		HashMap<FilePath, PendingChange> m_pendingChanges;
+
+		Array<FileChange> m_readyChanges;
+
+		void flush(int64 timeUs);
+	};
+}
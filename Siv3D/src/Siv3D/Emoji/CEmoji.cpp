@@ -11,10 +11,9 @@
 
 # include "CEmoji.hpp"
 # include <Siv3D/EngineLog.hpp>
-# include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Font/IFont.hpp>
 # include <Siv3D/Engine/Siv3DEngine.hpp>
-# include <Siv3D/CacheDirectory/CacheDirectory.hpp>
+# include <Siv3D/EngineResource/IEngineResource.hpp>
 
 SIV3D_DISABLE_MSVC_WARNINGS_PUSH(4244)
 # include <ThirdParty/skia/include/core/SkCanvas.h>
@@ -122,9 +121,9 @@ namespace s3d
 	{
 		LOG_SCOPED_DEBUG("CEmoji::init()");
 
-		const FilePath emojiFilePath = (CacheDirectory::Engine() + U"font/noto-emoji/Noto-COLRv1.ttf");
+		const FilePath emojiFilePath = SIV3D_ENGINE(EngineResource)->prepare(U"font/noto-emoji/Noto-COLRv1.ttf");
 
-		if (not FileSystem::Exists(emojiFilePath))
+		if (not emojiFilePath)
 		{
 			LOG_INFO("Emoji font file not found");
 			return;
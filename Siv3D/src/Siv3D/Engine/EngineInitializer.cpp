@@ -0,0 +1,253 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cassert>
+# include <condition_variable>
+# include <exception>
+# include <functional>
+# include <future>
+# include <mutex>
+# include "EngineInitializer.hpp"
+# include <Siv3D/Time.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/EngineInitMetrics.hpp>
+# include <Siv3D/Profiler/IProfiler.hpp>
+# include <Siv3D/Engine/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		enum class TaskState : uint8
+		{
+			Pending,
+
+			Running,
+
+			Done,
+		};
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	add
+	//
+	////////////////////////////////////////////////////////////////
+
+	EngineInitializer::TaskID EngineInitializer::add(const char* name, void(*init)(), const std::initializer_list<TaskID> dependencies)
+	{
+		return addTask(name, init, dependencies, false);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addAsync
+	//
+	////////////////////////////////////////////////////////////////
+
+	EngineInitializer::TaskID EngineInitializer::addAsync(const char* name, void(*init)(), const std::initializer_list<TaskID> dependencies)
+	{
+		return addTask(name, init, dependencies, true);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	run
+	//
+	////////////////////////////////////////////////////////////////
+
+	void EngineInitializer::run()
+	{
+		const size_t numTasks = m_tasks.size();
+		const uint64 startTime = Time::GetMicrosec();
+
+		std::mutex mutex;
+		std::condition_variable taskFinished;
+		Array<TaskState> states(numTasks, TaskState::Pending);
+		Array<ComponentInitTime> times(numTasks);
+		Array<std::future<void>> workers;
+		std::exception_ptr exception;
+		size_t numRunningWorkers = 0;
+
+		const auto isReady = [&](const TaskID id)
+			{
+				for (const TaskID dependency : m_tasks[id].dependencies)
+				{
+					if (states[dependency] != TaskState::Done)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			};
+
+		// 初期化関数を呼び出し、時間を記録する（ロックの外で呼ぶ）
+		const auto execute = [&](const TaskID id)
+			{
+				const Task& task = m_tasks[id];
+				const uint64 taskStartTime = Time::GetMicrosec();
+
+				task.init();
+
+				const uint64 taskEndTime = Time::GetMicrosec();
+				times[id] = ComponentInitTime{
+					.name			= Unicode::FromAscii(task.name),
+					.startTimeUs	= static_cast<int64>(taskStartTime - startTime),
+					.durationUs		= static_cast<int64>(taskEndTime - taskStartTime),
+					.isAsync		= task.isAsync };
+			};
+
+		// 依存先が完了した非同期タスクをワーカースレッドで開始する（ロックを取得した状態で呼ぶ）
+		std::function<void()> launchReadyTasks;
+
+		launchReadyTasks = [&]()
+			{
+				if (exception)
+				{
+					return;
+				}
+
+				for (TaskID id = 0; id < numTasks; ++id)
+				{
+					if ((not m_tasks[id].isAsync) || (states[id] != TaskState::Pending) || (not isReady(id)))
+					{
+						continue;
+					}
+
+					states[id] = TaskState::Running;
+					++numRunningWorkers;
+
+					workers << std::async(std::launch::async, [&, id]()
+						{
+							std::exception_ptr taskException;
+
+							try
+							{
+								execute(id);
+							}
+							catch (...)
+							{
+								taskException = std::current_exception();
+							}
+
+							std::lock_guard lock{ mutex };
+
+							if (taskException && (not exception))
+							{
+								exception = taskException;
+							}
+
+							states[id] = TaskState::Done;
+							--numRunningWorkers;
+							launchReadyTasks();
+							taskFinished.notify_all();
+						});
+				}
+			};
+
+		// メインスレッドのタスクを追加した順に実行する
+		for (TaskID id = 0; id < numTasks; ++id)
+		{
+			if (m_tasks[id].isAsync)
+			{
+				continue;
+			}
+
+			{
+				std::unique_lock lock{ mutex };
+				launchReadyTasks();
+				taskFinished.wait(lock, [&]() { return (exception || isReady(id)); });
+
+				if (exception)
+				{
+					break;
+				}
+
+				states[id] = TaskState::Running;
+			}
+
+			try
+			{
+				execute(id);
+			}
+			catch (...)
+			{
+				std::lock_guard lock{ mutex };
+
+				if (not exception)
+				{
+					exception = std::current_exception();
+				}
+
+				break;
+			}
+
+			std::lock_guard lock{ mutex };
+			states[id] = TaskState::Done;
+		}
+
+		// 残りの非同期タスクの完了を待つ
+		{
+			std::unique_lock lock{ mutex };
+			launchReadyTasks();
+			taskFinished.wait(lock, [&]() { return (numRunningWorkers == 0); });
+		}
+
+		for (auto& worker : workers)
+		{
+			worker.wait();
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+
+		EngineInitMetrics metrics;
+		metrics.totalTimeUs = static_cast<int64>(Time::GetMicrosec() - startTime);
+		metrics.components = std::move(times);
+		std::ranges::stable_sort(metrics.components, {}, &ComponentInitTime::startTimeUs);
+
+		int64 sumTimeUs = 0;
+
+		for (const auto& component : metrics.components)
+		{
+			sumTimeUs += component.durationUs;
+			LOG_DEBUG(fmt::format("{}: {} us{}", Unicode::ToUTF8(component.name), component.durationUs, (component.isAsync ? " (async)" : "")));
+		}
+
+		LOG_INFO(fmt::format("Initialized {} engine components in {} us ({} us if run serially)", numTasks, metrics.totalTimeUs, sumTimeUs));
+
+		SIV3D_ENGINE(Profiler)->setEngineInitMetrics(std::move(metrics));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	addTask
+	//
+	////////////////////////////////////////////////////////////////
+
+	EngineInitializer::TaskID EngineInitializer::addTask(const char* name, void(*init)(), const std::initializer_list<TaskID> dependencies, const bool isAsync)
+	{
+		const TaskID id = m_tasks.size();
+
+		// 依存先は先に追加されたタスクに限ることで、循環を防ぐ
+		for ([[maybe_unused]] const TaskID dependency : dependencies)
+		{
+			assert(dependency < id);
+		}
+
+		m_tasks.push_back(Task{ name, init, Array<TaskID>(dependencies), isAsync });
+		return id;
+	}
+}
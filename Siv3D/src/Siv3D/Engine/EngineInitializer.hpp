@@ -0,0 +1,64 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <initializer_list>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	/// @brief エンジンのコンポーネントを、宣言した依存関係に従って初期化するクラス
+	/// @remark メインスレッドのタスクは追加した順に実行し、任意のスレッドで実行できるタスクは依存先が完了しだいワーカースレッドで並行して実行します。
+	/// @remark 各タスクの初期化時間は EngineLog に出力し、Profiler に記録します。
+	class EngineInitializer
+	{
+	public:
+
+		/// @brief タスクの ID
+		using TaskID = size_t;
+
+		/// @brief メインスレッドで初期化するコンポーネントを追加します。
+		/// @param name コンポーネントの名前
+		/// @param init 初期化関数
+		/// @param dependencies 先に初期化が完了している必要があるタスク
+		/// @return 追加したタスクの ID
+		TaskID add(const char* name, void(*init)(), std::initializer_list<TaskID> dependencies = {});
+
+		/// @brief 任意のスレッドで初期化できるコンポーネントを追加します。
+		/// @param name コンポーネントの名前
+		/// @param init 初期化関数
+		/// @param dependencies 先に初期化が完了している必要があるタスク
+		/// @return 追加したタスクの ID
+		TaskID addAsync(const char* name, void(*init)(), std::initializer_list<TaskID> dependencies = {});
+
+		/// @brief すべてのコンポーネントを初期化します。
+		/// @remark いずれかの初期化関数が例外を送出した場合、実行中のタスクの完了を待ってから、最初の例外を再送出します。
+		void run();
+
+	private:
+
+		struct Task
+		{
+			const char* name = nullptr;
+
+			void(*init)() = nullptr;
+
+			Array<TaskID> dependencies;
+
+			bool isAsync = false;
+		};
+
+		Array<Task> m_tasks;
+
+		TaskID addTask(const char* name, void(*init)(), std::initializer_list<TaskID> dependencies, bool isAsync);
+	};
+}
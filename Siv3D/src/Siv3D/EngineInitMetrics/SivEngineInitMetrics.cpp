@@ -0,0 +1,46 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineInitMetrics.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	format
+	//
+	////////////////////////////////////////////////////////////////
+
+	String EngineInitMetrics::format() const
+	{
+		String result;
+		result += U"Engine Init Time: {} μs\n"_fmt(totalTimeUs);
+
+		for (const auto& component : components)
+		{
+			result += U"- {}: {} μs (start: {} μs{})\n"_fmt(component.name, component.durationUs, component.startTimeUs, (component.isAsync ? U", async" : U""));
+		}
+
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, const EngineInitMetrics& value)
+	{
+		formatData.string += value.format();
+	}
+}
@@ -13,9 +13,12 @@
 # include <Siv3D/Resource.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Compression.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/Error/InternalEngineError.hpp>
 # include <Siv3D/CacheDirectory/CacheDirectory.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/HashMap.hpp>
+# include "EngineResourceCache.hpp"
 
 namespace s3d
 {
@@ -36,6 +39,10 @@ namespace s3d
 			/// @brief リソースが圧縮されているか
 			bool isCompressed;
 
+			/// @brief エンジンの初期化時に展開するか
+			/// @remark false の場合、最初に使用されるときに展開されます。
+			bool isPreloaded;
+
 			[[nodiscard]]
 			String getFriendlyName() const
 			{
@@ -68,21 +75,146 @@ namespace s3d
 		};
 
 		/// @brief エンジンで使用するリソースの一覧
-		static constexpr std::array<EngineResourceDetail, 12> EngineResources
+		static constexpr std::array<EngineResourceDetail, CEngineResource::NumResources> EngineResources
 		{{
-			{ U"font/", U"min/siv3d-min.otf", true, true },
-			{ U"font/", U"noto-cjk/NotoSansCJK-Medium.ttc", false, true },
-			{ U"font/", U"noto-cjk/NotoSansJP-Medium.otf", false, true },
-			{ U"font/", U"noto-emoji/Noto-COLRv1.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-thin.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-light.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-regular.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-medium.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-bold.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-heavy.ttf", false, true },
-			{ U"font/", U"mplus/mplus-1p-black.ttf", false, true },
-			{ U"font/", U"materialdesignicons/materialdesignicons-webfont.ttf", false, true },
+			{ U"font/", U"min/siv3d-min.otf", true, true, true },
+			{ U"font/", U"noto-cjk/NotoSansCJK-Medium.ttc", false, true, false },
+			{ U"font/", U"noto-cjk/NotoSansJP-Medium.otf", false, true, false },
+			{ U"font/", U"noto-emoji/Noto-COLRv1.ttf", false, true, true },
+			{ U"font/", U"mplus/mplus-1p-thin.ttf", false, true, false },
+			{ U"font/", U"mplus/mplus-1p-light.ttf", false, true, false },
+			{ U"font/", U"mplus/mplus-1p-regular.ttf", false, true, false },
+			{ U"font/", U"mplus/mplus-1p-medium.ttf", false, true, false },
+			{ U"font/", U"mplus/mplus-1p-bold.ttf", false, true, false },
+			{ U"font/", U"mplus/mplus-1p-heavy.ttf", false, true, false },
+			{ U"font/", U"mplus/mplus-1p-black.ttf", false, true, false },
+			{ U"font/", U"materialdesignicons/materialdesignicons-webfont.ttf", false, true, true },
 		}};
+
+		enum class PrepareStatus : uint8
+		{
+			/// @brief 検証済みのキャッシュ、または圧縮されていないリソースが見つかった
+			Found,
+
+			/// @brief リソースを展開した
+			Decompressed,
+
+			/// @brief リソースが見つからない
+			NotFound,
+
+			/// @brief リソースの展開に失敗した
+			Failed,
+		};
+
+		struct PrepareResult
+		{
+			PrepareStatus status = PrepareStatus::NotFound;
+
+			FilePath path;
+		};
+
+		/// @brief 圧縮されたリソースを一時ファイルに展開し、キャッシュディレクトリに保存します。
+		/// @param resourcePath 圧縮されたリソースのパス
+		/// @param cachePath 保存先のパス
+		/// @param sourceSize 圧縮されたリソースのファイルサイズ
+		/// @return 展開と保存に成功した場合 true, それ以外の場合は false
+		/// @remark 複数のリソースを並列に展開してもメモリを圧迫しないよう、展開した内容はメモリに保持せずにファイルに書き出します。
+		[[nodiscard]]
+		static bool Extract(const FilePathView resourcePath, const FilePathView cachePath, const uint64 sourceSize)
+		{
+			const FilePath temporaryPath = EngineResourceCache::GetTemporaryPath(cachePath);
+
+			if (not Compression::DecompressFileToFile(resourcePath, temporaryPath))
+			{
+				FileSystem::Remove(temporaryPath);
+				return false;
+			}
+
+			return EngineResourceCache::Commit(cachePath, sourceSize);
+		}
+
+		[[nodiscard]]
+		static PrepareResult PrepareResource(const EngineResourceDetail& resource, const FilePathView cacheDirectory)
+		{
+			const FilePath resourcePath = resource.getResourceFilePath();
+
+			if (not resource.isCompressed)
+			{
+				if (FileSystem::Exists(resourcePath))
+				{
+					return{ PrepareStatus::Found, resourcePath };
+				}
+
+				return{ PrepareStatus::NotFound, U"" };
+			}
+
+			const FilePath cachePath = resource.getCachedFilePath(cacheDirectory);
+			const uint64 sourceSize = FileSystem::FileSize(resourcePath);
+
+			if (EngineResourceCache::Validate(cachePath, sourceSize) != EngineResourceCache::ValidationResult::Invalid)
+			{
+				return{ PrepareStatus::Found, cachePath };
+			}
+
+			if (sourceSize == 0)
+			{
+				return{ PrepareStatus::NotFound, U"" };
+			}
+
+			if (not Extract(resourcePath, cachePath, sourceSize))
+			{
+				return{ PrepareStatus::Failed, U"" };
+			}
+
+			return{ PrepareStatus::Decompressed, cachePath };
+		}
+
+		static void LogPrepareResult(const EngineResourceDetail& resource, const PrepareResult& result)
+		{
+			const String friendlyName = resource.getFriendlyName();
+
+			switch (result.status)
+			{
+			case PrepareStatus::Found:
+				LOG_DEBUG(fmt::format("Found `{}`", friendlyName));
+				break;
+			case PrepareStatus::Decompressed:
+				LOG_DEBUG(fmt::format("Successfully decompressed `{}`", friendlyName));
+				break;
+			case PrepareStatus::NotFound:
+				LOG_DEBUG(fmt::format("Resource `{}` not found", friendlyName));
+				break;
+			case PrepareStatus::Failed:
+				LOG_FAIL(fmt::format("Failed to decompress `{}`", friendlyName));
+				break;
+			}
+		}
+
+		/// @brief リソースのパスから EngineResources のインデックスを検索します。
+		/// @param resourcePath リソースのパス（例: U"font/min/siv3d-min.otf"）
+		/// @return インデックス。見つからない場合は none
+		[[nodiscard]]
+		static Optional<size_t> FindResourceIndex(const StringView resourcePath)
+		{
+			static const HashMap<String, size_t> indices = []()
+			{
+				HashMap<String, size_t> result;
+
+				for (size_t i = 0; i < EngineResources.size(); ++i)
+				{
+					result.emplace(EngineResources[i].getFriendlyName(), i);
+				}
+
+				return result;
+			}();
+
+			if (const auto it = indices.find(resourcePath); it != indices.end())
+			{
+				return it->second;
+			}
+
+			return none;
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -95,39 +227,83 @@ namespace s3d
 	{
 		LOG_SCOPED_DEBUG("CEngineResource::init()");
 
-		const FilePath cacheDirectory = CacheDirectory::Engine();
+		m_cacheDirectory = CacheDirectory::Engine();
+
+		// 起動時に必要なリソースだけを並列に展開する。それ以外は prepare() で最初に使われるときに展開する。
+		Array<size_t> preloadIndices;
 
-		for (const auto& resource : EngineResources)
+		for (size_t i = 0; i < EngineResources.size(); ++i)
 		{
-			if (resource.isCompressed)
+			if (EngineResources[i].isPreloaded)
 			{
-				const String friendlyName = resource.getFriendlyName();
-				const FilePath cachePath = resource.getCachedFilePath(cacheDirectory);
-				const FilePath resourcePath = resource.getResourceFilePath();
+				preloadIndices << i;
+			}
+		}
+
+		std::array<PrepareResult, NumResources> results;
 
-				if (FileSystem::Exists(cachePath))
+		Threading::ParallelFor(preloadIndices.size(), [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
 				{
-					LOG_DEBUG(fmt::format("Found `{}`", friendlyName));
-					continue;
+					const size_t index = preloadIndices[i];
+					results[index] = PrepareResource(EngineResources[index], m_cacheDirectory);
 				}
+			});
 
-				if (not FileSystem::Exists(resourcePath))
-				{
-					if (resource.isMandatory)
-					{
-						throw InternalEngineError{ fmt::format("Resource `{}` not found", friendlyName) };
-					}
+		for (const size_t index : preloadIndices)
+		{
+			const auto& resource = EngineResources[index];
+			const auto& result = results[index];
 
-					continue;
-				}
+			LogPrepareResult(resource, result);
 
-				if (not Compression::DecompressFileToFile(resourcePath, cachePath))
-				{
-					throw InternalEngineError{ fmt::format("Failed to decompress `{}`", friendlyName) };
-				}
+			if (result.status == PrepareStatus::Failed)
+			{
+				throw InternalEngineError{ fmt::format("Failed to decompress `{}`", resource.getFriendlyName()) };
+			}
 
-				LOG_DEBUG(fmt::format("Successfully decompressed `{}`", friendlyName));
+			if ((result.status == PrepareStatus::NotFound) && resource.isMandatory)
+			{
+				throw InternalEngineError{ fmt::format("Resource `{}` not found", resource.getFriendlyName()) };
 			}
+
+			m_states[index].prepared = true;
+			m_states[index].path = result.path;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	prepare
+	//
+	////////////////////////////////////////////////////////////////
+
+	FilePath CEngineResource::prepare(const StringView resourcePath)
+	{
+		const Optional<size_t> index = FindResourceIndex(resourcePath);
+
+		if (not index)
+		{
+			LOG_FAIL(fmt::format("Unknown engine resource `{}`", resourcePath));
+			return{};
 		}
+
+		const auto& resource = EngineResources[*index];
+		ResourceState& state = m_states[*index];
+
+		std::lock_guard lock{ state.mutex };
+
+		if (not state.prepared)
+		{
+			const PrepareResult result = PrepareResource(resource, m_cacheDirectory);
+
+			LogPrepareResult(resource, result);
+
+			state.prepared = true;
+			state.path = result.path;
+		}
+
+		return state.path;
 	}
 }
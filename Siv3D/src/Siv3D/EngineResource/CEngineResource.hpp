@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
+# include <mutex>
 # include <Siv3D/String.hpp>
 # include "IEngineResource.hpp"
 
@@ -19,9 +21,29 @@ namespace s3d
 	{
 	public:
 
+		/// @brief エンジンで使用するリソースの数
+		static constexpr size_t NumResources = 12;
+
 		void init() override;
 
+		[[nodiscard]]
+		FilePath prepare(StringView resourcePath) override;
+
 	private:
 
+		struct ResourceState
+		{
+			std::mutex mutex;
+
+			/// @brief 展開と検証が済んでいるか
+			bool prepared = false;
+
+			/// @brief 使用可能なファイルのパス。リソースが存在しない場合は空
+			FilePath path;
+		};
+
+		FilePath m_cacheDirectory;
+
+		std::array<ResourceState, NumResources> m_states;
 	};
 }
@@ -0,0 +1,222 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/DateTime.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include "EngineResourceCache.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 展開したファイルの検証に用いる情報
+		struct CacheInfo
+		{
+			/// @brief 圧縮されたリソースのファイルサイズ
+			uint64 sourceSize;
+
+			/// @brief 展開後のファイルサイズ
+			uint64 contentSize;
+
+			/// @brief 展開後のファイルのハッシュ値
+			uint64 contentHash;
+
+			/// @brief 展開後のファイルの更新日時
+			DateTime contentWriteTime;
+		};
+
+		[[nodiscard]]
+		static bool LoadCacheInfo(const FilePathView infoPath, CacheInfo& info)
+		{
+			const Blob infoBlob{ infoPath };
+
+			if (infoBlob.size() != sizeof(CacheInfo))
+			{
+				return false;
+			}
+
+			std::memcpy(&info, infoBlob.data(), sizeof(CacheInfo));
+			return true;
+		}
+
+		[[nodiscard]]
+		static bool SaveCacheInfo(const FilePathView infoPath, const CacheInfo& info)
+		{
+			return Blob{ &info, sizeof(CacheInfo) }.save(infoPath);
+		}
+
+		/// @brief ファイルの内容のハッシュ値を、ファイルをメモリマップして計算します。
+		/// @param path ファイルのパス
+		/// @param size ファイルサイズの格納先
+		/// @return ハッシュ値。ファイルを開けなかった場合は none
+		[[nodiscard]]
+		static Optional<uint64> HashFile(const FilePathView path, uint64& size)
+		{
+			size = FileSystem::FileSize(path);
+
+			if (size == 0)
+			{
+				if (not FileSystem::Exists(path))
+				{
+					return none;
+				}
+
+				return BitwiseHash(nullptr, 0);
+			}
+
+			MemoryMappedFileView file{ path };
+			const MappedMemoryView view = file.mapAll();
+
+			if ((not view) || (view.size != size))
+			{
+				return none;
+			}
+
+			return BitwiseHash(view.data, view.size);
+		}
+	}
+
+	namespace EngineResourceCache
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetInfoPath
+		//
+		////////////////////////////////////////////////////////////////
+
+		FilePath GetInfoPath(const FilePathView cachePath)
+		{
+			return (cachePath + U".cacheinfo");
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GetTemporaryPath
+		//
+		////////////////////////////////////////////////////////////////
+
+		FilePath GetTemporaryPath(const FilePathView cachePath)
+		{
+			return (cachePath + U".tmp");
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Validate
+		//
+		////////////////////////////////////////////////////////////////
+
+		ValidationResult Validate(const FilePathView cachePath, const uint64 sourceSize)
+		{
+			const FilePath infoPath = GetInfoPath(cachePath);
+			CacheInfo info;
+
+			if (not LoadCacheInfo(infoPath, info))
+			{
+				return ValidationResult::Invalid;
+			}
+
+			// リソースが更新されている
+			if ((sourceSize != 0) && (info.sourceSize != sourceSize))
+			{
+				return ValidationResult::Invalid;
+			}
+
+			// 書き込みが途中で中断されている
+			if (FileSystem::FileSize(cachePath) != info.contentSize)
+			{
+				return ValidationResult::Invalid;
+			}
+
+			const Optional<DateTime> writeTime = FileSystem::WriteTime(cachePath);
+
+			if (writeTime == info.contentWriteTime)
+			{
+				return ValidationResult::Unchanged;
+			}
+
+			// 更新日時が変わっている場合だけ、内容のハッシュ値を比較する
+			uint64 contentSize = 0;
+			const Optional<uint64> contentHash = HashFile(cachePath, contentSize);
+
+			if ((contentSize != info.contentSize)
+				|| (contentHash != info.contentHash))
+			{
+				return ValidationResult::Invalid;
+			}
+
+			if (writeTime)
+			{
+				info.contentWriteTime = *writeTime;
+				(void)SaveCacheInfo(infoPath, info);
+			}
+
+			return ValidationResult::Verified;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Store
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool Store(const FilePathView cachePath, const Blob& content, const uint64 sourceSize)
+		{
+			const FilePath temporaryPath = GetTemporaryPath(cachePath);
+
+			if (not content.save(temporaryPath))
+			{
+				FileSystem::Remove(temporaryPath);
+				return false;
+			}
+
+			return Commit(cachePath, sourceSize);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Commit
+		//
+		////////////////////////////////////////////////////////////////
+
+		bool Commit(const FilePathView cachePath, const uint64 sourceSize)
+		{
+			const FilePath temporaryPath = GetTemporaryPath(cachePath);
+
+			if (not FileSystem::Rename(temporaryPath, cachePath))
+			{
+				FileSystem::Remove(temporaryPath);
+				return false;
+			}
+
+			uint64 contentSize = 0;
+			const Optional<uint64> contentHash = HashFile(cachePath, contentSize);
+
+			if (not contentHash)
+			{
+				return false;
+			}
+
+			const CacheInfo info{
+				.sourceSize			= sourceSize,
+				.contentSize		= contentSize,
+				.contentHash		= *contentHash,
+				.contentWriteTime	= FileSystem::WriteTime(cachePath).value_or(DateTime{}),
+			};
+
+			return SaveCacheInfo(GetInfoPath(cachePath), info);
+		}
+	}
+}
@@ -0,0 +1,73 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+
+namespace s3d
+{
+	class Blob;
+
+	namespace EngineResourceCache
+	{
+		/// @brief キャッシュの検証結果
+		enum class ValidationResult : uint8
+		{
+			/// @brief サイズと更新日時が記録と一致した（内容のハッシュ値は計算していない）
+			Unchanged,
+
+			/// @brief 更新日時は記録と異なるが、内容のハッシュ値が一致した
+			Verified,
+
+			/// @brief キャッシュが存在しない、または記録と一致しない
+			Invalid,
+		};
+
+		/// @brief キャッシュの検証情報を保存するファイルのパスを返します。
+		/// @param cachePath キャッシュされたファイルのパス
+		/// @return 検証情報を保存するファイルのパス
+		[[nodiscard]]
+		FilePath GetInfoPath(FilePathView cachePath);
+
+		/// @brief キャッシュを書き込む一時ファイルのパスを返します。
+		/// @param cachePath キャッシュされたファイルのパス
+		/// @return 一時ファイルのパス
+		[[nodiscard]]
+		FilePath GetTemporaryPath(FilePathView cachePath);
+
+		/// @brief キャッシュされたファイルが、保存したときのものから変化していないかを検証します。
+		/// @param cachePath キャッシュされたファイルのパス
+		/// @param sourceSize 圧縮されたリソースのファイルサイズ。リソースが存在しない場合は 0
+		/// @return 検証結果
+		/// @remark サイズと更新日時が一致する場合、内容の読み込みとハッシュ値の計算を省略します。
+		/// @remark 更新日時だけが異なり内容が一致した場合は、次回から省略できるよう検証情報を更新します。
+		[[nodiscard]]
+		ValidationResult Validate(FilePathView cachePath, uint64 sourceSize);
+
+		/// @brief ファイルをキャッシュとして保存し、検証情報を記録します。
+		/// @param cachePath 保存先のパス
+		/// @param content 保存する内容
+		/// @param sourceSize 圧縮されたリソースのファイルサイズ
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		/// @remark 中断されても不完全なファイルが残らないよう、一時ファイルに書き込んでから置き換えます。
+		[[nodiscard]]
+		bool Store(FilePathView cachePath, const Blob& content, uint64 sourceSize);
+
+		/// @brief `GetTemporaryPath(cachePath)` に書き込み済みのファイルをキャッシュとして置き換え、検証情報を記録します。
+		/// @param cachePath 保存先のパス
+		/// @param sourceSize 圧縮されたリソースのファイルサイズ
+		/// @return 置き換えに成功した場合 true, それ以外の場合は false
+		/// @remark ハッシュ値はメモリマップしたファイルから計算するため、内容全体をメモリに読み込みません。
+		[[nodiscard]]
+		bool Commit(FilePathView cachePath, uint64 sourceSize);
+	}
+}
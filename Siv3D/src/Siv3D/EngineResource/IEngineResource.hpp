@@ -11,6 +11,7 @@
 
 # pragma once
 # include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
 
 namespace s3d
 {
@@ -24,5 +25,12 @@ namespace s3d
 		virtual ~ISiv3DEngineResource() = default;
 
 		virtual void init() = 0;
+
+		/// @brief エンジンのリソースを使用可能な状態にします。
+		/// @param resourcePath リソースのパス（例: U"font/min/siv3d-min.otf"）
+		/// @return 使用可能なファイルのパス。リソースが存在しない場合は空のパス
+		/// @remark 圧縮されたリソースは、最初に呼ばれたときにキャッシュディレクトリに展開されます。
+		[[nodiscard]]
+		virtual FilePath prepare(StringView resourcePath) = 0;
 	};
 }
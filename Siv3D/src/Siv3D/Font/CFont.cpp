@@ -653,6 +653,38 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	drawGlyphsAt
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CFont::drawGlyphsAt(const Font::IDType handleID, const StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Array<double>& xOffsets, const Vec2& pos, const double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect)
+	{
+		const auto& font = m_fonts[handleID];
+		const auto& fontInfo = font->getInfo();
+		const bool isColorFont = fontInfo.properties.hasColor;
+
+		if ((textStyle.type != TextStyle::Type::Default) && (not isColorFont))
+		{
+			if (fontInfo.renderingMethod == FontMethod::MSDF)
+			{
+				Graphics2D::SetMSDFParameters(textStyle, fontInfo.baseSize);
+			}
+		}
+
+		if (UseCustomShader(textStyle, isColorFont))
+		{
+			font->getGlyphCache().drawHorizontalAt(*font, s, resolvedGlyphs, xOffsets, pos, fontSize, textStyle, textEffect, isColorFont);
+		}
+		else
+		{
+			const ScopedCustomShader2D ps{ m_shader->getFontShader(fontInfo.renderingMethod, textStyle.type) };
+
+			font->getGlyphCache().drawHorizontalAt(*font, s, resolvedGlyphs, xOffsets, pos, fontSize, textStyle, textEffect, isColorFont);
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	regionBase
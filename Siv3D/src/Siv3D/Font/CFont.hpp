@@ -308,6 +308,14 @@ namespace s3d
 
 		RectF draw(Font::IDType handleID, StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, ReadingDirection readingDirection) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	drawGlyphsAt
+		//
+		////////////////////////////////////////////////////////////////
+
+		void drawGlyphsAt(Font::IDType handleID, StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Array<double>& xOffsets, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	region
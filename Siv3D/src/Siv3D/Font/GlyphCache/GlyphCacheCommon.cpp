@@ -9,6 +9,8 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/ITextEffect.hpp>
+# include "GlyphCacheCommon.hpp"
 # include "../FontData.hpp"
 
 namespace s3d
@@ -80,4 +82,41 @@ namespace s3d
 
 		return true;
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	GlyphBatch
+	//
+	////////////////////////////////////////////////////////////////
+
+	void GlyphBatch::push(const TextureRegion& textureRegion, const GlyphContext& glyphContext)
+	{
+		const Vec2& pos = glyphContext.pos;
+
+		m_glyphQuads.push_back(GlyphQuad{ FloatRect{ pos.x, pos.y, (pos.x + textureRegion.size.x), (pos.y + textureRegion.size.y) }, textureRegion.uvRect });
+		m_glyphContexts.push_back(glyphContext);
+	}
+
+	void GlyphBatch::flush(const Texture& texture, const ITextEffect& textEffect)
+	{
+		if (m_glyphQuads.isEmpty())
+		{
+			return;
+		}
+
+		// drawBatch() の中から同じバッファに push() や flush() が呼ばれても壊れないよう、描画中はローカル変数に移しておく
+		Array<GlyphQuad> glyphQuads = std::exchange(m_glyphQuads, {});
+		Array<GlyphContext> glyphContexts = std::exchange(m_glyphContexts, {});
+
+		textEffect.drawBatch(texture, glyphQuads, glyphContexts);
+
+		// 確保済みの容量を再利用するため、空にしたうえでバッファを戻す
+		if (m_glyphQuads.isEmpty())
+		{
+			glyphQuads.clear();
+			glyphContexts.clear();
+			m_glyphQuads = std::move(glyphQuads);
+			m_glyphContexts = std::move(glyphContexts);
+		}
+	}
 }
@@ -14,10 +14,15 @@
 # include <Siv3D/PointVector.hpp>
 # include <Siv3D/GlyphIndex.hpp>
 # include <Siv3D/ReadingDirection.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/TextureRegion.hpp>
+# include <Siv3D/GlyphContext.hpp>
+# include <Siv3D/GlyphQuad.hpp>
 
 namespace s3d
 {
 	struct FontFaceInfo;
+	struct ITextEffect;
 
 	[[nodiscard]]
 	double GetTabAdvance(double spaceWidth, double scale, double xBegin, double currentX, int32 tabSize);
@@ -27,4 +32,29 @@ namespace s3d
 
 	[[nodiscard]]
 	bool ConsumeControlCharacterVertical(char32 ch, Vec2& penPos, int32& lineCount, const Vec2& basePos, double scale, double lineHeightScale, const FontFaceInfo& info);
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	GlyphBatch
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief ITextEffect::drawBatch() にまとめて渡すグリフを蓄積するバッファ
+	class GlyphBatch
+	{
+	public:
+
+		void push(const TextureRegion& textureRegion, const GlyphContext& glyphContext);
+
+		/// @brief 蓄積したグリフを描画し、バッファを空にします。
+		/// @param texture グリフが格納されているテクスチャ
+		/// @param textEffect テキストエフェクト
+		void flush(const Texture& texture, const ITextEffect& textEffect);
+
+	private:
+
+		Array<GlyphQuad> m_glyphQuads;
+
+		Array<GlyphContext> m_glyphContexts;
+	};
 }
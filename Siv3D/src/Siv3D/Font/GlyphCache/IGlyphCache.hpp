@@ -79,6 +79,17 @@ namespace s3d
 		[[nodiscard]]
 		virtual std::pair<double, double> processHorizontalFallback(TextOperation textOperation, FontData& font, const ResolvedGlyph& resolvedGlyph, bool useBasePos, const Vec2& pos, const double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, int32 index, int32 totalGlyphCount, bool isColorGlyph, ReadingDirection readingDirection) = 0;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	drawHorizontalAt
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 行内の X 座標が計算済みのグリフを横書きで描画します。
+		/// @param xOffsets 各グリフのペン位置の、pos からの X 方向のオフセット
+		/// @param pos 行の左上の座標
+		virtual void drawHorizontalAt(FontData& font, StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Array<double>& xOffsets, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, bool isColorGlyph) = 0;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	processVertical
@@ -98,6 +98,9 @@ namespace s3d
 					nextPos.y += (info.ascender * scale);
 				}
 
+				// 描画順を保つため、フォールバックフォントのグリフより前に蓄積したグリフを描画する
+				m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
 				auto [w, adv] = (isDraw ? SIV3D_ENGINE(Font)->drawBaseFallback(font.getFallbackFontID(fallbackIndex), resolvedGlyph, nextPos, fontSize, textStyle, textEffect, index, totalGlyphCount, readingDirection)
 					: SIV3D_ENGINE(Font)->regionBaseFallback(font.getFallbackFontID(fallbackIndex), resolvedGlyph, nextPos, fontSize, textStyle, readingDirection));
 
@@ -120,7 +123,7 @@ namespace s3d
 				{
 					if (isDraw)
 					{
-						textEffect.draw(textureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+						m_glyphBatch.push(textureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 					}
 
 					w = textureRegion.region(drawPos).w;
@@ -129,7 +132,7 @@ namespace s3d
 				{
 					if (isDraw)
 					{
-						textEffect.draw(textureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+						m_glyphBatch.push(textureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 					}
 
 					w = textureRegion.scaled(scale).region(drawPos).w;
@@ -146,6 +149,9 @@ namespace s3d
 		const Vec2 topLeft = (useBasePos ? pos.movedBy(0, -info.ascender * scale) : pos);
 		const double width = (xMax - basePos.x);
 		const double height = ((info.height() * scale * textStyle.lineSpacing) * lineCount);
+
+		m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
 		return{ topLeft, width, height };
 	}
 
@@ -209,6 +215,65 @@ namespace s3d
 		return{ w, advance };
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	drawHorizontalAt
+	//
+	////////////////////////////////////////////////////////////////
+
+	void MSDFGlyphCache::drawHorizontalAt(FontData& font, const StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Array<double>& xOffsets, const Vec2& pos, const double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, const bool isColorGlyph)
+	{
+		if (not prerender(font, resolvedGlyphs, true, ReadingDirection::LeftToRight))
+		{
+			return;
+		}
+
+		const auto& info = font.getInfo();
+		const double scale = (fontSize / info.baseSize);
+		const double top = pos.y;
+		const double bottom = (top + info.height() * scale);
+		const bool pixelPerfect = (fontSize == info.baseSize);
+		const int32 totalGlyphCount = static_cast<int32>(resolvedGlyphs.size());
+
+		for (auto&& [index, resolvedGlyph] : Indexed(resolvedGlyphs))
+		{
+			// タブや改行などの制御文字の幅は xOffsets に反映済み
+			if (IsControl(s[resolvedGlyph.pos]))
+			{
+				continue;
+			}
+
+			const Vec2 penPos{ (pos.x + xOffsets[index]), pos.y };
+
+			// フォールバックフォント
+			if (resolvedGlyph.fontIndex != 0)
+			{
+				const size_t fallbackIndex = (resolvedGlyph.fontIndex - 1);
+
+				// 描画順を保つため、フォールバックフォントのグリフより前に蓄積したグリフを描画する
+				m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
+				SIV3D_ENGINE(Font)->drawBaseFallback(font.getFallbackFontID(fallbackIndex), resolvedGlyph, penPos.movedBy(0, (info.ascender * scale)), fontSize, textStyle, textEffect, static_cast<int32>(index), totalGlyphCount, ReadingDirection::LeftToRight);
+				continue;
+			}
+
+			const auto& cache = m_glyphCacheManager.get(resolvedGlyph.glyphIndex, ReadingDirection::LeftToRight);
+			const TextureRegion textureRegion = m_glyphCacheManager.getTexture()(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+			const Vec2 drawPos = (penPos + cache.info.getOffset(scale));
+
+			if (pixelPerfect)
+			{
+				m_glyphBatch.push(textureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, ReadingDirection::LeftToRight, isColorGlyph });
+			}
+			else
+			{
+				m_glyphBatch.push(textureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, ReadingDirection::LeftToRight, isColorGlyph });
+			}
+		}
+
+		m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	processVertical
@@ -257,6 +322,10 @@ namespace s3d
 				const size_t fallbackIndex = (resolvedGlyph.fontIndex - 1);
 
 				Vec2 nextPos = penPos;
+
+				// 描画順を保つため、フォールバックフォントのグリフより前に蓄積したグリフを描画する
+				m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
 				auto [h, adv] = (isDraw ? SIV3D_ENGINE(Font)->drawBaseFallback(font.getFallbackFontID(fallbackIndex), resolvedGlyph, nextPos, fontSize, textStyle, textEffect, index, totalGlyphCount, readingDirection)
 					: SIV3D_ENGINE(Font)->regionBaseFallback(font.getFallbackFontID(fallbackIndex), resolvedGlyph, nextPos, fontSize, textStyle, readingDirection));
 
@@ -280,7 +349,7 @@ namespace s3d
 				{
 					if (isDraw)
 					{
-						textEffect.draw(textureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+						m_glyphBatch.push(textureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 					}
 
 					h = textureRegion.region(drawPos).h;
@@ -289,7 +358,7 @@ namespace s3d
 				{
 					if (isDraw)
 					{
-						textEffect.draw(textureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+						m_glyphBatch.push(textureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 					}
 
 					h = textureRegion.scaled(scale).region(drawPos).h;
@@ -307,6 +376,9 @@ namespace s3d
 		const double left = (right - (info.height() * scale * textStyle.lineSpacing * lineCount));
 		const double top = pos.y;
 		const double bottom = yMax;
+
+		m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
 		return{ left, top, (right - left), (bottom - top) };
 	}
 
@@ -719,6 +791,10 @@ namespace s3d
 				if (resolvedGlyph.fontIndex != 0)
 				{
 					const size_t fallbackIndex = (resolvedGlyph.fontIndex - 1);
+
+					// 描画順を保つため、フォールバックフォントのグリフより前に蓄積したグリフを描画する
+					m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
 					SIV3D_ENGINE(Font)->drawBaseFallback(font.getFallbackFontID(fallbackIndex), resolvedGlyph, penPosInfo.drawPos, fontSize, textStyle, textEffect, index, totalGlyphCount, readingDirection);
 				}
 				else
@@ -730,11 +806,11 @@ namespace s3d
 
 					if (pixelPerfect)
 					{
-						textEffect.draw(textureRegion, GlyphContext{ penPosInfo.drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+						m_glyphBatch.push(textureRegion, GlyphContext{ penPosInfo.drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 					}
 					else
 					{
-						textEffect.draw(textureRegion.scaled(scale), GlyphContext{ penPosInfo.drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+						m_glyphBatch.push(textureRegion.scaled(scale), GlyphContext{ penPosInfo.drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 					}
 				}
 
@@ -749,17 +825,19 @@ namespace s3d
 
 				if (pixelPerfect)
 				{
-					textEffect.draw(periodTextureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+					m_glyphBatch.push(periodTextureRegion, GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 				}
 				else
 				{
-					textEffect.draw(periodTextureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
+					m_glyphBatch.push(periodTextureRegion.scaled(scale), GlyphContext{ drawPos, index, totalGlyphCount, top, bottom, readingDirection, isColorGlyph });
 				}
 
 				++index;
 			}
 		}
 
+		m_glyphBatch.flush(m_glyphCacheManager.getTexture(), textEffect);
+
 		return{ (not isOverflow), rect };
 	}
 
@@ -13,6 +13,7 @@
 # include <Siv3D/Font.hpp>
 # include "IGlyphCache.hpp"
 # include "GlyphCacheManager.hpp"
+# include "GlyphCacheCommon.hpp"
 
 namespace s3d
 {
@@ -61,6 +62,14 @@ namespace s3d
 
 		std::pair<double, double> processHorizontalFallback(TextOperation textOperation, FontData& font, const ResolvedGlyph& resolvedGlyph, bool useBasePos, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, int32 index, int32 totalGlyphCount, bool isColorGlyph, ReadingDirection readingDirection) override;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	drawHorizontalAt
+		//
+		////////////////////////////////////////////////////////////////
+
+		void drawHorizontalAt(FontData& font, StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Array<double>& xOffsets, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, bool isColorGlyph) override;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	processVertical
@@ -135,6 +144,9 @@ namespace s3d
 
 		GlyphCacheManager m_glyphCacheManager{ DefaultBufferThickness };
 
+		/// @brief 描画するグリフを 1 回の ITextEffect::drawBatch() にまとめるためのバッファ
+		GlyphBatch m_glyphBatch;
+
 		[[nodiscard]]
 		bool prerender(FontData& font, const Array<ResolvedGlyph>& resolvedGlyphs, bool isMainFont, ReadingDirection readingDirection);
 	};
@@ -305,6 +305,14 @@ namespace s3d
 
 		virtual RectF draw(Font::IDType handleID, StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect, ReadingDirection readingDirection) = 0;
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	drawGlyphsAt
+		//
+		////////////////////////////////////////////////////////////////
+
+		virtual void drawGlyphsAt(Font::IDType handleID, StringView s, const Array<ResolvedGlyph>& resolvedGlyphs, const Array<double>& xOffsets, const Vec2& pos, double fontSize, const TextStyle& textStyle, const ITextEffect& textEffect) = 0;
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	regionBase
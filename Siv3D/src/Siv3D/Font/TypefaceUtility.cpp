@@ -9,16 +9,24 @@
 //
 //-----------------------------------------------
 
-# include <Siv3D/CacheDirectory/CacheDirectory.hpp>
-# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/EngineResource/IEngineResource.hpp>
+# include <Siv3D/Engine/Siv3DEngine.hpp>
 # include "TypefaceUtility.hpp"
 
 namespace s3d
 {
-	TypefaceInfo GetTypefaceInfo(const Typeface typeface, const FontMethod fontMethod)
+	namespace
 	{
-		const FilePath fontFilePath = (CacheDirectory::Engine() + U"font/");
+		/// @brief エンジンのフォントファイルを、必要であれば展開してから、そのパスを返します。
+		[[nodiscard]]
+		static FilePath PrepareFont(const StringView path)
+		{
+			return SIV3D_ENGINE(EngineResource)->prepare(U"font/" + path);
+		}
+	}
 
+	TypefaceInfo GetTypefaceInfo(const Typeface typeface, const FontMethod fontMethod)
+	{
 		switch (typeface)
 		{
 		case Typeface::CJK_Regular_JP:
@@ -27,18 +35,18 @@ namespace s3d
 		case Typeface::CJK_Regular_TC:
 		case Typeface::CJK_Regular_HK:
 			{
-				if (const FilePath pathCJK = (fontFilePath + U"noto-cjk/NotoSansCJK-Medium.ttc"); FileSystem::Exists(pathCJK))
+				if (const FilePath pathCJK = PrepareFont(U"noto-cjk/NotoSansCJK-Medium.ttc"))
 				{
 					const uint32 index = (FromEnum(typeface) - FromEnum(Typeface::CJK_Regular_JP));
 					return{ pathCJK, index, U"", fontMethod };
 				}
 
-				if (const FilePath pathJP = (fontFilePath + U"noto-cjk/NotoSansJP-Medium.otf"); FileSystem::Exists(pathJP))
+				if (const FilePath pathJP = PrepareFont(U"noto-cjk/NotoSansJP-Medium.otf"))
 				{
 					return{ pathJP, 0, U"", fontMethod };
 				}
 
-				if (const FilePath pathMin = (fontFilePath + U"min/siv3d-min.otf"); FileSystem::Exists(pathMin))
+				if (const FilePath pathMin = PrepareFont(U"min/siv3d-min.otf"))
 				{
 					return{ pathMin, 0, U"", fontMethod };
 				}
@@ -46,23 +54,23 @@ namespace s3d
 				break;
 			}
 		case Typeface::ColorEmoji:
-			return{ (fontFilePath + U"noto-emoji/Noto-COLRv1.ttf"), 0, U"", FontMethod::Bitmap };
+			return{ PrepareFont(U"noto-emoji/Noto-COLRv1.ttf"), 0, U"", FontMethod::Bitmap };
 		case Typeface::Mplus_Thin:
-			return{ (fontFilePath + U"mplus/mplus-1p-thin.ttf"), 0,  U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-thin.ttf"), 0,  U"", fontMethod };
 		case Typeface::Mplus_Light:
-			return{ (fontFilePath + U"mplus/mplus-1p-light.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-light.ttf"), 0, U"", fontMethod };
 		case Typeface::Mplus_Regular:
-			return{ (fontFilePath + U"mplus/mplus-1p-regular.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-regular.ttf"), 0, U"", fontMethod };
 		case Typeface::Mplus_Medium:
-			return{ (fontFilePath + U"mplus/mplus-1p-medium.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-medium.ttf"), 0, U"", fontMethod };
 		case Typeface::Mplus_Bold:
-			return{ (fontFilePath + U"mplus/mplus-1p-bold.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-bold.ttf"), 0, U"", fontMethod };
 		case Typeface::Mplus_Heavy:
-			return{ (fontFilePath + U"mplus/mplus-1p-heavy.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-heavy.ttf"), 0, U"", fontMethod };
 		case Typeface::Mplus_Black:
-			return{ (fontFilePath + U"mplus/mplus-1p-black.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"mplus/mplus-1p-black.ttf"), 0, U"", fontMethod };
 		case Typeface::Icon_MaterialDesign:
-			return{ (fontFilePath + U"materialdesignicons/materialdesignicons-webfont.ttf"), 0, U"", fontMethod };
+			return{ PrepareFont(U"materialdesignicons/materialdesignicons-webfont.ttf"), 0, U"", fontMethod };
 		}
 
 		return{ U"", 0, U"", FontMethod::Bitmap };
@@ -0,0 +1,54 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Format.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 再利用する作業用バッファの最大容量（要素数）
+		/// @remark これを超える容量のバッファは、長い文字列を一度変換しただけでメモリを使い続けないように破棄する
+		constexpr size_t MaxFormatBufferCapacity = 4096;
+
+		thread_local String t_formatBuffer;
+	}
+
+	namespace detail
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	AcquireFormatBuffer
+		//
+		////////////////////////////////////////////////////////////////
+
+		String AcquireFormatBuffer() noexcept
+		{
+			String buffer = std::move(t_formatBuffer);
+			buffer.clear();
+			return buffer;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ReleaseFormatBuffer
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ReleaseFormatBuffer(String&& buffer) noexcept
+		{
+			if (buffer.capacity() <= MaxFormatBufferCapacity)
+			{
+				t_formatBuffer = std::move(buffer);
+			}
+		}
+	}
+}
@@ -11,6 +11,7 @@
 
 # include <Siv3D/IImageDecoder.hpp>
 # include <Siv3D/BinaryFileReader.hpp>
+# include <Siv3D/ImageFormat/ScanlineResampler.hpp>
 
 namespace s3d
 {
@@ -50,6 +51,55 @@ namespace s3d
 		return decode(std::move(reader), path, premultiplyAlpha);
 	}
 
+	Image IImageDecoder::decode(const FilePathView path, const ImageDecodeOptions& options) const
+	{
+		std::unique_ptr<BinaryFileReader> reader = std::make_unique<BinaryFileReader>(path);
+
+		if (not reader->isOpen())
+		{
+			return{};
+		}
+
+		return decode(std::move(reader), path, options);
+	}
+
+	Image IImageDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const ImageDecodeOptions& options) const
+	{
+		if (not reader)
+		{
+			return{};
+		}
+
+		// 画像全体を元のサイズのままデコードする場合は、従来のデコード処理をそのまま使う
+		if (const auto imageInfo = getImageInfo(*reader, pathHint);
+			imageInfo && options.isFullDecode(imageInfo->size))
+		{
+			return decode(std::move(reader), pathHint, options.premultiplyAlpha);
+		}
+
+		// 縮小はアルファ乗算前の画像で行う
+		Image image = decode(std::move(reader), pathHint, PremultiplyAlpha::No);
+
+		if (image && (not options.isFullDecode(image.size())))
+		{
+			ScanlineResampler resampler{ image.size(), options };
+
+			for (int32 y = 0; y < image.height(); ++y)
+			{
+				resampler.pushRow(y, image[y]);
+			}
+
+			image = resampler.finish();
+		}
+
+		if (image && options.premultiplyAlpha)
+		{
+			image.premultiplyAlpha();
+		}
+
+		return image;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	decodeGray16
@@ -11,10 +11,9 @@
 
 # include "CIcon.hpp"
 # include <Siv3D/EngineLog.hpp>
-# include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Font/IFont.hpp>
 # include <Siv3D/Engine/Siv3DEngine.hpp>
-# include <Siv3D/CacheDirectory/CacheDirectory.hpp>
+# include <Siv3D/EngineResource/IEngineResource.hpp>
 # include <Siv3D/Font/GlyphRenderer/BitmapGlyphRenderer.hpp>
 # include <Siv3D/Font/GlyphRenderer/MSDFGlyphRenderer.hpp>
 
@@ -81,9 +80,9 @@ namespace s3d
 	{
 		LOG_SCOPED_DEBUG("CIcon::init()");
 
-		const FilePath iconFilePath = (CacheDirectory::Engine() + U"font/materialdesignicons/materialdesignicons-webfont.ttf");
+		const FilePath iconFilePath = SIV3D_ENGINE(EngineResource)->prepare(U"font/materialdesignicons/materialdesignicons-webfont.ttf");
 
-		if (not FileSystem::Exists(iconFilePath))
+		if (not iconFilePath)
 		{
 			LOG_INFO("Icon font file not found");
 			return;
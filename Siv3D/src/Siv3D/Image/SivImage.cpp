@@ -319,9 +319,9 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	Blob Image::encodePNG(const PNGFilter filter) const
+	Blob Image::encodePNG(const PNGFilter filter, const Parallelize parallelize) const
 	{
-		return PNGEncoder{}.encode(*this, filter);
+		return PNGEncoder{}.encode(*this, filter, parallelize);
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 # include <Siv3D/ImageFormat/BCnDecoder.hpp>
 # include <Siv3D/ImageFormat/SVGDecoder.hpp>
 # include <Siv3D/ImageFormat/TGADecoder.hpp>
+# include <Siv3D/ImageFormat/QOIDecoder.hpp>
 
 namespace s3d
 {
@@ -119,6 +120,7 @@ namespace s3d
 		m_decoders.push_back(std::make_unique<BCnDecoder>());
 		m_decoders.push_back(std::make_unique<SVGDecoder>());
 		m_decoders.push_back(std::make_unique<TGADecoder>());
+		m_decoders.push_back(std::make_unique<QOIDecoder>());
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -211,7 +213,7 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	Image CImageDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const PremultiplyAlpha premultiplyAlpha, const StringView decoderName)
+	Image CImageDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const ImageDecodeOptions& options, const StringView decoderName)
 	{
 		LOG_SCOPED_DEBUG("CImageDecoder::decode()");
 
@@ -229,7 +231,7 @@ namespace s3d
 
 		LOG_TRACE(fmt::format("Image decoder name: {}", (*it)->name().toUTF8()));
 
-		return (*it)->decode(std::move(reader), pathHint, premultiplyAlpha);
+		return (*it)->decode(std::move(reader), pathHint, options);
 	}
 
 	////////////////////////////////////////////////////////////////
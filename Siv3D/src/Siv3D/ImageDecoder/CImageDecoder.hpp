@@ -32,7 +32,7 @@ namespace s3d
 
 		Optional<ImageInfo> getImageInfo(const IReader& reader, FilePathView pathHint, StringView decoderName) override;
 
-		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha, StringView decoderName) override;
+		Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, const ImageDecodeOptions& options, StringView decoderName) override;
 
 		Grid<uint16> decodeGray16(std::unique_ptr<IReader> reader, FilePathView pathHint, StringView decoderName) override;
 
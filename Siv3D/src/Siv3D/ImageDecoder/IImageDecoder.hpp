@@ -34,7 +34,7 @@ namespace s3d
 
 		virtual Optional<ImageInfo> getImageInfo(const IReader& reader, FilePathView pathHint, StringView decoderName) = 0;
 
-		virtual Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, PremultiplyAlpha premultiplyAlpha, StringView decoderName) = 0;
+		virtual Image decode(std::unique_ptr<IReader> reader, FilePathView pathHint, const ImageDecodeOptions& options, StringView decoderName) = 0;
 
 		virtual Grid<uint16> decodeGray16(std::unique_ptr<IReader> reader, FilePathView pathHint, StringView decoderName) = 0;
 	};
@@ -77,6 +77,26 @@ namespace s3d
 		}
 
 		Image Decode(const FilePathView path, const PremultiplyAlpha premultiplyAlpha, const StringView decoderName)
+		{
+			return Decode(path, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha }, decoderName);
+		}
+
+		Image Decode(std::unique_ptr<IReader> reader, const PremultiplyAlpha premultiplyAlpha, const ImageFormat imageFormat)
+		{
+			return Decode(std::move(reader), premultiplyAlpha, GetDecoderName(imageFormat));
+		}
+
+		Image Decode(std::unique_ptr<IReader> reader, const PremultiplyAlpha premultiplyAlpha, const StringView decoderName)
+		{
+			return Decode(std::move(reader), ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha }, decoderName);
+		}
+
+		Image Decode(const FilePathView path, const ImageDecodeOptions& options, const ImageFormat imageFormat)
+		{
+			return Decode(path, options, GetDecoderName(imageFormat));
+		}
+
+		Image Decode(const FilePathView path, const ImageDecodeOptions& options, const StringView decoderName)
 		{
 			std::unique_ptr<BinaryFileReader> reader = std::make_unique<BinaryFileReader>(path);
 
@@ -85,17 +105,17 @@ namespace s3d
 				return{};
 			}
 
-			return SIV3D_ENGINE(ImageDecoder)->decode(std::move(reader), path, premultiplyAlpha, decoderName);
+			return SIV3D_ENGINE(ImageDecoder)->decode(std::move(reader), path, options, decoderName);
 		}
 
-		Image Decode(std::unique_ptr<IReader> reader, const PremultiplyAlpha premultiplyAlpha, const ImageFormat imageFormat)
+		Image Decode(std::unique_ptr<IReader> reader, const ImageDecodeOptions& options, const ImageFormat imageFormat)
 		{
-			return Decode(std::move(reader), premultiplyAlpha, GetDecoderName(imageFormat));
+			return Decode(std::move(reader), options, GetDecoderName(imageFormat));
 		}
 
-		Image Decode(std::unique_ptr<IReader> reader, const PremultiplyAlpha premultiplyAlpha, const StringView decoderName)
+		Image Decode(std::unique_ptr<IReader> reader, const ImageDecodeOptions& options, const StringView decoderName)
 		{
-			return SIV3D_ENGINE(ImageDecoder)->decode(std::move(reader), {}, premultiplyAlpha, decoderName);
+			return SIV3D_ENGINE(ImageDecoder)->decode(std::move(reader), {}, options, decoderName);
 		}
 
 		////////////////////////////////////////////////////////////////
@@ -13,6 +13,8 @@
 # include <Siv3D/BinaryFileWriter.hpp>
 # include <Siv3D/MemoryWriter.hpp>
 # include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Interpolation.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <ThirdParty/bc7enc_rdo/rdo_bc_encoder.h>
 
@@ -51,262 +53,448 @@ namespace s3d
 			writer.write(header);
 		}
 
-		static void EncodeBC1(IWriter& writer, const Image& image)
+		////////////////////////////////////////////////////////////////
+		//
+		//	BlockFormat
+		//
+		////////////////////////////////////////////////////////////////
+
+		enum class BlockFormat : uint8
 		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+			BC1,
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			BC3,
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			BC4,
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 8> block{};
+			BC5,
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			BC7,
+		};
+
+		/// @brief 1 ブロックあたりのバイト数を返します。
+		[[nodiscard]]
+		static constexpr uint32 GetBlockBytes(const BlockFormat format) noexcept
+		{
+			return (((format == BlockFormat::BC1) || (format == BlockFormat::BC4)) ? 8 : 16);
+		}
+
+		static void WriteHeader(IWriter& writer, const BlockFormat format, const uint32 width, const uint32 height, const uint32 mipCount)
+		{
+			switch (format)
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
-				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+			case BlockFormat::BC1:
+				WriteDDSHeader(writer, PIXEL_FMT_DXT1, width, height, 4, mipCount);
+				break;
+			case BlockFormat::BC3:
+				WriteDDSHeader(writer, PIXEL_FMT_DXT5, width, height, 8, mipCount);
+				break;
+			case BlockFormat::BC4:
+				WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '4', 'U')), width, height, 4, mipCount);
+				break;
+			case BlockFormat::BC5:
+				WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '5', 'U')), width, height, 8, mipCount);
+				break;
+			case BlockFormat::BC7:
+				WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('D', 'X', '1', '0')), width, height, 8, mipCount);
+				WriteDX10Header(writer, DXGI_FORMAT_BC7_UNORM);
+				break;
+			}
+		}
 
-					for (uint32 y = 0; y < 4; ++y)
-					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
+		////////////////////////////////////////////////////////////////
+		//
+		//	LoadBlock
+		//
+		////////////////////////////////////////////////////////////////
 
-						for (uint32 x = 0; x < 4; ++x)
-						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
+		/// @brief 画像から 4x4 ブロックの画素を読み込みます。画像の範囲外は端の画素で埋めます。
+		static void LoadBlock(const Image& image, const uint32 bx, const uint32 by, Color* pixels)
+		{
+			const uint32 maxX = (image.width() - 1);
+			const uint32 maxY = (image.height() - 1);
+			const uint32 baseX = (bx * 4);
+			const uint32 baseY = (by * 4);
 
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
-						}
-					}
+			for (uint32 y = 0; y < 4; ++y)
+			{
+				const Color* pSrcLine = image[Min((baseY + y), maxY)];
 
-					rgbcx::encode_bc1(rgbcx::MAX_LEVEL, block.data(), pixels, true, false);
-					writer.write(block);
+				for (uint32 x = 0; x < 4; ++x)
+				{
+					*pixels++ = pSrcLine[Min((baseX + x), maxX)];
 				}
 			}
 		}
 
-		static void EncodeBC3(IWriter& writer, const Image& image)
-		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+		////////////////////////////////////////////////////////////////
+		//
+		//	BlockEncoder
+		//
+		////////////////////////////////////////////////////////////////
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+		/// @brief 品質設定に応じて 4x4 ブロックを圧縮します。
+		/// @remark rgbcx と bc7enc は初期化後はスレッドセーフであるため、複数のスレッドから同時に encode() を呼び出せます。
+		class BlockEncoder
+		{
+		public:
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			BlockEncoder(const BlockFormat format, const BCnQuality quality)
+				: m_format{ format }
+			{
+				bc7enc_compress_block_params_init(&m_bc7Params);
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 16> block{};
+				switch (quality)
+				{
+				case BCnQuality::Fastest:
+					m_bc1Level = rgbcx::MIN_LEVEL;
+					m_hq = false;
+					m_bc7Params.m_max_partitions = 0;
+					m_bc7Params.m_try_least_squares = false;
+					break;
+				case BCnQuality::Fast:
+					m_bc1Level = 6;
+					m_hq = false;
+					m_bc7Params.m_max_partitions = 16;
+					m_bc7Params.m_try_least_squares = false;
+					break;
+				case BCnQuality::Default:
+					break;
+				case BCnQuality::High:
+					m_bc7Params.m_uber_level = 2;
+					break;
+				case BCnQuality::Highest:
+					m_bc7Params.m_uber_level = BC7ENC_MAX_UBER_LEVEL;
+					break;
+				}
+			}
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			void encode(void* pDst, const Color* pixels) const
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
-				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+				const uint8* pPixels = reinterpret_cast<const uint8*>(pixels);
 
-					for (uint32 y = 0; y < 4; ++y)
+				switch (m_format)
+				{
+				case BlockFormat::BC1:
+					rgbcx::encode_bc1(m_bc1Level, pDst, pPixels, true, false);
+					break;
+				case BlockFormat::BC3:
+					if (m_hq)
 					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
-
-						for (uint32 x = 0; x < 4; ++x)
-						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
-						}
+						rgbcx::encode_bc3_hq(m_bc1Level, pDst, pPixels);
 					}
-
-					rgbcx::encode_bc3_hq(rgbcx::MAX_LEVEL, block.data(), pixels);
-					writer.write(block);
+					else
+					{
+						rgbcx::encode_bc3(m_bc1Level, pDst, pPixels);
+					}
+					break;
+				case BlockFormat::BC4:
+					if (m_hq)
+					{
+						rgbcx::encode_bc4_hq(pDst, pPixels);
+					}
+					else
+					{
+						rgbcx::encode_bc4(pDst, pPixels);
+					}
+					break;
+				case BlockFormat::BC5:
+					if (m_hq)
+					{
+						rgbcx::encode_bc5_hq(pDst, pPixels);
+					}
+					else
+					{
+						rgbcx::encode_bc5(pDst, pPixels);
+					}
+					break;
+				case BlockFormat::BC7:
+					bc7enc_compress_block(pDst, pPixels, &m_bc7Params);
+					break;
 				}
 			}
-		}
 
-		static void EncodeBC4(IWriter& writer, const Image& image)
-		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+		private:
+
+			BlockFormat m_format;
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			uint32 m_bc1Level = rgbcx::MAX_LEVEL;
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			bool m_hq = true;
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 8> block{};
+			bc7enc_compress_block_params m_bc7Params;
+		};
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+		////////////////////////////////////////////////////////////////
+		//
+		//	ReduceEntropy
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief RDO で 1 回の ert::reduce_entropy() に渡すブロック数の上限
+		/// @remark この単位で並列に処理します。小さすぎると LZ の一致候補が減り、効果が下がります。
+		constexpr uint32 RDOChunkBlocks = 8192;
+
+		/// @brief BC1 ブロックを展開します。エンコード時と同じく、3 色モードの透明（黒）画素を使う候補は拒否します。
+		static bool UnpackBC1(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
+		{
+			if (rgbcx::unpack_bc1(pBlock, pPixels, true, rgbcx::bc1_approx_mode::cBC1Ideal))
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
-				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+				const rgbcx::bc1_block* pBC1Block = static_cast<const rgbcx::bc1_block*>(pBlock);
 
-					for (uint32 y = 0; y < 4; ++y)
+				for (uint32 y = 0; y < 4; ++y)
+				{
+					for (uint32 x = 0; x < 4; ++x)
 					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
-
-						for (uint32 x = 0; x < 4; ++x)
+						if (pBC1Block->get_selector(x, y) == 3)
 						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
+							return false;
 						}
 					}
-
-					rgbcx::encode_bc4_hq(block.data(), pixels);
-					writer.write(block);
 				}
 			}
+
+			return true;
 		}
 
-		static void EncodeBC5(IWriter& writer, const Image& image)
+		/// @brief BC3 のカラーブロックを展開します。BC3 では 3 色モードを使えないため、それを使う候補は拒否します。
+		static bool UnpackBC3Color(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
 		{
-			const uint32 width = image.width();
-			const uint32 height = image.height();
+			return (not rgbcx::unpack_bc1(pBlock, pPixels, true, rgbcx::bc1_approx_mode::cBC1Ideal));
+		}
+
+		static bool UnpackBC4(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
+		{
+			std::memset(pPixels, 0, (sizeof(ert::color_rgba) * 16));
+			rgbcx::unpack_bc4(pBlock, reinterpret_cast<uint8*>(pPixels), 4);
+			return true;
+		}
+
+		static bool UnpackBC7(const void* pBlock, ert::color_rgba* pPixels, uint32, void*)
+		{
+			return bc7decomp::unpack_bc7(pBlock, reinterpret_cast<bc7decomp::color_rgba*>(pPixels));
+		}
+
+		/// @brief ブロック内の 1 つの領域に対する RDO の設定
+		struct RDOPass
+		{
+			/// @brief ブロック内のオフセット（バイト）
+			uint32 offset;
+
+			/// @brief 領域のサイズ（バイト）
+			uint32 size;
+
+			/// @brief 比較に使う成分数
+			uint32 numComponents;
+
+			/// @brief 単一チャンネルの場合はそのインデックス、RGB(A) を使う場合は -1
+			int32 channel;
+
+			ert::pUnpack_block_func unpack;
+
+			/// @brief 平滑なブロックの誤差に掛ける倍率の範囲と、それが最大になる lambda
+			float minSmoothScale, maxSmoothScale, lambdaRange;
+		};
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+		[[nodiscard]]
+		static std::span<const RDOPass> GetRDOPasses(const BlockFormat format)
+		{
+			static constexpr RDOPass BC1Passes[] = { { 0, 8, 3, -1, UnpackBC1, 15.0f, 50.0f, 8.0f } };
+			static constexpr RDOPass BC3Passes[] = { { 0, 8, 1, 3, UnpackBC4, 10.0f, 30.0f, 4.0f }, { 8, 8, 3, -1, UnpackBC3Color, 15.0f, 50.0f, 8.0f } };
+			static constexpr RDOPass BC4Passes[] = { { 0, 8, 1, 0, UnpackBC4, 10.0f, 30.0f, 4.0f } };
+			static constexpr RDOPass BC5Passes[] = { { 0, 8, 1, 0, UnpackBC4, 10.0f, 30.0f, 4.0f }, { 8, 8, 1, 1, UnpackBC4, 10.0f, 30.0f, 4.0f } };
+			static constexpr RDOPass BC7Passes[] = { { 0, 16, 4, -1, UnpackBC7, 15.0f, 50.0f, 4.0f } };
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			switch (format)
+			{
+			case BlockFormat::BC1:
+				return BC1Passes;
+			case BlockFormat::BC3:
+				return BC3Passes;
+			case BlockFormat::BC4:
+				return BC4Passes;
+			case BlockFormat::BC5:
+				return BC5Passes;
+			default:
+				return BC7Passes;
+			}
+		}
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 16> block{};
+		/// @brief 圧縮済みのブロック列を、画質の低下を抑えながら LZ 系圧縮で縮みやすいように書き換えます。
+		/// @param blocks 1 つのミップレベルのブロック列
+		/// @param image ブロック列の元画像
+		/// @param format ブロックの形式
+		/// @param lambda RDO の強さ
+		static void ReduceEntropy(Byte* blocks, const Image& image, const BlockFormat format, const float lambda)
+		{
+			const uint32 blockBytes = GetBlockBytes(format);
+			const uint32 xBlocks = ((image.width() + 3) / 4);
+			const uint32 numBlocks = (xBlocks * ((image.height() + 3) / 4));
+			const uint32 numChunks = ((numBlocks + RDOChunkBlocks - 1) / RDOChunkBlocks);
+			const std::span<const RDOPass> passes = GetRDOPasses(format);
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			Threading::ParallelFor(numChunks, [&](const size_t begin, const size_t end)
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
+				Array<Color> pixels;
+				Array<ert::color_rgba> passPixels;
+
+				for (size_t chunk = begin; chunk < end; ++chunk)
 				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+					const uint32 firstBlock = static_cast<uint32>(chunk * RDOChunkBlocks);
+					const uint32 count = Min(RDOChunkBlocks, (numBlocks - firstBlock));
+
+					pixels.resize(count * 16);
+					passPixels.resize(count * 16);
 
-					for (uint32 y = 0; y < 4; ++y)
+					for (uint32 i = 0; i < count; ++i)
 					{
-						if ((height <= (dstBaseY + y)))
+						const uint32 blockIndex = (firstBlock + i);
+						LoadBlock(image, (blockIndex % xBlocks), (blockIndex / xBlocks), (pixels.data() + (i * 16)));
+					}
+
+					for (const auto& pass : passes)
+					{
+						ert::reduce_entropy_params params;
+						params.m_lambda = lambda;
+						params.m_lookback_window_size = 128;
+						params.m_smooth_block_max_mse_scale = Math::Lerp(pass.minSmoothScale, pass.maxSmoothScale, Min(1.0f, (lambda / pass.lambdaRange)));
+						params.m_try_two_matches = true;
+
+						// 比較に使わない成分の重みは 0 にする必要がある
+						for (uint32 i = pass.numComponents; i < 4; ++i)
 						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
+							params.m_color_weights[i] = 0;
 						}
 
-						for (uint32 x = 0; x < 4; ++x)
+						if (pass.channel < 0)
+						{
+							std::memcpy(passPixels.data(), pixels.data(), (pixels.size() * sizeof(Color)));
+						}
+						else
 						{
-							if ((width <= (dstBaseX + x)))
+							for (size_t i = 0; i < pixels.size(); ++i)
 							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
+								passPixels[i] = ert::color_rgba{ { reinterpret_cast<const uint8*>(&pixels[i])[pass.channel], 0, 0, 0 } };
 							}
-
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
 						}
-					}
 
-					rgbcx::encode_bc5_hq(block.data(), pixels);
-					writer.write(block);
+						uint32_t totalModified = 0;
+						ert::reduce_entropy((blocks + (static_cast<size_t>(firstBlock) * blockBytes) + pass.offset), count,
+							blockBytes, pass.size, 4, 4, pass.numComponents, passPixels.data(), params, totalModified, pass.unpack, nullptr);
+					}
 				}
-			}
+			});
 		}
 
-		static void EncodeBC7(IWriter& writer, const Image& image)
+		////////////////////////////////////////////////////////////////
+		//
+		//	EncodeBCn
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief ミップレベル内のブロック行
+		struct BlockRow
 		{
+			const Image* image;
+
+			Byte* pDst;
+
+			uint32 by;
+		};
+
+		static bool EncodeBCn(IWriter& writer, const Image& image, const BlockFormat format, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda)
+		{
+			if (not writer.isOpen())
+			{
+				return false;
+			}
+
 			const uint32 width = image.width();
 			const uint32 height = image.height();
 
-			const uint32 paddedWidth = ((width + 3) & ~3);
-			const uint32 paddedHeight = ((height + 3) & ~3);
+			if (((width % 4) != 0) || ((height % 4) != 0))
+			{
+				return false;
+			}
 
-			const uint32 xBlocks = (paddedWidth / 4);
-			const uint32 yBlocks = (paddedHeight / 4);
+			// BC4, BC5 は色以外のデータ（法線など）に使われるため、ガンマ補正を行わない
+			const GammaCorrect gammaCorrect{ ((format != BlockFormat::BC4) && (format != BlockFormat::BC5)) };
+			// 最上位のレベルは元の画像をそのまま使う
+			const Array<Image> mipImages = (generateMipmaps ? ImageProcessing::BuildPyramid(image, gammaCorrect, IncludeSource::No) : Array<Image>{});
 
-			bc7enc_compress_block_params bc7Params{};
-			bc7enc_compress_block_params_init(&bc7Params);
+			const uint32 blockBytes = GetBlockBytes(format);
+			Array<const Image*> levels(Arg::reserve = (mipImages.size() + 1));
+			levels << &image;
 
-			uint8 pixels[16 * 4 * 4]{};
-			std::array<Byte, 16> block{};
+			for (const auto& mipImage : mipImages)
+			{
+				levels << &mipImage;
+			}
+
+			size_t totalBytes = 0;
+
+			for (const auto& level : levels)
+			{
+				totalBytes += (static_cast<size_t>((level->width() + 3) / 4) * ((level->height() + 3) / 4) * blockBytes);
+			}
 
-			for (uint32 by = 0; by < yBlocks; ++by)
+			Array<Byte> blocks(totalBytes);
+
+			// すべてのミップレベルのブロック行をまとめて並列に圧縮する
+			Array<BlockRow> rows;
 			{
-				for (uint32 bx = 0; bx < xBlocks; ++bx)
+				Byte* pDst = blocks.data();
+
+				for (const auto& level : levels)
 				{
-					const uint32 dstBaseY = (by * 4);
-					const uint32 dstBaseX = (bx * 4);
-					uint8* pDst = pixels;
+					const uint32 xBlocks = ((level->width() + 3) / 4);
+					const uint32 yBlocks = ((level->height() + 3) / 4);
 
-					for (uint32 y = 0; y < 4; ++y)
+					for (uint32 by = 0; by < yBlocks; ++by)
 					{
-						if ((height <= (dstBaseY + y)))
-						{
-							std::memcpy(pDst, (pDst - (4 * sizeof(Color))), (4 * sizeof(Color)));
-							pDst += (4 * sizeof(Color));
-							continue;
-						}
+						rows.push_back({ level, pDst, by });
+						pDst += (xBlocks * blockBytes);
+					}
+				}
+			}
 
-						for (uint32 x = 0; x < 4; ++x)
-						{
-							if ((width <= (dstBaseX + x)))
-							{
-								std::memcpy(pDst, (pDst - sizeof(Color)), sizeof(Color));
-								pDst += sizeof(Color);
-								continue;
-							}
+			const BlockEncoder encoder{ format, quality };
 
-							std::memcpy(pDst, &image[dstBaseY + y][dstBaseX + x], sizeof(Color));
-							pDst += sizeof(Color);
-						}
+			Threading::ParallelFor(rows.size(), [&](const size_t begin, const size_t end)
+			{
+				Color pixels[16];
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const BlockRow& row = rows[i];
+					const uint32 xBlocks = ((row.image->width() + 3) / 4);
+					Byte* pDst = row.pDst;
+
+					for (uint32 bx = 0; bx < xBlocks; ++bx)
+					{
+						LoadBlock(*row.image, bx, row.by, pixels);
+						encoder.encode(pDst, pixels);
+						pDst += blockBytes;
 					}
+				}
+			});
+
+			if (0.0 < rdoLambda)
+			{
+				Byte* pDst = blocks.data();
 
-					bc7enc_compress_block(block.data(), pixels, &bc7Params);
-					writer.write(block);
+				for (const auto& level : levels)
+				{
+					ReduceEntropy(pDst, *level, format, static_cast<float>(rdoLambda));
+					pDst += (static_cast<size_t>((level->width() + 3) / 4) * ((level->height() + 3) / 4) * blockBytes);
 				}
 			}
+
+			WriteHeader(writer, format, width, height, static_cast<uint32>(levels.size()));
+
+			writer.write(blocks.data(), blocks.size_bytes());
+
+			return true;
 		}
 	}
 
@@ -318,14 +506,12 @@ namespace s3d
 
 	BCnEncoder::BCnEncoder()
 	{
-		static bool s_initialized = false;
-
-		if (not s_initialized)
+		[[maybe_unused]] static const bool s_initialized = []()
 		{
-			s_initialized = true;
 			rgbcx::init(rgbcx::bc1_approx_mode::cBC1Ideal);
 			bc7enc_compress_block_init();
-		}
+			return true;
+		}();
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -408,64 +594,20 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC1(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC1(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, PIXEL_FMT_DXT1, width, height, 4, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC1(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-				
-				EncodeBC1(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(writer, image, BlockFormat::BC1, generateMipmaps, quality, rdoLambda);
 	}
 
-	Blob BCnEncoder::encodeBC1(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC1(const Image& image, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
 		MemoryWriter writer;
-	
-		if (not encodeBC1(image, writer, generateMipmaps))
+
+		if (not encodeBC1(image, writer, generateMipmaps, quality, rdoLambda))
 		{
 			return{};
 		}
-		
+
 		return writer.extractBlob();
 	}
 
@@ -475,60 +617,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC3(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC3(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, PIXEL_FMT_DXT5, width, height, 8, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC3(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC3(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(writer, image, BlockFormat::BC3, generateMipmaps, quality, rdoLambda);
 	}
 
-	Blob BCnEncoder::encodeBC3(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC3(const Image& image, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
 		MemoryWriter writer;
 
-		if (not encodeBC3(image, writer, generateMipmaps))
+		if (not encodeBC3(image, writer, generateMipmaps, quality, rdoLambda))
 		{
 			return{};
 		}
@@ -542,60 +640,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC4(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC4(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '4', 'U')), width, height, 4, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC4(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC4(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(writer, image, BlockFormat::BC4, generateMipmaps, quality, rdoLambda);
 	}
 
-	Blob BCnEncoder::encodeBC4(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC4(const Image& image, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
 		MemoryWriter writer;
 
-		if (not encodeBC4(image, writer, generateMipmaps))
+		if (not encodeBC4(image, writer, generateMipmaps, quality, rdoLambda))
 		{
 			return{};
 		}
@@ -609,64 +663,20 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC5(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC5(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('B', 'C', '5', 'U')), width, height, 8, mipCount);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC5(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC5(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(writer, image, BlockFormat::BC5, generateMipmaps, quality, rdoLambda);
 	}
 
-	Blob BCnEncoder::encodeBC5(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC5(const Image& image, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
 		MemoryWriter writer;
-		
-		if (not encodeBC5(image, writer, generateMipmaps))
+
+		if (not encodeBC5(image, writer, generateMipmaps, quality, rdoLambda))
 		{
 			return{};
 		}
-		
+
 		return writer.extractBlob();
 	}
 
@@ -676,61 +686,16 @@ namespace s3d
 	//
 	////////////////////////////////////////////////////////////////
 
-	bool BCnEncoder::encodeBC7(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps) const
+	bool BCnEncoder::encodeBC7(const Image& image, IWriter& writer, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
-		if (not writer.isOpen())
-		{
-			return false;
-		}
-
-		const uint32 width = image.width();
-		const uint32 height = image.height();
-		if (((width % 4) != 0) || ((height % 4) != 0))
-		{
-			return false;
-		}
-
-		const uint32 mipCount = (generateMipmaps ? ImageProcessing::CalculateMipmapLevel(width, height) : 1);
-
-		WriteDDSHeader(writer, pixel_format(PIXEL_FMT_FOURCC('D', 'X', '1', '0')), width, height, 8, mipCount);
-		WriteDX10Header(writer, DXGI_FORMAT_BC7_UNORM);
-
-		Image tmpImage, previousImage;
-
-		for (uint32 mip = 0; mip < mipCount; ++mip)
-		{
-			if (mip == 0)
-			{
-				EncodeBC7(writer, image);
-			}
-			else
-			{
-				const uint32 mipWidth = Max(1u, (width >> mip));
-				const uint32 mipHeight = Max(1u, (height >> mip));
-
-				previousImage.swap(tmpImage);
-
-				if (not previousImage)
-				{
-					tmpImage = ImageProcessing::Resize(image, Size{ mipWidth, mipHeight });
-				}
-				else
-				{
-					tmpImage = ImageProcessing::Resize(previousImage, Size{ mipWidth, mipHeight });
-				}
-
-				EncodeBC7(writer, tmpImage);
-			}
-		}
-
-		return true;
+		return EncodeBCn(writer, image, BlockFormat::BC7, generateMipmaps, quality, rdoLambda);
 	}
 
-	Blob BCnEncoder::encodeBC7(const Image& image, const GenerateMipmaps generateMipmaps) const
+	Blob BCnEncoder::encodeBC7(const Image& image, const GenerateMipmaps generateMipmaps, const BCnQuality quality, const double rdoLambda) const
 	{
 		MemoryWriter writer;
 
-		if (not encodeBC7(image, writer, generateMipmaps))
+		if (not encodeBC7(image, writer, generateMipmaps, quality, rdoLambda))
 		{
 			return{};
 		}
@@ -16,6 +16,7 @@
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include "BMPHeader.hpp"
+# include "../ScanlineResampler.hpp"
 
 namespace s3d
 {
@@ -111,7 +112,17 @@ namespace s3d
 		return IImageDecoder::decode(path, premultiplyAlpha);
 	}
 
-	Image BMPDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const PremultiplyAlpha) const
+	Image BMPDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const PremultiplyAlpha premultiplyAlpha) const
+	{
+		return decode(std::move(reader), pathHint, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha });
+	}
+
+	Image BMPDecoder::decode(const FilePathView path, const ImageDecodeOptions& options) const
+	{
+		return IImageDecoder::decode(path, options);
+	}
+
+	Image BMPDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const ImageDecodeOptions& options) const
 	{
 		LOG_SCOPED_DEBUG("BMPDecoder::decode()");
 
@@ -235,7 +246,12 @@ namespace s3d
 			}
 		}
 
-		Image image(width, height);
+		ScanlineResampler resampler{ Size{ width, height }, options };
+
+		if (resampler.isEmpty())
+		{
+			return{};
+		}
 
 		LOG_TRACE(fmt::format("BMPHeader::biBitCount: {}", depth));
 
@@ -257,20 +273,28 @@ namespace s3d
 		case 1:
 			{
 				const size_t rowSize = (((static_cast<size_t>(width) * depth + 31) / 32) * 4);
-				const int32 lineStep = reverse ? -width : width;
-				Color* pDstLine = image[reverse ? height - 1 : 0];
 
 				Array<uint8> bufferOwner(rowSize);
 				uint8* const buffer = bufferOwner.data();
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const int32 sourceY = (reverse ? (height - 1 - y) : y);
+
+					if (not resampler.needsRow(sourceY))
+					{
+						reader->skip(static_cast<int64>(rowSize));
+						continue;
+					}
+
 					if (not readExact(buffer, rowSize))
 					{
 						LOG_FAIL("❌ BMPDecoder::decode(): Failed to read pixel data");
 						return{};
 					}
 
+					Color* const pDstLine = resampler.getRow(sourceY);
+
 					const uint8* tmp = buffer;
 					Color* pDst = pDstLine;
 
@@ -293,7 +317,12 @@ namespace s3d
 						++tmp;
 					}
 
-					pDstLine += lineStep;
+					resampler.commitRow(sourceY);
+
+					if (resampler.isCompleted())
+					{
+						break;
+					}
 				}
 
 				break;
@@ -301,20 +330,28 @@ namespace s3d
 		case 4:
 			{
 				const size_t rowSize = (((static_cast<size_t>(width) * depth + 31) / 32) * 4);
-				const int32 lineStep = reverse ? -width : width;
-				Color* pDstLine = image[reverse ? height - 1 : 0];
 
 				Array<uint8> bufferOwner(rowSize);
 				uint8* const buffer = bufferOwner.data();
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const int32 sourceY = (reverse ? (height - 1 - y) : y);
+
+					if (not resampler.needsRow(sourceY))
+					{
+						reader->skip(static_cast<int64>(rowSize));
+						continue;
+					}
+
 					if (not readExact(buffer, rowSize))
 					{
 						LOG_FAIL("❌ BMPDecoder::decode(): Failed to read pixel data");
 						return{};
 					}
 
+					Color* const pDstLine = resampler.getRow(sourceY);
+
 					const uint8* tmp = buffer;
 					Color* pDst = pDstLine;
 					const int32 w = (width - 1);
@@ -352,7 +389,12 @@ namespace s3d
 						++pDst;
 					}
 
-					pDstLine += lineStep;
+					resampler.commitRow(sourceY);
+
+					if (resampler.isCompleted())
+					{
+						break;
+					}
 				}
 
 				break;
@@ -360,20 +402,28 @@ namespace s3d
 		case 8:
 			{
 				const size_t rowSize = (((static_cast<size_t>(width) * depth + 31) / 32) * 4);
-				const int32 lineStep = reverse ? -width : width;
-				Color* pDstLine = image[reverse ? height - 1 : 0];
 
 				Array<uint8> bufferOwner(rowSize);
 				uint8* const buffer = bufferOwner.data();
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const int32 sourceY = (reverse ? (height - 1 - y) : y);
+
+					if (not resampler.needsRow(sourceY))
+					{
+						reader->skip(static_cast<int64>(rowSize));
+						continue;
+					}
+
 					if (not readExact(buffer, rowSize))
 					{
 						LOG_FAIL("❌ BMPDecoder::decode(): Failed to read pixel data");
 						return{};
 					}
 
+					Color* const pDstLine = resampler.getRow(sourceY);
+
 					const uint8* tmp = buffer;
 					const Color* const pDstEnd = (pDstLine + width);
 
@@ -387,7 +437,12 @@ namespace s3d
 						}
 					}
 
-					pDstLine += lineStep;
+					resampler.commitRow(sourceY);
+
+					if (resampler.isCompleted())
+					{
+						break;
+					}
 				}
 
 				break;
@@ -395,20 +450,28 @@ namespace s3d
 		case 16:
 			{
 				const size_t rowSize = (((static_cast<size_t>(width) * depth + 31) / 32) * 4);
-				const int32 lineStep = reverse ? -width : width;
-				Color* pDstLine = image[reverse ? height - 1 : 0];
 
 				Array<uint8> bufferOwner(rowSize);
 				uint8* const buffer = bufferOwner.data();
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const int32 sourceY = (reverse ? (height - 1 - y) : y);
+
+					if (not resampler.needsRow(sourceY))
+					{
+						reader->skip(static_cast<int64>(rowSize));
+						continue;
+					}
+
 					if (not readExact(buffer, rowSize))
 					{
 						LOG_FAIL("❌ BMPDecoder::decode(): Failed to read pixel data");
 						return{};
 					}
 
+					Color* const pDstLine = resampler.getRow(sourceY);
+
 					const uint8* pSrc = buffer;
 					const Color* const pDstEnd = (pDstLine + width);
 
@@ -425,7 +488,12 @@ namespace s3d
 						pSrc += 2;
 					}
 
-					pDstLine += lineStep;
+					resampler.commitRow(sourceY);
+
+					if (resampler.isCompleted())
+					{
+						break;
+					}
 				}
 
 				break;
@@ -435,20 +503,28 @@ namespace s3d
 			{
 				const size_t rowSize = (((static_cast<size_t>(width) * depth + 31) / 32) * 4);
 				const size_t depthBytes = (depth / 8);
-				const int32 lineStep = reverse ? -width : width;
-				Color* pDstLine = image[reverse ? height - 1 : 0];
 
 				Array<uint8> bufferOwner(rowSize);
 				uint8* const buffer = bufferOwner.data();
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const int32 sourceY = (reverse ? (height - 1 - y) : y);
+
+					if (not resampler.needsRow(sourceY))
+					{
+						reader->skip(static_cast<int64>(rowSize));
+						continue;
+					}
+
 					if (not readExact(buffer, rowSize))
 					{
 						LOG_FAIL("❌ BMPDecoder::decode(): Failed to read pixel data");
 						return{};
 					}
 
+					Color* const pDstLine = resampler.getRow(sourceY);
+
 					const uint8* pSrc = buffer;
 					const Color* const pDstEnd = (pDstLine + width);
 
@@ -459,7 +535,12 @@ namespace s3d
 						pSrc += depthBytes;
 					}
 
-					pDstLine += lineStep;
+					resampler.commitRow(sourceY);
+
+					if (resampler.isCompleted())
+					{
+						break;
+					}
 				}
 
 				break;
@@ -471,7 +552,9 @@ namespace s3d
 			}
 		}
 
-		LOG_TRACE(fmt::format("Image ({}x{}) decoded", width, height));
+		Image image = resampler.finish();
+
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded ({}x{})", image.width(), image.height(), width, height));
 
 		return image;
 	}
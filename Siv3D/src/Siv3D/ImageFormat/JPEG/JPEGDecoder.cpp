@@ -12,6 +12,7 @@
 # include <Siv3D/ImageFormat/JPEGDecoder.hpp>
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include "../ScanlineResampler.hpp"
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/libjpeg-turbo/turbojpeg.h>
 # else
@@ -20,6 +21,47 @@
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief スレッドごとに再利用する turbojpeg の展開ハンドル
+		class TurboJPEGDecompressor
+		{
+		public:
+
+			TurboJPEGDecompressor()
+				: m_handle{ ::tjInitDecompress() } {}
+
+			TurboJPEGDecompressor(const TurboJPEGDecompressor&) = delete;
+
+			TurboJPEGDecompressor& operator =(const TurboJPEGDecompressor&) = delete;
+
+			~TurboJPEGDecompressor()
+			{
+				if (m_handle)
+				{
+					::tjDestroy(m_handle);
+				}
+			}
+
+			[[nodiscard]]
+			tjhandle get() const noexcept
+			{
+				return m_handle;
+			}
+
+		private:
+
+			tjhandle m_handle = nullptr;
+		};
+
+		[[nodiscard]]
+		static tjhandle GetDecompressor()
+		{
+			thread_local TurboJPEGDecompressor decompressor;
+			return decompressor.get();
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	name
@@ -154,7 +196,17 @@ namespace s3d
 		return IImageDecoder::decode(path, premultiplyAlpha);
 	}
 
-	Image JPEGDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const PremultiplyAlpha) const
+	Image JPEGDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const PremultiplyAlpha premultiplyAlpha) const
+	{
+		return decode(std::move(reader), pathHint, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha });
+	}
+
+	Image JPEGDecoder::decode(const FilePathView path, const ImageDecodeOptions& options) const
+	{
+		return IImageDecoder::decode(path, options);
+	}
+
+	Image JPEGDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const ImageDecodeOptions& options) const
 	{
 		LOG_SCOPED_DEBUG("JPEGDecoder::decode()");
 
@@ -163,36 +215,116 @@ namespace s3d
 			return{};
 		}
 
-		const int64 size = reader->size();
+		const int64 size = (reader->size() - reader->getPos());
 
-		uint8* buffer = static_cast<uint8*>(std::malloc(static_cast<size_t>(size)));
+		if (size <= 0)
+		{
+			return{};
+		}
 
-		reader->read(buffer, size);
+		// データがメモリ上にある場合はコピーせずにそのまま展開する
+		const uint8* source = static_cast<const uint8*>(reader->data());
+		std::unique_ptr<uint8[]> buffer;
 
-		int width, height;
+		if (source)
+		{
+			source += reader->getPos();
+		}
+		else
+		{
+			buffer = std::make_unique_for_overwrite<uint8[]>(static_cast<size_t>(size));
 
-		tjhandle tj = ::tjInitDecompress();
+			if (reader->read(buffer.get(), size) != size)
+			{
+				LOG_FAIL("❌ JPEGDecoder::decode(): Failed to read data");
+				return{};
+			}
 
-		::tjDecompressHeader(tj, buffer, static_cast<unsigned long>(size), &width, &height);
+			source = buffer.get();
+		}
+
+		tjhandle tj = GetDecompressor();
 
-		Image image{ width, height };
+		if (not tj)
+		{
+			LOG_FAIL("❌ JPEGDecoder::decode(): tjInitDecompress() failed");
+			return{};
+		}
 
-		::tjDecompress(
+		int width = 0, height = 0, subsampling = 0, colorspace = 0;
+
+		if (::tjDecompressHeader3(tj, source, static_cast<unsigned long>(size), &width, &height, &subsampling, &colorspace) != 0)
+		{
+			LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): tjDecompressHeader3() failed ({})", ::tjGetErrorStr2(tj)));
+			return{};
+		}
+
+		const Size imageSize{ width, height };
+		const Rect sourceRect = options.getSourceRect(imageSize);
+		const Size outputSize = options.getOutputSize(imageSize);
+
+		if ((outputSize.x == 0) || (outputSize.y == 0))
+		{
+			return{};
+		}
+
+		// 出力サイズを下回らない範囲で、DCT の段階で 1/2, 1/4, 1/8 に縮小する
+		int32 denominator = 8;
+
+		while ((1 < denominator)
+			&& ((((sourceRect.w + denominator - 1) / denominator) < outputSize.x)
+				|| (((sourceRect.h + denominator - 1) / denominator) < outputSize.y)))
+		{
+			denominator /= 2;
+		}
+
+		const tjscalingfactor scalingFactor{ 1, denominator };
+		const int32 scaledWidth		= TJSCALED(width, scalingFactor);
+		const int32 scaledHeight	= TJSCALED(height, scalingFactor);
+
+		Image image{ scaledWidth, scaledHeight };
+
+		if (::tjDecompress2(
 			tj,
-			buffer,
+			source,
 			static_cast<unsigned long>(size),
 			image.dataAsUint8(),
 			image.width(),
 			static_cast<int32>(image.bytesPerRow()),
 			image.height(),
-			sizeof(Color),
-			0);
+			TJPF_RGBA,
+			0) != 0)
+		{
+			// 警告（破損したデータの一部など）の場合は展開できた画像を返す
+			if (::tjGetErrorCode(tj) != TJERR_WARNING)
+			{
+				LOG_FAIL(fmt::format("❌ JPEGDecoder::decode(): tjDecompress2() failed ({})", ::tjGetErrorStr2(tj)));
+				return{};
+			}
+		}
 
-		::tjDestroy(tj);
+		// 縮小後の画像から、切り出しと残りの縮小を行う
+		{
+			const int32 left	= (sourceRect.x / denominator);
+			const int32 top		= (sourceRect.y / denominator);
+			const int32 right	= Min(((sourceRect.x + sourceRect.w + denominator - 1) / denominator), scaledWidth);
+			const int32 bottom	= Min(((sourceRect.y + sourceRect.h + denominator - 1) / denominator), scaledHeight);
+			const Rect scaledRect{ left, top, (right - left), (bottom - top) };
+
+			if ((scaledRect != Rect{ 0, 0, image.size() }) || (outputSize != image.size()))
+			{
+				ScanlineResampler resampler{ image.size(), scaledRect, outputSize };
+
+				for (int32 y = scaledRect.y; y < (scaledRect.y + scaledRect.h); ++y)
+				{
+					resampler.pushRow(y, image[y]);
+				}
 
-		std::free(buffer);
+				image = resampler.finish();
+			}
+		}
 
-		LOG_TRACE(fmt::format("Image ({}x{}) decoded", width, height));
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded ({}x{}, 1/{})", image.width(), image.height(), width, height, denominator));
 
 		return image;
 	}
@@ -14,6 +14,7 @@
 # include <Siv3D/ScopeExit.hpp>
 # include <Siv3D/Endian.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include "../ScanlineResampler.hpp"
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/libpng/png.h>
 # else
@@ -187,7 +188,17 @@ namespace s3d
 		return IImageDecoder::decode(path, premultiplyAlpha);
 	}
 
-	Image PNGDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const PremultiplyAlpha premultiplyAlpha) const
+	Image PNGDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const PremultiplyAlpha premultiplyAlpha) const
+	{
+		return decode(std::move(reader), pathHint, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha });
+	}
+
+	Image PNGDecoder::decode(const FilePathView path, const ImageDecodeOptions& options) const
+	{
+		return IImageDecoder::decode(path, options);
+	}
+
+	Image PNGDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const ImageDecodeOptions& options) const
 	{
 		LOG_SCOPED_DEBUG("PNGDecoder::decode()");
 
@@ -288,33 +299,76 @@ namespace s3d
 			::png_set_gamma(png_ptr, 2.2, dGamma);
 		}
 
-		::png_read_update_info(png_ptr, info_ptr);
+		const int passes = ::png_set_interlace_handling(png_ptr);
 
-		const int nChannels = ::png_get_channels(png_ptr, info_ptr);
+		::png_read_update_info(png_ptr, info_ptr);
 
 		::png_get_IHDR(png_ptr, info_ptr, &width, &height, &iBitDepth, &iColorType, nullptr, nullptr, nullptr);
 
-		Image image(width, height);
+		ScanlineResampler resampler{ Size{ width, height }, options };
 
-		Array<uint8*> ppbRowPointers(height);
+		if (resampler.isEmpty())
 		{
-			const size_t stride = (static_cast<size_t>(width) * nChannels);
-			uint8* pixels = image.dataAsUint8();
+			return{};
+		}
 
-			for (size_t i = 0; i < height; ++i)
+		if (passes == 1)
+		{
+			// 1 行ずつデコードし、出力に必要な行をすべて受け取ったら打ち切る
+			for (int32 y = 0; y < static_cast<int32>(height); ++y)
 			{
-				ppbRowPointers[i] = pixels;
-				pixels += stride;
+				::png_read_row(png_ptr, static_cast<png_bytep>(static_cast<void*>(resampler.getRow(y))), nullptr);
+
+				resampler.commitRow(y);
+
+				if (resampler.isCompleted())
+				{
+					break;
+				}
 			}
 		}
+		else
+		{
+			// インターレース画像は最後のパスまで行が確定しないため、画像全体をデコードしてから縮小する
+			Image fullImage;
 
-		::png_read_image(png_ptr, ppbRowPointers.data());
+			if (not resampler.isFullDecode())
+			{
+				fullImage = Image(width, height);
+			}
 
-		::png_read_end(png_ptr, nullptr);
+			Array<png_bytep> ppbRowPointers(height);
 
-		LOG_TRACE(fmt::format("Image ({}x{}) decoded", width, height));
+			for (int32 y = 0; y < static_cast<int32>(height); ++y)
+			{
+				ppbRowPointers[y] = static_cast<png_bytep>(static_cast<void*>(fullImage ? fullImage[y] : resampler.getRow(y)));
+			}
+
+			::png_read_image(png_ptr, ppbRowPointers.data());
+
+			for (int32 y = 0; y < static_cast<int32>(height); ++y)
+			{
+				if (fullImage)
+				{
+					resampler.pushRow(y, fullImage[y]);
+				}
+				else
+				{
+					resampler.commitRow(y);
+				}
+			}
+		}
+
+		if (resampler.isFullDecode())
+		{
+			::png_read_end(png_ptr, nullptr);
+		}
+
+		Image image = resampler.finish();
+
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded ({}x{})", image.width(), image.height(), width, height));
 
-		if (premultiplyAlpha)
+		if (options.premultiplyAlpha)
 		{
 			image.premultiplyAlpha();
 		}
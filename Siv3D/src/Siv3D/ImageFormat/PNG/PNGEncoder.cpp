@@ -12,10 +12,13 @@
 # include <Siv3D/ImageFormat/PNGEncoder.hpp>
 # include <Siv3D/BinaryFileWriter.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Threading.hpp>
 # if SIV3D_PLATFORM(WINDOWS) | SIV3D_PLATFORM(MACOS) | SIV3D_PLATFORM(WEB)
 #	include <ThirdParty-prebuilt/libpng/png.h>
+#	include <ThirdParty-prebuilt/zlib/zlib.h>
 # else
 #	include <png.h>
+#	include <zlib.h>
 # endif
 
 namespace s3d
@@ -35,6 +38,285 @@ namespace s3d
 
 			pBlob->append(src, length);
 		}
+
+		/// @brief 並列エンコードで 1 つのブロックに含める、フィルタ適用後のデータの目安のサイズ（バイト）
+		constexpr size_t ParallelBlockBytes = (256 * 1024);
+
+		/// @brief deflate のスライディングウィンドウのサイズ（バイト）
+		constexpr size_t DeflateWindowBytes = (32 * 1024);
+
+		constexpr size_t BytesPerPixel = 4;
+
+		[[nodiscard]]
+		static uint8 PaethPredictor(const int32 a, const int32 b, const int32 c) noexcept
+		{
+			const int32 p = (a + b - c);
+			const int32 pa = std::abs(p - a);
+			const int32 pb = std::abs(p - b);
+			const int32 pc = std::abs(p - c);
+
+			if ((pa <= pb) && (pa <= pc))
+			{
+				return static_cast<uint8>(a);
+			}
+			else if (pb <= pc)
+			{
+				return static_cast<uint8>(b);
+			}
+			else
+			{
+				return static_cast<uint8>(c);
+			}
+		}
+
+		/// @brief 1 行に PNG のフィルタを適用します。
+		/// @param type フィルタの種類（0: None, 1: Sub, 2: Up, 3: Average, 4: Paeth）
+		/// @param row 行のデータ
+		/// @param prevRow 1 つ上の行のデータ（先頭の行の場合は nullptr）
+		/// @param rowBytes 行のバイト数
+		/// @param dst 結果の格納先（先頭にフィルタの種類、続いて `rowBytes` バイト）
+		/// @return 結果を符号付きとみなしたときの絶対値の合計
+		static uint64 FilterRow(const int32 type, const uint8* row, const uint8* prevRow, const size_t rowBytes, uint8* dst) noexcept
+		{
+			dst[0] = static_cast<uint8>(type);
+			uint8* pDst = (dst + 1);
+			uint64 cost = 0;
+
+			for (size_t i = 0; i < rowBytes; ++i)
+			{
+				const int32 a = ((BytesPerPixel <= i) ? row[i - BytesPerPixel] : 0);
+				const int32 b = (prevRow ? prevRow[i] : 0);
+				const int32 c = (((BytesPerPixel <= i) && prevRow) ? prevRow[i - BytesPerPixel] : 0);
+
+				uint8 predictor = 0;
+
+				switch (type)
+				{
+				case 1:
+					predictor = static_cast<uint8>(a);
+					break;
+				case 2:
+					predictor = static_cast<uint8>(b);
+					break;
+				case 3:
+					predictor = static_cast<uint8>((a + b) / 2);
+					break;
+				case 4:
+					predictor = PaethPredictor(a, b, c);
+					break;
+				}
+
+				const uint8 value = static_cast<uint8>(row[i] - predictor);
+				pDst[i] = value;
+				cost += ((value < 128) ? value : (256 - value));
+			}
+
+			return cost;
+		}
+
+		/// @brief 1 行に `filter` の中から最適なフィルタを選んで適用します。
+		/// @remark libpng と同じく、結果の絶対値の合計が最小になるフィルタを選びます。
+		static void FilterRowAdaptive(const PNGFilter filter, const uint8* row, const uint8* prevRow, const size_t rowBytes, uint8* dst, uint8* scratch) noexcept
+		{
+			uint64 bestCost = UINT64_MAX;
+
+			for (int32 type = 0; type < 5; ++type)
+			{
+				if (not (FromEnum(filter) & (FromEnum(PNGFilter::None_) << type)))
+				{
+					continue;
+				}
+
+				if (bestCost == UINT64_MAX)
+				{
+					bestCost = FilterRow(type, row, prevRow, rowBytes, dst);
+				}
+				else if (const uint64 cost = FilterRow(type, row, prevRow, rowBytes, scratch);
+					cost < bestCost)
+				{
+					bestCost = cost;
+					std::memcpy(dst, scratch, (rowBytes + 1));
+				}
+			}
+
+			if (bestCost == UINT64_MAX)
+			{
+				FilterRow(0, row, prevRow, rowBytes, dst);
+			}
+		}
+
+		static void AppendUint32BE(Blob& blob, const uint32 value)
+		{
+			const uint8 bytes[4] = { static_cast<uint8>(value >> 24), static_cast<uint8>(value >> 16), static_cast<uint8>(value >> 8), static_cast<uint8>(value) };
+			blob.append(bytes, sizeof(bytes));
+		}
+
+		static void AppendChunk(Blob& blob, const char(&type)[5], const uint8* data, const size_t size)
+		{
+			AppendUint32BE(blob, static_cast<uint32>(size));
+			blob.append(type, 4);
+
+			if (size)
+			{
+				blob.append(data, size);
+			}
+
+			uLong crc = ::crc32(0, reinterpret_cast<const Bytef*>(type), 4);
+			crc = ::crc32_z(crc, data, size);
+			AppendUint32BE(blob, static_cast<uint32>(crc));
+		}
+
+		/// @brief 行のブロックを raw deflate で圧縮します。
+		/// @param data 圧縮するデータ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param dictionary 直前のデータ（最大 32 KiB）
+		/// @param dictionarySize 直前のデータのサイズ（バイト）
+		/// @param last 最後のブロックである場合 true
+		/// @return 圧縮結果。失敗した場合は空の配列
+		[[nodiscard]]
+		static Array<uint8> DeflateBlock(const uint8* data, const size_t size, const uint8* dictionary, const size_t dictionarySize, const bool last)
+		{
+			z_stream stream{};
+
+			if (::deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_FILTERED) != Z_OK)
+			{
+				return{};
+			}
+
+			if (dictionarySize)
+			{
+				::deflateSetDictionary(&stream, dictionary, static_cast<uInt>(dictionarySize));
+			}
+
+			// 同期フラッシュで末尾に付く空のブロックの分だけ余裕を持たせる
+			Array<uint8> result(::deflateBound(&stream, static_cast<uLong>(size)) + 16);
+
+			stream.next_in		= const_cast<Bytef*>(data);
+			stream.avail_in		= static_cast<uInt>(size);
+			stream.next_out		= result.data();
+			stream.avail_out	= static_cast<uInt>(result.size());
+
+			// 最後以外のブロックは同期フラッシュで終え、最終ブロックのフラグを立てずにバイト境界に揃える
+			const int32 status = ::deflate(&stream, (last ? Z_FINISH : Z_SYNC_FLUSH));
+
+			::deflateEnd(&stream);
+
+			if ((last && (status != Z_STREAM_END))
+				|| ((not last) && (status != Z_OK))
+				|| (stream.avail_in != 0))
+			{
+				return{};
+			}
+
+			result.resize(result.size() - stream.avail_out);
+
+			return result;
+		}
+
+		/// @brief Image を複数のスレッドで並列に PNG 形式にエンコードします。
+		[[nodiscard]]
+		static Blob EncodeParallel(const Image& image, const PNGFilter filter)
+		{
+			// 幅や高さが 0 の画像は PNG として表現できない
+			if (image.isEmpty())
+			{
+				LOG_FAIL("❌ PNGEncoder::encode(): image is empty");
+				return{};
+			}
+
+			const size_t width		= image.width();
+			const size_t height		= image.height();
+			const size_t rowBytes	= (width * BytesPerPixel);
+			const size_t strideBytes = (rowBytes + 1);
+			const size_t rowsPerBlock = Max<size_t>((ParallelBlockBytes / strideBytes), 1);
+			const size_t numBlocks	= ((height + rowsPerBlock - 1) / rowsPerBlock);
+
+			// 1. 各行にフィルタを適用する（行ごとに独立）
+			Array<uint8> filtered(height * strideBytes);
+			{
+				Threading::ParallelFor(height, [&](const size_t begin, const size_t end)
+				{
+					Array<uint8> scratch(strideBytes);
+
+					for (size_t y = begin; y < end; ++y)
+					{
+						const uint8* row = (image.dataAsUint8() + (y * image.bytesPerRow()));
+						const uint8* prevRow = (y ? (row - image.bytesPerRow()) : nullptr);
+						FilterRowAdaptive(filter, row, prevRow, rowBytes, (filtered.data() + (y * strideBytes)), scratch.data());
+					}
+				}, rowsPerBlock);
+			}
+
+			// 2. 行のブロックごとに、直前の 32 KiB を辞書として並列に圧縮する
+			Array<Array<uint8>> compressedBlocks(numBlocks);
+			Array<uLong> adlers(numBlocks);
+			{
+				Threading::ParallelFor(numBlocks, [&](const size_t begin, const size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						const size_t offset = (i * rowsPerBlock * strideBytes);
+						const size_t size = (Min(((i + 1) * rowsPerBlock), height) * strideBytes - offset);
+						const size_t dictionarySize = Min(offset, DeflateWindowBytes);
+						const uint8* data = (filtered.data() + offset);
+
+						compressedBlocks[i] = DeflateBlock(data, size, (data - dictionarySize), dictionarySize, (i == (numBlocks - 1)));
+						adlers[i] = ::adler32_z(::adler32(0, nullptr, 0), data, size);
+					}
+				});
+			}
+
+			// 3. zlib ヘッダ、各ブロック、Adler-32 をつなげて IDAT を作る
+			Blob idat;
+			{
+				static constexpr uint8 ZlibHeader[2] = { 0x78, 0x9C };
+				idat.append(ZlibHeader, sizeof(ZlibHeader));
+
+				uLong adler = ::adler32(0, nullptr, 0);
+
+				for (size_t i = 0; i < numBlocks; ++i)
+				{
+					if (not compressedBlocks[i])
+					{
+						LOG_FAIL("❌ PNGEncoder::encode(): deflate() failed");
+						return{};
+					}
+
+					idat.append(compressedBlocks[i].data(), compressedBlocks[i].size());
+
+					const size_t size = (Min(((i + 1) * rowsPerBlock), height) - (i * rowsPerBlock)) * strideBytes;
+					adler = ::adler32_combine(adler, adlers[i], static_cast<z_off_t>(size));
+				}
+
+				AppendUint32BE(idat, static_cast<uint32>(adler));
+			}
+
+			Blob blob;
+			{
+				static constexpr uint8 Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+				blob.append(Signature, sizeof(Signature));
+
+				Blob ihdr;
+				AppendUint32BE(ihdr, static_cast<uint32>(width));
+				AppendUint32BE(ihdr, static_cast<uint32>(height));
+				static constexpr uint8 Format[5] = { 8, PNG_COLOR_TYPE_RGB_ALPHA, 0, 0, 0 };
+				ihdr.append(Format, sizeof(Format));
+				AppendChunk(blob, "IHDR", static_cast<const uint8*>(static_cast<const void*>(ihdr.data())), ihdr.size());
+
+				// チャンクの長さは 2^31 - 1 バイト以下である必要がある
+				constexpr size_t MaxChunkBytes = (1u << 30);
+				const uint8* pIDAT = static_cast<const uint8*>(static_cast<const void*>(idat.data()));
+
+				for (size_t offset = 0; offset < idat.size(); offset += MaxChunkBytes)
+				{
+					AppendChunk(blob, "IDAT", (pIDAT + offset), Min(MaxChunkBytes, (idat.size() - offset)));
+				}
+
+				AppendChunk(blob, "IEND", nullptr, 0);
+			}
+
+			return blob;
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -100,6 +382,24 @@ namespace s3d
 		return encode(image, writer, filter);
 	}
 
+	bool PNGEncoder::save(const Image& image, const FilePathView path, const PNGFilter filter, const Parallelize parallelize) const
+	{
+		if (not image)
+		{
+			LOG_FAIL("❌ PNGEncoder::save(): image is empty");
+			return false;
+		}
+
+		BinaryFileWriter writer{ path };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		return encode(image, writer, filter, parallelize);
+	}
+
 	bool PNGEncoder::save(const Grid<uint16>& image, const FilePathView path, const PNGFilter filter) const
 	{
 		BinaryFileWriter writer{ path };
@@ -174,6 +474,28 @@ namespace s3d
 		return true;
 	}
 
+	bool PNGEncoder::encode(const Image& image, IWriter& writer, const PNGFilter filter, const Parallelize parallelize) const
+	{
+		if (not parallelize)
+		{
+			return encode(image, writer, filter);
+		}
+
+		if (not writer.isOpen())
+		{
+			return false;
+		}
+
+		const Blob blob = EncodeParallel(image, filter);
+
+		if (not blob)
+		{
+			return false;
+		}
+
+		return (writer.write(blob.data(), blob.size()) == static_cast<int64>(blob.size()));
+	}
+
 	bool PNGEncoder::encode(const Grid<uint16>& image, IWriter& writer, const PNGFilter filter) const
 	{
 		if (not writer.isOpen())
@@ -284,6 +606,16 @@ namespace s3d
 		return blob;
 	}
 
+	Blob PNGEncoder::encode(const Image& image, const PNGFilter filter, const Parallelize parallelize) const
+	{
+		if (not parallelize)
+		{
+			return encode(image, filter);
+		}
+
+		return EncodeParallel(image, filter);
+	}
+
 	Blob PNGEncoder::encode(const Grid<uint16>& image, const PNGFilter filter) const
 	{
 		png_structp png_ptr = ::png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
@@ -0,0 +1,321 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/ImageFormat/QOIDecoder.hpp>
+# include <Siv3D/IReader.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "QOIHeader.hpp"
+# include "../ScanlineResampler.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 行をまたいで引き継がれるデコードの状態
+		struct QOIDecodeState
+		{
+			uint32 index[64] = {};
+
+			Color px{ 0, 0, 0, 255 };
+
+			int32 run = 0;
+
+			const uint8* p = nullptr;
+
+			/// @brief チャンクの終端（末尾のマーカーの先頭）
+			const uint8* pChunksEnd = nullptr;
+		};
+
+		/// @brief 1 行分のピクセルをデコードします。
+		/// @param state デコードの状態
+		/// @param dst 書き込み先
+		/// @param width 1 行のピクセル数
+		static void DecodeRow(QOIDecodeState& state, Color* dst, const int32 width) noexcept
+		{
+			Color px = state.px;
+			int32 run = state.run;
+			const uint8* p = state.p;
+			const uint8* const pChunksEnd = state.pChunksEnd;
+			Color* const pDstEnd = (dst + width);
+
+			while (dst != pDstEnd)
+			{
+				if (run)
+				{
+					// 連続する同じ色はまとめて書き込む
+					const int32 count = Min(run, static_cast<int32>(pDstEnd - dst));
+					std::fill_n(dst, count, px);
+					dst += count;
+					run -= count;
+					continue;
+				}
+
+				if (pChunksEnd <= p)
+				{
+					// データが不足している場合は直前の色で埋める
+					std::fill(dst, pDstEnd, px);
+					break;
+				}
+
+				const uint8 b1 = *p++;
+
+				if (b1 == QOI::OpRGB)
+				{
+					px.r = p[0];
+					px.g = p[1];
+					px.b = p[2];
+					p += 3;
+				}
+				else if (b1 == QOI::OpRGBA)
+				{
+					std::memcpy(&px, p, 4);
+					p += 4;
+				}
+				else
+				{
+					switch (b1 & QOI::Mask2)
+					{
+					case QOI::OpIndex:
+						px = std::bit_cast<Color>(state.index[b1]);
+						break;
+					case QOI::OpDiff:
+						px.r += static_cast<uint8>(((b1 >> 4) & 0x03) - 2);
+						px.g += static_cast<uint8>(((b1 >> 2) & 0x03) - 2);
+						px.b += static_cast<uint8>((b1 & 0x03) - 2);
+						break;
+					case QOI::OpLuma:
+						{
+							const uint8 b2 = *p++;
+							const int32 vg = ((b1 & 0x3F) - 32);
+							px.r += static_cast<uint8>(vg - 8 + ((b2 >> 4) & 0x0F));
+							px.g += static_cast<uint8>(vg);
+							px.b += static_cast<uint8>(vg - 8 + (b2 & 0x0F));
+							break;
+						}
+					default: // QOI::OpRun
+						// 1 ピクセル目はこの後で書き込み、残りは次のループで書き込む
+						run = (b1 & 0x3F);
+						break;
+					}
+				}
+
+				const uint32 packed = std::bit_cast<uint32>(px);
+				state.index[QOI::Hash(packed)] = packed;
+				*dst++ = px;
+			}
+
+			state.px = px;
+			state.run = run;
+			state.p = p;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	name
+	//
+	////////////////////////////////////////////////////////////////
+
+	StringView QOIDecoder::name() const noexcept
+	{
+		return U"QOI"_sv;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	imageFormat
+	//
+	////////////////////////////////////////////////////////////////
+
+	ImageFormat QOIDecoder::imageFormat() const noexcept
+	{
+		return ImageFormat::QOI;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isHeader
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool QOIDecoder::isHeader(const uint8(&bytes)[RequiredHeaderBytes]) const noexcept
+	{
+		return (std::memcmp(bytes, QOIHeader::Magic, sizeof(QOIHeader::Magic)) == 0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	possibleExtensions
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::span<const StringView> QOIDecoder::possibleExtensions() const noexcept
+	{
+		static constexpr std::array<StringView, 1> Extensions = { U"qoi" };
+		return Extensions;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getImageInfo
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<ImageInfo> QOIDecoder::getImageInfo(const FilePathView path) const
+	{
+		return IImageDecoder::getImageInfo(path);
+	}
+
+	Optional<ImageInfo> QOIDecoder::getImageInfo(const IReader& reader, const FilePathView) const
+	{
+		QOIHeader header;
+
+		if (not reader.lookahead(header))
+		{
+			LOG_FAIL("❌ QOIDecoder::getImageInfo(): Failed to load the header");
+			return{};
+		}
+
+		if (not header.isValid())
+		{
+			LOG_FAIL("❌ QOIDecoder::getImageInfo(): Invalid header");
+			return{};
+		}
+
+		const Size size{ static_cast<int32>(header.getWidth()), static_cast<int32>(header.getHeight()) };
+		const ImagePixelFormat pixelFormat = ((header.channels == 3) ? ImagePixelFormat::R8G8B8X8 : ImagePixelFormat::R8G8B8A8);
+
+		return ImageInfo{ size, ImageFormat::QOI, pixelFormat, false };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	decode
+	//
+	////////////////////////////////////////////////////////////////
+
+	Image QOIDecoder::decode(const FilePathView path, const PremultiplyAlpha premultiplyAlpha) const
+	{
+		return IImageDecoder::decode(path, premultiplyAlpha);
+	}
+
+	Image QOIDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const PremultiplyAlpha premultiplyAlpha) const
+	{
+		return decode(std::move(reader), pathHint, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha });
+	}
+
+	Image QOIDecoder::decode(const FilePathView path, const ImageDecodeOptions& options) const
+	{
+		return IImageDecoder::decode(path, options);
+	}
+
+	Image QOIDecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const ImageDecodeOptions& options) const
+	{
+		LOG_SCOPED_DEBUG("QOIDecoder::decode()");
+
+		if (not reader)
+		{
+			return{};
+		}
+
+		QOIHeader header;
+
+		if (not reader->read(header))
+		{
+			return{};
+		}
+
+		if (not header.isValid())
+		{
+			LOG_FAIL("❌ QOIDecoder::decode(): Invalid header");
+			return{};
+		}
+
+		const int32 width	= static_cast<int32>(header.getWidth());
+		const int32 height	= static_cast<int32>(header.getHeight());
+		const int64 size	= (reader->size() - reader->getPos());
+
+		if ((Image::MaxWidth < width) || (Image::MaxHeight < height))
+		{
+			LOG_FAIL(fmt::format("QOIDecoder::decode(): Image size {}x{} is not supported", width, height));
+			return{};
+		}
+
+		if (size < static_cast<int64>(sizeof(QOI::Padding)))
+		{
+			LOG_FAIL("❌ QOIDecoder::decode(): Data is too short");
+			return{};
+		}
+
+		// データがメモリ上にある場合はコピーせずにそのまま展開する
+		const uint8* source = static_cast<const uint8*>(reader->data());
+		std::unique_ptr<uint8[]> buffer;
+
+		if (source)
+		{
+			source += reader->getPos();
+		}
+		else
+		{
+			buffer = std::make_unique_for_overwrite<uint8[]>(static_cast<size_t>(size));
+
+			if (reader->read(buffer.get(), size) != size)
+			{
+				LOG_FAIL("❌ QOIDecoder::decode(): Failed to read data");
+				return{};
+			}
+
+			source = buffer.get();
+		}
+
+		ScanlineResampler resampler{ Size{ width, height }, options };
+
+		if (resampler.isEmpty())
+		{
+			return{};
+		}
+
+		QOIDecodeState state{ .p = source, .pChunksEnd = (source + size - sizeof(QOI::Padding)) };
+
+		// 出力に不要な行も、後続の行のためにデコードだけは行う
+		Array<Color> discardedRow(resampler.isFullDecode() ? 0 : width);
+
+		for (int32 y = 0; y < height; ++y)
+		{
+			if (resampler.needsRow(y))
+			{
+				DecodeRow(state, resampler.getRow(y), width);
+				resampler.commitRow(y);
+
+				if (resampler.isCompleted())
+				{
+					break;
+				}
+			}
+			else
+			{
+				DecodeRow(state, discardedRow.data(), width);
+			}
+		}
+
+		Image image = resampler.finish();
+
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded ({}x{})", image.width(), image.height(), width, height));
+
+		if (options.premultiplyAlpha)
+		{
+			image.premultiplyAlpha();
+		}
+
+		return image;
+	}
+}
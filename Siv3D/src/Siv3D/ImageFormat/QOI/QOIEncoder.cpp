@@ -0,0 +1,263 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/ImageFormat/QOIEncoder.hpp>
+# include <Siv3D/BinaryFileWriter.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "QOIHeader.hpp"
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief エンコード結果の最大サイズを返します。
+		[[nodiscard]]
+		static constexpr size_t GetMaxEncodedSize(const size_t num_pixels) noexcept
+		{
+			// 最悪の場合はすべてのピクセルが QOI_OP_RGBA (5 バイト) になる
+			return (sizeof(QOIHeader) + (num_pixels * 5) + sizeof(QOI::Padding));
+		}
+
+		struct EncodedData
+		{
+			std::unique_ptr<uint8[]> data;
+
+			size_t size = 0;
+		};
+
+		/// @brief ピクセル列を QOI のチャンクにエンコードします。
+		/// @param pixels ピクセル列
+		/// @param num_pixels ピクセル数
+		/// @param dst 書き込み先。`num_pixels * 5` バイト以上の領域が必要です。
+		/// @return 書き込んだバイト数
+		[[nodiscard]]
+		static size_t EncodeChunks(const Color* pixels, const size_t num_pixels, uint8* const dst) noexcept
+		{
+			uint32 index[64] = {};
+			uint8* p = dst;
+
+			const Color* const pEnd = (pixels + num_pixels);
+			Color prev{ 0, 0, 0, 255 };
+			uint32 prevPacked = std::bit_cast<uint32>(prev);
+
+			while (pixels != pEnd)
+			{
+				uint32 packed = std::bit_cast<uint32>(*pixels);
+
+				if (packed == prevPacked)
+				{
+					// 同じ色が続く範囲を 32 ビット比較でまとめて数える
+					const Color* pRunEnd = (pixels + 1);
+
+					while ((pRunEnd != pEnd) && (std::bit_cast<uint32>(*pRunEnd) == prevPacked))
+					{
+						++pRunEnd;
+					}
+
+					ptrdiff_t run = (pRunEnd - pixels);
+					pixels = pRunEnd;
+
+					for (; QOI::MaxRun <= run; run -= QOI::MaxRun)
+					{
+						*p++ = (QOI::OpRun | (QOI::MaxRun - 1));
+					}
+
+					if (run)
+					{
+						*p++ = static_cast<uint8>(QOI::OpRun | (run - 1));
+					}
+
+					continue;
+				}
+
+				const Color px = *pixels++;
+				const uint32 hash = QOI::Hash(packed);
+
+				if (index[hash] == packed)
+				{
+					*p++ = static_cast<uint8>(QOI::OpIndex | hash);
+				}
+				else
+				{
+					index[hash] = packed;
+
+					if (px.a == prev.a)
+					{
+						const int32 vr = static_cast<int8>(px.r - prev.r);
+						const int32 vg = static_cast<int8>(px.g - prev.g);
+						const int32 vb = static_cast<int8>(px.b - prev.b);
+						const int32 vg_r = (vr - vg);
+						const int32 vg_b = (vb - vg);
+
+						if ((static_cast<uint32>(vr + 2) < 4)
+							&& (static_cast<uint32>(vg + 2) < 4)
+							&& (static_cast<uint32>(vb + 2) < 4))
+						{
+							*p++ = static_cast<uint8>(QOI::OpDiff | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2));
+						}
+						else if ((static_cast<uint32>(vg_r + 8) < 16)
+							&& (static_cast<uint32>(vg + 32) < 64)
+							&& (static_cast<uint32>(vg_b + 8) < 16))
+						{
+							*p++ = static_cast<uint8>(QOI::OpLuma | (vg + 32));
+							*p++ = static_cast<uint8>(((vg_r + 8) << 4) | (vg_b + 8));
+						}
+						else
+						{
+							p[0] = QOI::OpRGB;
+							p[1] = px.r;
+							p[2] = px.g;
+							p[3] = px.b;
+							p += 4;
+						}
+					}
+					else
+					{
+						p[0] = QOI::OpRGBA;
+						std::memcpy(p + 1, &px, 4);
+						p += 5;
+					}
+				}
+
+				prev = px;
+				prevPacked = packed;
+			}
+
+			return static_cast<size_t>(p - dst);
+		}
+
+		[[nodiscard]]
+		static EncodedData Encode(const Image& image)
+		{
+			if (not image)
+			{
+				LOG_FAIL("❌ QOIEncoder::encode(): image is empty");
+				return{};
+			}
+
+			const QOIHeader header = QOIHeader::Make(image.width(), image.height());
+			const size_t num_pixels = image.num_pixels();
+
+			// 最大サイズの領域を初期化せずに確保する
+			std::unique_ptr<uint8[]> buffer;
+			try
+			{
+				buffer = std::make_unique_for_overwrite<uint8[]>(GetMaxEncodedSize(num_pixels));
+			}
+			catch (const std::bad_alloc&)
+			{
+				return{};
+			}
+
+			uint8* const pDst = buffer.get();
+			std::memcpy(pDst, &header, sizeof(header));
+
+			const size_t chunkSize = EncodeChunks(image.data(), num_pixels, (pDst + sizeof(header)));
+			std::memcpy((pDst + sizeof(header) + chunkSize), QOI::Padding, sizeof(QOI::Padding));
+
+			return{ std::move(buffer), (sizeof(header) + chunkSize + sizeof(QOI::Padding)) };
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	name
+	//
+	////////////////////////////////////////////////////////////////
+
+	StringView QOIEncoder::name() const noexcept
+	{
+		return U"QOI"_sv;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	imageFormat
+	//
+	////////////////////////////////////////////////////////////////
+
+	ImageFormat QOIEncoder::imageFormat() const noexcept
+	{
+		return ImageFormat::QOI;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	possibleExtensions
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::span<const StringView> QOIEncoder::possibleExtensions() const noexcept
+	{
+		static constexpr std::array<StringView, 1> Extensions = { U"qoi" };
+		return Extensions;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	save
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool QOIEncoder::save(const Image& image, const FilePathView path) const
+	{
+		if (not image)
+		{
+			LOG_FAIL("❌ QOIEncoder::save(): image is empty");
+			return false;
+		}
+
+		BinaryFileWriter writer{ path };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		return encode(image, writer);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	encode
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool QOIEncoder::encode(const Image& image, IWriter& writer) const
+	{
+		if (not writer.isOpen())
+		{
+			return false;
+		}
+
+		const auto [data, size] = Encode(image);
+
+		if (not data)
+		{
+			return false;
+		}
+
+		return (writer.write(data.get(), static_cast<int64>(size)) == static_cast<int64>(size));
+	}
+
+	Blob QOIEncoder::encode(const Image& image) const
+	{
+		const auto [data, size] = Encode(image);
+
+		if (not data)
+		{
+			return{};
+		}
+
+		return Blob{ data.get(), size };
+	}
+}
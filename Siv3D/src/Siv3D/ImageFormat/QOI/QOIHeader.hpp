@@ -0,0 +1,126 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Color.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	QOIHeader
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief QOI 形式のヘッダ（整数はビッグエンディアン）
+	struct QOIHeader
+	{
+		// Magic bytes "qoif"
+		uint8 magic[4];
+
+		// Image width (big-endian)
+		uint8 width[4];
+
+		// Image height (big-endian)
+		uint8 height[4];
+
+		// 3 = RGB, 4 = RGBA
+		uint8 channels;
+
+		// 0 = sRGB with linear alpha, 1 = all channels linear
+		uint8 colorspace;
+
+		static constexpr uint8 Magic[4] = { 'q', 'o', 'i', 'f' };
+
+		/// @brief QOI 形式の仕様で定められた最大ピクセル数
+		static constexpr uint64 MaxPixels = 400'000'000;
+
+		[[nodiscard]]
+		constexpr bool hasMagic() const noexcept
+		{
+			return ((magic[0] == Magic[0]) && (magic[1] == Magic[1]) && (magic[2] == Magic[2]) && (magic[3] == Magic[3]));
+		}
+
+		[[nodiscard]]
+		constexpr uint32 getWidth() const noexcept
+		{
+			return ((uint32{ width[0] } << 24) | (uint32{ width[1] } << 16) | (uint32{ width[2] } << 8) | uint32{ width[3] });
+		}
+
+		[[nodiscard]]
+		constexpr uint32 getHeight() const noexcept
+		{
+			return ((uint32{ height[0] } << 24) | (uint32{ height[1] } << 16) | (uint32{ height[2] } << 8) | uint32{ height[3] });
+		}
+
+		[[nodiscard]]
+		constexpr bool isValid() const noexcept
+		{
+			const uint64 w = getWidth();
+			const uint64 h = getHeight();
+
+			return (hasMagic()
+				&& ((channels == 3) || (channels == 4))
+				&& (colorspace <= 1)
+				&& (w != 0) && (h != 0)
+				&& ((w * h) <= MaxPixels));
+		}
+
+		[[nodiscard]]
+		static constexpr QOIHeader Make(const int32 width, const int32 height) noexcept
+		{
+			const uint32 w = static_cast<uint32>(width);
+			const uint32 h = static_cast<uint32>(height);
+
+			return
+			{
+				.magic		= { Magic[0], Magic[1], Magic[2], Magic[3] },
+				.width		= { static_cast<uint8>(w >> 24), static_cast<uint8>(w >> 16), static_cast<uint8>(w >> 8), static_cast<uint8>(w) },
+				.height		= { static_cast<uint8>(h >> 24), static_cast<uint8>(h >> 16), static_cast<uint8>(h >> 8), static_cast<uint8>(h) },
+				.channels	= 4,
+				.colorspace	= 0,
+			};
+		}
+	};
+
+	static_assert(sizeof(QOIHeader) == 14);
+
+	namespace QOI
+	{
+		inline constexpr uint8 OpIndex	= 0x00;
+		inline constexpr uint8 OpDiff	= 0x40;
+		inline constexpr uint8 OpLuma	= 0x80;
+		inline constexpr uint8 OpRun	= 0xC0;
+		inline constexpr uint8 OpRGB	= 0xFE;
+		inline constexpr uint8 OpRGBA	= 0xFF;
+		inline constexpr uint8 Mask2	= 0xC0;
+
+		/// @brief データ末尾の 8 バイトのマーカー
+		inline constexpr uint8 Padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+		/// @brief 1 つの QOI_OP_RUN で表せる最大の連続数
+		inline constexpr int32 MaxRun = 62;
+
+		/// @brief ピクセルのハッシュ `(r * 3 + g * 5 + b * 7 + a * 11) % 64` を計算します。
+		/// @param packed リトルエンディアンで RGBA の順に並んだピクセル
+		/// @return ハッシュ値
+		/// @remark 4 回の乗算の代わりに、チャンネルを 16 ビット間隔に並べ替えて 1 回の 64 ビット乗算で計算します。
+		[[nodiscard]]
+		constexpr uint32 Hash(const uint32 packed) noexcept
+		{
+			// r | b << 16 | g << 32 | a << 48
+			const uint64 spread = (((uint64{ packed } & 0xFF00FF00ull) << 24) | (packed & 0x00FF00FFu));
+			return (static_cast<uint32>((spread * 0x000300070005000Bull) >> 48) & 63);
+		}
+	}
+}
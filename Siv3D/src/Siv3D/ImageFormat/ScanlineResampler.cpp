@@ -0,0 +1,242 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "ScanlineResampler.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ScanlineResampler::ScanlineResampler(const Size& imageSize, const ImageDecodeOptions& options)
+		: ScanlineResampler{ imageSize, options.getSourceRect(imageSize), options.getOutputSize(imageSize) } {}
+
+	ScanlineResampler::ScanlineResampler(const Size& imageSize, const Rect& sourceRect, const Size& outputSize)
+		: m_sourceRect{ sourceRect }
+		, m_outputSize{ outputSize }
+		, m_fullDecode{ (sourceRect == Rect{ 0, 0, imageSize }) && (outputSize == imageSize) }
+	{
+		if ((m_outputSize.x <= 0) || (m_outputSize.y <= 0))
+		{
+			m_outputSize = Size{ 0, 0 };
+			return;
+		}
+
+		m_image = Image{ m_outputSize };
+
+		if (m_fullDecode)
+		{
+			return;
+		}
+
+		m_rowBuffer.resize(imageSize.x);
+		m_columnBins.resize(m_sourceRect.w);
+		m_columnCounts.resize(m_outputSize.x);
+		m_sums.resize(m_outputSize.x * 4);
+
+		for (int32 x = 0; x < m_sourceRect.w; ++x)
+		{
+			const int32 bin = static_cast<int32>((static_cast<int64>(x) * m_outputSize.x) / m_sourceRect.w);
+			m_columnBins[x] = bin;
+			++m_columnCounts[bin];
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isEmpty
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ScanlineResampler::isEmpty() const noexcept
+	{
+		return m_image.isEmpty();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isFullDecode
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ScanlineResampler::isFullDecode() const noexcept
+	{
+		return m_fullDecode;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	needsRow
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ScanlineResampler::needsRow(const int32 y) const noexcept
+	{
+		return (not isEmpty()) && InRange(y, m_sourceRect.y, (m_sourceRect.y + m_sourceRect.h - 1));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isCompleted
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ScanlineResampler::isCompleted() const noexcept
+	{
+		return (m_sourceRect.h <= m_committedRowCount);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getRow
+	//
+	////////////////////////////////////////////////////////////////
+
+	Color* ScanlineResampler::getRow(const int32 y)
+	{
+		if (m_fullDecode)
+		{
+			return m_image[y];
+		}
+
+		return m_rowBuffer.data();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	commitRow
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScanlineResampler::commitRow(const int32 y)
+	{
+		if (m_fullDecode)
+		{
+			++m_committedRowCount;
+			return;
+		}
+
+		pushRow(y, m_rowBuffer.data());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	pushRow
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScanlineResampler::pushRow(const int32 y, const Color* row)
+	{
+		if (not needsRow(y))
+		{
+			return;
+		}
+
+		++m_committedRowCount;
+
+		if (m_fullDecode)
+		{
+			std::memcpy(m_image[y], row, m_image.bytesPerRow());
+			return;
+		}
+
+		const int32 bin = getRowBin(y);
+
+		if (bin != m_currentBin)
+		{
+			flush();
+			m_currentBin = bin;
+		}
+
+		const Color* pSrc = (row + m_sourceRect.x);
+		uint64* const pSums = m_sums.data();
+
+		for (int32 x = 0; x < m_sourceRect.w; ++x, ++pSrc)
+		{
+			// 半透明の境界で色がにじまないよう、アルファで重み付けして平均する
+			const uint32 a = pSrc->a;
+			uint64* const pSum = (pSums + m_columnBins[x] * 4);
+			pSum[0] += (pSrc->r * a);
+			pSum[1] += (pSrc->g * a);
+			pSum[2] += (pSrc->b * a);
+			pSum[3] += a;
+		}
+
+		++m_binRowCount;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	finish
+	//
+	////////////////////////////////////////////////////////////////
+
+	Image ScanlineResampler::finish()
+	{
+		flush();
+
+		return std::move(m_image);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getRowBin
+	//
+	////////////////////////////////////////////////////////////////
+
+	int32 ScanlineResampler::getRowBin(const int32 y) const noexcept
+	{
+		return static_cast<int32>((static_cast<int64>(y - m_sourceRect.y) * m_outputSize.y) / m_sourceRect.h);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	flush
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ScanlineResampler::flush()
+	{
+		if (m_currentBin < 0)
+		{
+			return;
+		}
+
+		Color* pDst = m_image[m_currentBin];
+		uint64* pSum = m_sums.data();
+
+		for (int32 x = 0; x < m_outputSize.x; ++x, ++pDst, pSum += 4)
+		{
+			const uint64 count = (static_cast<uint64>(m_columnCounts[x]) * m_binRowCount);
+			const uint64 alphaSum = pSum[3];
+
+			if (alphaSum == 0)
+			{
+				*pDst = Color{ 0, 0, 0, 0 };
+			}
+			else
+			{
+				pDst->r = static_cast<uint8>((pSum[0] + alphaSum / 2) / alphaSum);
+				pDst->g = static_cast<uint8>((pSum[1] + alphaSum / 2) / alphaSum);
+				pDst->b = static_cast<uint8>((pSum[2] + alphaSum / 2) / alphaSum);
+				pDst->a = static_cast<uint8>((alphaSum + count / 2) / count);
+			}
+
+			pSum[0] = pSum[1] = pSum[2] = pSum[3] = 0;
+		}
+
+		m_currentBin = -1;
+		m_binRowCount = 0;
+	}
+}
@@ -0,0 +1,114 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/ImageDecodeOptions.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	/// @brief 1 行ずつデコードされる画像を、領域の切り出しと縮小を行いながら受け取るクラス
+	/// @remark 縮小には面積平均を用い、出力画像と 1 行分のバッファ以外のメモリを必要としません。
+	/// @remark 行は上から順、または下から順のどちらかで渡す必要があります。
+	class ScanlineResampler
+	{
+	public:
+
+		/// @brief デコードのオプションに従ってリサンプラーを作成します。
+		/// @param imageSize 元の画像のサイズ
+		/// @param options デコードのオプション
+		[[nodiscard]]
+		ScanlineResampler(const Size& imageSize, const ImageDecodeOptions& options);
+
+		/// @brief 元の画像の領域を指定したサイズに縮小するリサンプラーを作成します。
+		/// @param imageSize 元の画像のサイズ
+		/// @param sourceRect 切り出す領域（画像の範囲内であること）
+		/// @param outputSize 出力画像のサイズ（`sourceRect` のサイズ以下であること）
+		[[nodiscard]]
+		ScanlineResampler(const Size& imageSize, const Rect& sourceRect, const Size& outputSize);
+
+		/// @brief 出力画像が空であるかを返します。
+		/// @return 出力画像が空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 画像全体を元のサイズのまま出力するかを返します。
+		/// @return 画像全体を元のサイズのまま出力する場合 true, それ以外の場合は false
+		/// @remark true の場合、`getRow()` は出力画像の行を直接返します。
+		[[nodiscard]]
+		bool isFullDecode() const noexcept;
+
+		/// @brief 指定した行が出力に必要であるかを返します。
+		/// @param y 元の画像における行
+		/// @return 出力に必要である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool needsRow(int32 y) const noexcept;
+
+		/// @brief 出力に必要なすべての行を受け取ったかを返します。
+		/// @return 出力に必要なすべての行を受け取った場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isCompleted() const noexcept;
+
+		/// @brief 元の画像の 1 行分（幅は元の画像の幅）を書き込むバッファを返します。
+		/// @param y 元の画像における行
+		/// @return 1 行分のバッファ
+		[[nodiscard]]
+		Color* getRow(int32 y);
+
+		/// @brief `getRow()` で取得したバッファに書き込んだ行を確定します。
+		/// @param y 元の画像における行
+		void commitRow(int32 y);
+
+		/// @brief 元の画像の 1 行を渡します。
+		/// @param y 元の画像における行
+		/// @param row 1 行分のピクセル（幅は元の画像の幅）
+		void pushRow(int32 y, const Color* row);
+
+		/// @brief 出力画像を返します。
+		/// @return 出力画像
+		[[nodiscard]]
+		Image finish();
+
+	private:
+
+		Rect m_sourceRect{ 0, 0, 0, 0 };
+
+		Size m_outputSize{ 0, 0 };
+
+		bool m_fullDecode = false;
+
+		Image m_image;
+
+		Array<Color> m_rowBuffer;
+
+		/// @brief 切り出す領域の各列に対応する出力画像の列
+		Array<int32> m_columnBins;
+
+		/// @brief 出力画像の各列に対応する元の画像の列の数
+		Array<uint32> m_columnCounts;
+
+		/// @brief 出力画像の各列の (R * A, G * A, B * A, A) の合計
+		Array<uint64> m_sums;
+
+		int32 m_currentBin = -1;
+
+		int32 m_binRowCount = 0;
+
+		int32 m_committedRowCount = 0;
+
+		[[nodiscard]]
+		int32 getRowBin(int32 y) const noexcept;
+
+		void flush();
+	};
+}
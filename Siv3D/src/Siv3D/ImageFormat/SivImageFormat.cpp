@@ -33,6 +33,7 @@ namespace s3d
 			U"TGA"_sv,
 			U"PPM"_sv,
 			U"SVG"_sv,
+			U"QOI"_sv,
 		};
 	}
 
@@ -13,6 +13,7 @@
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include "TGAHeader.hpp"
+# include "../ScanlineResampler.hpp"
 
 namespace s3d
 {
@@ -113,7 +114,17 @@ namespace s3d
 		return IImageDecoder::decode(path, premultiplyAlpha);
 	}
 
-	Image TGADecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const PremultiplyAlpha) const
+	Image TGADecoder::decode(std::unique_ptr<IReader> reader, const FilePathView pathHint, const PremultiplyAlpha premultiplyAlpha) const
+	{
+		return decode(std::move(reader), pathHint, ImageDecodeOptions{ .premultiplyAlpha = premultiplyAlpha });
+	}
+
+	Image TGADecoder::decode(const FilePathView path, const ImageDecodeOptions& options) const
+	{
+		return IImageDecoder::decode(path, options);
+	}
+
+	Image TGADecoder::decode(std::unique_ptr<IReader> reader, const FilePathView, const ImageDecodeOptions& options) const
 	{
 		LOG_SCOPED_DEBUG("TGADecoder::decode()");
 
@@ -143,72 +154,67 @@ namespace s3d
 		const int32 width		= header.width;
 		const int32 height		= header.height;
 		const int32 pixelSize	= (header.bpp / 8);
-		const int32 data_bytes	= width * height * pixelSize;
+		const size_t rowBytes	= (static_cast<size_t>(width) * pixelSize);
 		const bool reversed		= !(header.attrib & 0x20);
 
-		std::unique_ptr<uint8[]> readPixels;
-		try
-		{
-			readPixels = std::make_unique<uint8[]>(data_bytes);
-		}
-		catch (const std::bad_alloc&)
+		ScanlineResampler resampler{ Size{ width, height }, options };
+
+		if (resampler.isEmpty())
 		{
 			return{};
 		}
 
-		reader->read(readPixels.get(), data_bytes);
+		Array<uint8> rowBuffer(rowBytes);
 
-		Image image{ Size{ width, height }, Color{ 255 } };
-
-		switch (header.bpp)
+		for (int32 y = 0; y < height; ++y)
 		{
-		case 24:
+			const int32 sourceY = (reversed ? (height - 1 - y) : y);
+
+			if (not resampler.needsRow(sourceY))
 			{
-				Color* pLine = image[reversed ? height - 1 : 0];
-				const uint8* pSrc = &readPixels[0];
-				int32 step = reversed ? -width : width;
+				reader->skip(static_cast<int64>(rowBytes));
+				continue;
+			}
 
-				for (int32 y = 0; y < height; ++y)
-				{
-					Color* pDst = pLine;
+			if (reader->read(rowBuffer.data(), static_cast<int64>(rowBytes)) != static_cast<int64>(rowBytes))
+			{
+				LOG_FAIL("❌ TGADecoder::decode(): Failed to read pixel data");
+				return{};
+			}
 
-					for (int32 x = 0; x < width; ++x)
-					{
-						pDst->set(pSrc[2], pSrc[1], pSrc[0]);
-						pSrc += 3;
-						++pDst;
-					}
+			const uint8* pSrc = rowBuffer.data();
+			Color* pDst = resampler.getRow(sourceY);
 
-					pLine += step;
+			if (header.bpp == 24)
+			{
+				for (int32 x = 0; x < width; ++x)
+				{
+					pDst->set(pSrc[2], pSrc[1], pSrc[0]);
+					pSrc += 3;
+					++pDst;
 				}
-
-				break;
 			}
-		case 32:
+			else
 			{
-				Color* pLine = image[reversed ? height - 1 : 0];
-				const uint8* pSrc = &readPixels[0];
-				int32 step = reversed ? -width : width;
-
-				for (int32 y = 0; y < height; ++y)
+				for (int32 x = 0; x < width; ++x)
 				{
-					Color* pDst = pLine;
-
-					for (int32 x = 0; x < width; ++x)
-					{
-						pDst->set(pSrc[2], pSrc[1], pSrc[0], pSrc[3]);
-						pSrc += 4;
-						++pDst;
-					}
-
-					pLine += step;
+					pDst->set(pSrc[2], pSrc[1], pSrc[0], pSrc[3]);
+					pSrc += 4;
+					++pDst;
 				}
+			}
 
+			resampler.commitRow(sourceY);
+
+			if (resampler.isCompleted())
+			{
 				break;
 			}
 		}
 
-		LOG_TRACE(fmt::format("Image ({}x{}) decoded", width, height));
+		Image image = resampler.finish();
+
+		LOG_TRACE(fmt::format("Image ({}x{}) decoded ({}x{})", image.width(), image.height(), width, height));
 
 		return image;
 	}
@@ -11,25 +11,174 @@
 
 # include <Siv3D/ImageProcessing.hpp>
 # include <Siv3D/Image.hpp>
+# include <Siv3D/Threading.hpp>
 
 # define STB_IMAGE_RESIZE_IMPLEMENTATION
 # include <ThirdParty/stb/stb_image_resize2.h>
 
 namespace s3d
 {
-	namespace ImageProcessing
+	namespace
 	{
+		/// @brief 1 つのスレッドが保持するリサイズプランの最大数
+		constexpr size_t MaxCachedResizePlans = 4;
+
+		/// @brief 分割して並列に処理する場合の、1 分割あたりの最小の出力行数
+		constexpr int32 MinRowsPerSplit = 64;
+
 		[[nodiscard]]
-		Image Resize(const Image& src, const Size& size)
+		static constexpr stbir_filter ToSTBIRFilter(const ResizeFilter filter) noexcept
+		{
+			switch (filter)
+			{
+			case ResizeFilter::Box:
+				return STBIR_FILTER_BOX;
+			case ResizeFilter::Triangle:
+				return STBIR_FILTER_TRIANGLE;
+			case ResizeFilter::CubicBSpline:
+				return STBIR_FILTER_CUBICBSPLINE;
+			case ResizeFilter::CatmullRom:
+				return STBIR_FILTER_CATMULLROM;
+			case ResizeFilter::Mitchell:
+				return STBIR_FILTER_MITCHELL;
+			case ResizeFilter::Nearest:
+				return STBIR_FILTER_POINT_SAMPLE;
+			default:
+				return STBIR_FILTER_DEFAULT;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ResizePlan
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 計算済みのフィルタ係数と作業領域を保持し、同じ条件の拡大縮小で再利用します。
+		/// @remark 1 つのプランを複数のスレッドから同時に使うことはできないため、スレッドごとにキャッシュします。
+		class ResizePlan
 		{
+		public:
+
+			ResizePlan(const Size& srcSize, const Size& dstSize, const ResizeFilter filter, const GammaCorrect gammaCorrect)
+				: m_srcSize{ srcSize }
+				, m_dstSize{ dstSize }
+				, m_filter{ filter }
+				, m_gammaCorrect{ gammaCorrect }
+			{
+				stbir_resize_init(&m_resize,
+					nullptr, srcSize.x, srcSize.y, 0,
+					nullptr, dstSize.x, dstSize.y, 0,
+					STBIR_RGBA_PM, (gammaCorrect ? STBIR_TYPE_UINT8_SRGB : STBIR_TYPE_UINT8));
+				stbir_set_edgemodes(&m_resize, STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP);
+				stbir_set_filters(&m_resize, ToSTBIRFilter(filter), ToSTBIRFilter(filter));
+
+				const int32 maxSplits = static_cast<int32>(Threading::GetConcurrency());
+				const int32 splits = Clamp((dstSize.y / MinRowsPerSplit), 1, Max(maxSplits, 1));
+				m_splits = stbir_build_samplers_with_splits(&m_resize, splits);
+			}
+
+			ResizePlan(const ResizePlan&) = delete;
+
+			ResizePlan& operator =(const ResizePlan&) = delete;
+
+			~ResizePlan()
+			{
+				stbir_free_samplers(&m_resize);
+			}
+
+			[[nodiscard]]
+			bool matches(const Size& srcSize, const Size& dstSize, const ResizeFilter filter, const GammaCorrect gammaCorrect) const noexcept
+			{
+				return ((m_srcSize == srcSize)
+					&& (m_dstSize == dstSize)
+					&& (m_filter == filter)
+					&& (m_gammaCorrect.getBool() == gammaCorrect.getBool()));
+			}
+
+			void resize(const Image& src, Image& dst)
+			{
+				if (m_splits <= 0)
+				{
+					return;
+				}
+
+				stbir_set_buffer_ptrs(&m_resize,
+					static_cast<const void*>(src.data()), static_cast<int32>(src.width() * sizeof(Color)),
+					static_cast<void*>(dst.data()), static_cast<int32>(dst.width() * sizeof(Color)));
+
+				if (m_splits == 1)
+				{
+					stbir_resize_extended(&m_resize);
+					return;
+				}
+
+				Threading::ParallelFor(static_cast<size_t>(m_splits), [&](const size_t begin, const size_t end)
+				{
+					stbir_resize_extended_split(&m_resize, static_cast<int32>(begin), static_cast<int32>(end - begin));
+				});
+			}
+
+		private:
+
+			STBIR_RESIZE m_resize;
+
+			Size m_srcSize;
+
+			Size m_dstSize;
+
+			ResizeFilter m_filter;
+
+			GammaCorrect m_gammaCorrect;
+
+			int32 m_splits = 0;
+		};
+
+		/// @brief 現在のスレッドで、条件に合うリサイズプランを返します。なければ作成します。
+		[[nodiscard]]
+		static ResizePlan& GetResizePlan(const Size& srcSize, const Size& dstSize, const ResizeFilter filter, const GammaCorrect gammaCorrect)
+		{
+			// 最近使ったものほど先頭に置く
+			thread_local Array<std::unique_ptr<ResizePlan>> t_plans;
+
+			for (auto it = t_plans.begin(); it != t_plans.end(); ++it)
+			{
+				if ((*it)->matches(srcSize, dstSize, filter, gammaCorrect))
+				{
+					std::rotate(t_plans.begin(), it, std::next(it));
+					return *t_plans.front();
+				}
+			}
+
+			if (MaxCachedResizePlans <= t_plans.size())
+			{
+				t_plans.pop_back();
+			}
+
+			t_plans.push_front(std::make_unique<ResizePlan>(srcSize, dstSize, filter, gammaCorrect));
+
+			return *t_plans.front();
+		}
+	}
+
+	namespace ImageProcessing
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	Resize
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image Resize(const Image& src, const Size& size, const ResizeFilter filter, const GammaCorrect gammaCorrect)
+		{
+			if ((not src) || (size.x <= 0) || (size.y <= 0))
+			{
+				return{};
+			}
+
 			Image dst{ size };
 
-			stbir_resize(
-				static_cast<const void*>(src.data()),
-				src.width(), src.height(), 0,
-				static_cast<void*>(dst.data()),
-				dst.width(), dst.height(), 0,
-				STBIR_RGBA_PM, STBIR_TYPE_UINT8, STBIR_EDGE_CLAMP, STBIR_FILTER_DEFAULT);
+			GetResizePlan(src.size(), size, filter, gammaCorrect).resize(src, dst);
 
 			return dst;
 		}
@@ -0,0 +1,837 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/EngineLog.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 1 つのタスクがまとめて処理し、転置して書き出す行数
+		constexpr size_t BandRows = 16;
+
+		/// @brief 並列処理する際の 1 チャンクあたりの最小の行数
+		constexpr size_t MinRowsPerChunk = 8;
+
+		/// @brief 固定小数点のカーネルの係数の小数部のビット数
+		constexpr int32 WeightBits = 14;
+
+		/// @brief 中間結果の小数部のビット数
+		constexpr int32 IntermediateBits = 6;
+
+		/// @brief 1 段目（Color → 中間結果）のシフト量
+		constexpr int32 FirstPassShift = (WeightBits - IntermediateBits);
+
+		/// @brief 2 段目（中間結果 → Color）のシフト量
+		constexpr int32 SecondPassShift = (WeightBits + IntermediateBits);
+
+		/// @brief 空のカーネルの代わりに使う恒等カーネル
+		constexpr float IdentityKernel[1] = { 1.0f };
+
+		/// @brief 固定小数点で畳み込めるカーネルの係数の絶対値の合計の最大値（int16 の中間結果があふれないようにする）
+		constexpr double MaxFixedKernelAbsSum = 2.0;
+
+		/// @brief 中間結果の画素。各チャンネルは小数部 6-bit の符号付き固定小数点数
+		struct Pixel16
+		{
+			int16 v[4];
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ConvolveRowsTransposed
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 各行を横方向に処理し、結果を転置して書き出します。
+		/// @param numRows 行数
+		/// @param rowLength 1 行の要素数
+		/// @param pDst 出力先。`rowLength` 行 × `numRows` 列として書き込まれます。
+		/// @param makeRowFunc 作業領域を持つ行処理関数 `(size_t row, Output* pOut)` を返す関数。チャンクごとに 1 回呼ばれます。
+		/// @remark 縦方向の処理も転置した行に対する横方向の処理になるため、メモリアクセスが常に連続になります。
+		template <class Output, class MakeRowFunc>
+		static void ConvolveRowsTransposed(const size_t numRows, const size_t rowLength, Output* pDst, MakeRowFunc makeRowFunc)
+		{
+			const size_t numBands = ((numRows + BandRows - 1) / BandRows);
+
+			Threading::ParallelFor(numBands, [&](const size_t begin, const size_t end)
+			{
+				auto rowFunc = makeRowFunc();
+				Array<Output> tile(BandRows * rowLength);
+
+				for (size_t band = begin; band < end; ++band)
+				{
+					const size_t row0 = (band * BandRows);
+					const size_t bandSize = Min(BandRows, (numRows - row0));
+
+					for (size_t i = 0; i < bandSize; ++i)
+					{
+						rowFunc((row0 + i), (tile.data() + (i * rowLength)));
+					}
+
+					for (size_t x = 0; x < rowLength; ++x)
+					{
+						Output* pOut = (pDst + (x * numRows + row0));
+
+						for (size_t i = 0; i < bandSize; ++i)
+						{
+							pOut[i] = tile[i * rowLength + x];
+						}
+					}
+				}
+			});
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	LoadPaddedRow
+		//
+		////////////////////////////////////////////////////////////////
+
+		static void StorePixel(const Color& src, int16* pDst) noexcept
+		{
+			pDst[0] = src.r;
+			pDst[1] = src.g;
+			pDst[2] = src.b;
+			pDst[3] = src.a;
+		}
+
+		static void StorePixel(const Pixel16& src, int16* pDst) noexcept
+		{
+			std::memcpy(pDst, src.v, sizeof(src.v));
+		}
+
+		/// @brief 1 行を int16 × 4 の配列に変換し、左右を端の画素で延長します。
+		/// @param pSrc 行の先頭
+		/// @param width 行の画素数
+		/// @param leftPad 左側に追加する画素数
+		/// @param rightPad 右側に追加する画素数
+		/// @param pDst 出力先。`(leftPad + width + rightPad) * 4` 要素が書き込まれます。
+		template <class Pixel>
+		static void LoadPaddedRow(const Pixel* pSrc, const size_t width, const size_t leftPad, const size_t rightPad, int16* pDst) noexcept
+		{
+			for (size_t i = 0; i < leftPad; ++i)
+			{
+				StorePixel(pSrc[0], (pDst + (i * 4)));
+			}
+
+			pDst += (leftPad * 4);
+
+			for (size_t x = 0; x < width; ++x)
+			{
+				StorePixel(pSrc[x], (pDst + (x * 4)));
+			}
+
+			pDst += (width * 4);
+
+			for (size_t i = 0; i < rightPad; ++i)
+			{
+				StorePixel(pSrc[width - 1], (pDst + (i * 4)));
+			}
+		}
+
+		/// @brief 1 行を左右を端の要素で延長してコピーします。
+		static void LoadPaddedRow(const float* pSrc, const size_t width, const size_t leftPad, const size_t rightPad, float* pDst) noexcept
+		{
+			std::fill_n(pDst, leftPad, pSrc[0]);
+			std::copy_n(pSrc, width, (pDst + leftPad));
+			std::fill_n((pDst + leftPad + width), rightPad, pSrc[width - 1]);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	FixedKernel
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 固定小数点に変換したカーネル
+		struct FixedKernel
+		{
+			/// @brief Q14 の係数。SIMD で 2 タップずつ処理するため、要素数は偶数に切り上げられ、末尾は 0 で埋められる
+			Array<int16> weights;
+
+			/// @brief 中心のタップのインデックス
+			size_t center = 0;
+		};
+
+		/// @brief カーネルの係数の絶対値の合計を返します。
+		[[nodiscard]]
+		static double AbsSum(const std::span<const float> kernel) noexcept
+		{
+			double sum = 0.0;
+
+			for (const float weight : kernel)
+			{
+				sum += std::abs(weight);
+			}
+
+			return sum;
+		}
+
+		/// @brief カーネルを Q14 の固定小数点に変換します。
+		/// @remark 丸め誤差によって係数の合計が変わらないよう、絶対値が最大の係数で差を吸収します。
+		[[nodiscard]]
+		static FixedKernel MakeFixedKernel(std::span<const float> kernel)
+		{
+			if (kernel.empty())
+			{
+				kernel = IdentityKernel;
+			}
+
+			constexpr double One = (1 << WeightBits);
+
+			FixedKernel result;
+			result.weights.resize(((kernel.size() + 1) & ~size_t{ 1 }), 0);
+			result.center = (kernel.size() / 2);
+
+			double sum = 0.0;
+			int32 fixedSum = 0;
+			size_t maxIndex = 0;
+
+			for (size_t i = 0; i < kernel.size(); ++i)
+			{
+				const int32 weight = Clamp(static_cast<int32>(std::lround(kernel[i] * One)), -32768, 32767);
+				result.weights[i] = static_cast<int16>(weight);
+				sum += kernel[i];
+				fixedSum += weight;
+
+				if (std::abs(kernel[maxIndex]) < std::abs(kernel[i]))
+				{
+					maxIndex = i;
+				}
+			}
+
+			const int32 adjusted = (result.weights[maxIndex] + (static_cast<int32>(std::lround(sum * One)) - fixedSum));
+			result.weights[maxIndex] = static_cast<int16>(Clamp(adjusted, -32768, 32767));
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ConvolveRowFixed
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 延長済みの int16 × 4 の行に固定小数点のカーネルを畳み込みます。
+		/// @param pSrc 延長済みの行。出力画素 x は `pSrc[(x + k) * 4]` (k = 0, ..., numTaps - 1) を参照します。
+		/// @param pWeights Q14 の係数
+		/// @param numTaps 係数の個数（偶数）
+		/// @param pDst 出力先
+		/// @param width 出力する画素数
+		/// @param shift 積和の結果を右シフトする量
+		static void ConvolveRowFixed_plain(const int16* pSrc, const int16* pWeights, const size_t numTaps, int16* pDst, const size_t width, const int32 shift) noexcept
+		{
+			const int32 bias = (1 << (shift - 1));
+
+			for (size_t x = 0; x < width; ++x)
+			{
+				for (size_t c = 0; c < 4; ++c)
+				{
+					int32 sum = bias;
+
+					for (size_t k = 0; k < numTaps; ++k)
+					{
+						sum += (pSrc[(x + k) * 4 + c] * pWeights[k]);
+					}
+
+					pDst[x * 4 + c] = static_cast<int16>(Clamp((sum >> shift), -32768, 32767));
+				}
+			}
+		}
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		static void ConvolveRowFixed_SSE2(const int16* pSrc, const int16* pWeights, const size_t numTaps, int16* pDst, const size_t width, const int32 shift) noexcept
+		{
+			const __m128i bias = ::_mm_set1_epi32(1 << (shift - 1));
+			const __m128i count = ::_mm_cvtsi32_si128(shift);
+			size_t x = 0;
+
+			for (; (x + 2) <= width; x += 2)
+			{
+				const int16* p = (pSrc + (x * 4));
+				__m128i sum0 = bias;
+				__m128i sum1 = bias;
+
+				for (size_t k = 0; k < numTaps; k += 2)
+				{
+					// [p(x+k) p(x+k+1)], [p(x+k+1) p(x+k+2)]
+					const __m128i a = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + (k * 4)));
+					const __m128i b = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + ((k + 1) * 4)));
+					const __m128i w = ::_mm_set1_epi32(static_cast<int32>(static_cast<uint16>(pWeights[k]) | (static_cast<uint32>(static_cast<uint16>(pWeights[k + 1])) << 16)));
+
+					// 出力 x: p(x+k) * w[k] + p(x+k+1) * w[k+1], 出力 x+1: p(x+k+1) * w[k] + p(x+k+2) * w[k+1]
+					sum0 = ::_mm_add_epi32(sum0, ::_mm_madd_epi16(::_mm_unpacklo_epi16(a, b), w));
+					sum1 = ::_mm_add_epi32(sum1, ::_mm_madd_epi16(::_mm_unpackhi_epi16(a, b), w));
+				}
+
+				const __m128i result = ::_mm_packs_epi32(::_mm_sra_epi32(sum0, count), ::_mm_sra_epi32(sum1, count));
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + (x * 4)), result);
+			}
+
+			ConvolveRowFixed_plain((pSrc + (x * 4)), pWeights, numTaps, (pDst + (x * 4)), (width - x), shift);
+		}
+
+	# elif SIV3D_INTRINSIC(NEON)
+
+		static void ConvolveRowFixed_NEON(const int16* pSrc, const int16* pWeights, const size_t numTaps, int16* pDst, const size_t width, const int32 shift) noexcept
+		{
+			const int32x4_t bias = vdupq_n_s32(1 << (shift - 1));
+			const int32x4_t count = vdupq_n_s32(-shift);
+			size_t x = 0;
+
+			for (; (x + 2) <= width; x += 2)
+			{
+				const int16* p = (pSrc + (x * 4));
+				int32x4_t sum0 = bias;
+				int32x4_t sum1 = bias;
+
+				for (size_t k = 0; k < numTaps; ++k)
+				{
+					// [p(x+k) p(x+k+1)]
+					const int16x8_t a = vld1q_s16(p + (k * 4));
+					sum0 = vmlal_n_s16(sum0, vget_low_s16(a), pWeights[k]);
+					sum1 = vmlal_n_s16(sum1, vget_high_s16(a), pWeights[k]);
+				}
+
+				const int16x8_t result = vcombine_s16(vqmovn_s32(vshlq_s32(sum0, count)), vqmovn_s32(vshlq_s32(sum1, count)));
+				vst1q_s16((pDst + (x * 4)), result);
+			}
+
+			ConvolveRowFixed_plain((pSrc + (x * 4)), pWeights, numTaps, (pDst + (x * 4)), (width - x), shift);
+		}
+
+	# endif
+
+		static void ConvolveRowFixed(const int16* pSrc, const int16* pWeights, const size_t numTaps, int16* pDst, const size_t width, const int32 shift) noexcept
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			ConvolveRowFixed_SSE2(pSrc, pWeights, numTaps, pDst, width, shift);
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			ConvolveRowFixed_NEON(pSrc, pWeights, numTaps, pDst, width, shift);
+
+		# else
+
+			ConvolveRowFixed_plain(pSrc, pWeights, numTaps, pDst, width, shift);
+
+		# endif
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ConvolveRowFloat
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 延長済みの float の行にカーネルを畳み込みます。
+		/// @param pSrc 延長済みの行。出力要素 x は `pSrc[x + k]` (k = 0, ..., numTaps - 1) を参照します。
+		/// @param pWeights 係数
+		/// @param numTaps 係数の個数
+		/// @param pDst 出力先
+		/// @param width 出力する要素数
+		static void ConvolveRowFloat_plain(const float* pSrc, const float* pWeights, const size_t numTaps, float* pDst, const size_t width) noexcept
+		{
+			for (size_t x = 0; x < width; ++x)
+			{
+				float sum = 0.0f;
+
+				for (size_t k = 0; k < numTaps; ++k)
+				{
+					sum += (pSrc[x + k] * pWeights[k]);
+				}
+
+				pDst[x] = sum;
+			}
+		}
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		static void ConvolveRowFloat_SSE2(const float* pSrc, const float* pWeights, const size_t numTaps, float* pDst, const size_t width) noexcept
+		{
+			size_t x = 0;
+
+			for (; (x + 4) <= width; x += 4)
+			{
+				__m128 sum = ::_mm_setzero_ps();
+
+				for (size_t k = 0; k < numTaps; ++k)
+				{
+					sum = ::_mm_add_ps(sum, ::_mm_mul_ps(::_mm_loadu_ps(pSrc + x + k), ::_mm_set1_ps(pWeights[k])));
+				}
+
+				::_mm_storeu_ps((pDst + x), sum);
+			}
+
+			ConvolveRowFloat_plain((pSrc + x), pWeights, numTaps, (pDst + x), (width - x));
+		}
+
+	# elif SIV3D_INTRINSIC(NEON)
+
+		static void ConvolveRowFloat_NEON(const float* pSrc, const float* pWeights, const size_t numTaps, float* pDst, const size_t width) noexcept
+		{
+			size_t x = 0;
+
+			for (; (x + 4) <= width; x += 4)
+			{
+				float32x4_t sum = vdupq_n_f32(0.0f);
+
+				for (size_t k = 0; k < numTaps; ++k)
+				{
+					sum = vmlaq_n_f32(sum, vld1q_f32(pSrc + x + k), pWeights[k]);
+				}
+
+				vst1q_f32((pDst + x), sum);
+			}
+
+			ConvolveRowFloat_plain((pSrc + x), pWeights, numTaps, (pDst + x), (width - x));
+		}
+
+	# endif
+
+		static void ConvolveRowFloat(const float* pSrc, const float* pWeights, const size_t numTaps, float* pDst, const size_t width) noexcept
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			ConvolveRowFloat_SSE2(pSrc, pWeights, numTaps, pDst, width);
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			ConvolveRowFloat_NEON(pSrc, pWeights, numTaps, pDst, width);
+
+		# else
+
+			ConvolveRowFloat_plain(pSrc, pWeights, numTaps, pDst, width);
+
+		# endif
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BoxRow
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 延長済みの int16 × 4 の行に対して、累積和で (2 * radius + 1) 画素の平均を計算します。
+		/// @param pSrc 延長済みの行。左右に radius 画素ずつ延長されている必要があります。
+		/// @param radius 半径
+		/// @param pDst 出力先
+		/// @param width 出力する画素数
+		/// @param scale 平均に掛ける値を 2^32 倍した値
+		/// @param shift 平均を右シフトする量（32 を含む）
+		static void BoxRowFixed(const int16* pSrc, const size_t radius, int16* pDst, const size_t width, const int64 scale, const int32 shift) noexcept
+		{
+			const size_t diameter = (radius * 2 + 1);
+			const int64 bias = (int64{ 1 } << (shift - 1));
+			int64 sum[4] = {};
+
+			for (size_t k = 0; k < diameter; ++k)
+			{
+				for (size_t c = 0; c < 4; ++c)
+				{
+					sum[c] += pSrc[k * 4 + c];
+				}
+			}
+
+			for (size_t x = 0; x < width; ++x)
+			{
+				for (size_t c = 0; c < 4; ++c)
+				{
+					pDst[x * 4 + c] = static_cast<int16>((sum[c] * scale + bias) >> shift);
+				}
+
+				if ((x + 1) < width)
+				{
+					for (size_t c = 0; c < 4; ++c)
+					{
+						sum[c] += (pSrc[(x + diameter) * 4 + c] - pSrc[x * 4 + c]);
+					}
+				}
+			}
+		}
+
+		static void BoxRowFloat(const float* pSrc, const size_t radius, float* pDst, const size_t width) noexcept
+		{
+			const size_t diameter = (radius * 2 + 1);
+			const double scale = (1.0 / diameter);
+			double sum = 0.0;
+
+			for (size_t k = 0; k < diameter; ++k)
+			{
+				sum += pSrc[k];
+			}
+
+			for (size_t x = 0; x < width; ++x)
+			{
+				pDst[x] = static_cast<float>(sum * scale);
+
+				if ((x + 1) < width)
+				{
+					sum += (static_cast<double>(pSrc[x + diameter]) - pSrc[x]);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ToColorRow
+		//
+		////////////////////////////////////////////////////////////////
+
+		static void ToColorRow(const int16* pSrc, Color* pDst, const size_t width) noexcept
+		{
+			for (size_t x = 0; x < width; ++x)
+			{
+				const int16* p = (pSrc + (x * 4));
+				pDst[x] = Color{ static_cast<uint8>(Clamp<int32>(p[0], 0, 255)), static_cast<uint8>(Clamp<int32>(p[1], 0, 255)),
+					static_cast<uint8>(Clamp<int32>(p[2], 0, 255)), static_cast<uint8>(Clamp<int32>(p[3], 0, 255)) };
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ConvolveSeparable
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 画像に横方向と縦方向の処理を順に適用します。
+		/// @param rowFirst 1 段目の処理 `(const int16* pPadded, int16* pDst, size_t width)`
+		/// @param rowSecond 2 段目の処理 `(const int16* pPadded, int16* pDst, size_t width)`
+		/// @param padX 1 段目の行の左右に追加する画素数
+		/// @param padY 2 段目の行の左右に追加する画素数
+		template <class RowFirst, class RowSecond>
+		[[nodiscard]]
+		static Image ConvolveSeparable(const Image& src, const std::pair<size_t, size_t> padX, const std::pair<size_t, size_t> padY, RowFirst rowFirst, RowSecond rowSecond)
+		{
+			const size_t width = src.width();
+			const size_t height = src.height();
+
+			// 1 段目: src の各行 → 転置された中間結果（width 行 × height 列）
+			Array<Pixel16> transposed(width * height);
+
+			ConvolveRowsTransposed(height, width, transposed.data(), [&]()
+			{
+				return [&, padded = Array<int16>((padX.first + width + padX.second) * 4)](const size_t y, Pixel16* pOut) mutable
+				{
+					LoadPaddedRow(src[y], width, padX.first, padX.second, padded.data());
+					rowFirst(padded.data(), reinterpret_cast<int16*>(pOut), width);
+				};
+			});
+
+			// 2 段目: 中間結果の各行（元の列）→ 再度転置して元の向きに戻す
+			Image result{ src.size() };
+
+			ConvolveRowsTransposed(width, height, result.data(), [&]()
+			{
+				return [&, padded = Array<int16>((padY.first + height + padY.second) * 4), row = Array<int16>(height * 4)](const size_t x, Color* pOut) mutable
+				{
+					LoadPaddedRow((transposed.data() + (x * height)), height, padY.first, padY.second, padded.data());
+					rowSecond(padded.data(), row.data(), height);
+					ToColorRow(row.data(), pOut, height);
+				};
+			});
+
+			return result;
+		}
+
+		/// @brief 2 次元配列に横方向と縦方向の処理を順に適用します。
+		/// @param rowFunc 処理 `(bool second, const float* pPadded, float* pDst, size_t width)`
+		/// @param padX 1 段目の行の左右に追加する要素数
+		/// @param padY 2 段目の行の左右に追加する要素数
+		template <class RowFunc>
+		[[nodiscard]]
+		static Grid<float> ConvolveSeparable(const Grid<float>& src, const std::pair<size_t, size_t> padX, const std::pair<size_t, size_t> padY, RowFunc rowFunc)
+		{
+			const size_t width = src.width();
+			const size_t height = src.height();
+			const float* pSrc = src.data();
+
+			Array<float> transposed(width * height);
+
+			ConvolveRowsTransposed(height, width, transposed.data(), [&]()
+			{
+				return [&, padded = Array<float>(padX.first + width + padX.second)](const size_t y, float* pOut) mutable
+				{
+					LoadPaddedRow((pSrc + (y * width)), width, padX.first, padX.second, padded.data());
+					rowFunc(false, padded.data(), pOut, width);
+				};
+			});
+
+			Grid<float> result(width, height);
+
+			ConvolveRowsTransposed(width, height, result.data(), [&]()
+			{
+				return [&, padded = Array<float>(padY.first + height + padY.second)](const size_t x, float* pOut) mutable
+				{
+					LoadPaddedRow((transposed.data() + (x * height)), height, padY.first, padY.second, padded.data());
+					rowFunc(true, padded.data(), pOut, height);
+				};
+			});
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	MakeGaussianKernel
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 合計が 1 になるよう正規化したガウスカーネルを作成します。
+		[[nodiscard]]
+		static Array<float> MakeGaussianKernel(const double sigma)
+		{
+			const int32 radius = static_cast<int32>(std::ceil(sigma * 3.0));
+			const double s = (-0.5 / (sigma * sigma));
+
+			Array<double> weights(radius * 2 + 1);
+			double sum = 0.0;
+
+			for (int32 i = -radius; i <= radius; ++i)
+			{
+				sum += (weights[i + radius] = std::exp(i * i * s));
+			}
+
+			Array<float> kernel(weights.size());
+
+			for (size_t i = 0; i < weights.size(); ++i)
+			{
+				kernel[i] = static_cast<float>(weights[i] / sum);
+			}
+
+			return kernel;
+		}
+	}
+
+	namespace ImageProcessing
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	SeparableConvolve
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image SeparableConvolve(const Image& src, const std::span<const float> kernelX, const std::span<const float> kernelY)
+		{
+			if (not src)
+			{
+				return{};
+			}
+
+			// float の丸め誤差は許容する
+			if (const double sumX = AbsSum(kernelX), sumY = AbsSum(kernelY);
+				((MaxFixedKernelAbsSum + 1e-4) < sumX) || ((MaxFixedKernelAbsSum + 1e-4) < sumY))
+			{
+				LOG_FAIL(fmt::format("❌ ImageProcessing::SeparableConvolve(): The sum of the absolute values of the kernel weights must be {} or less (kernelX: {}, kernelY: {})", MaxFixedKernelAbsSum, sumX, sumY));
+				return{};
+			}
+
+			const FixedKernel fx = MakeFixedKernel(kernelX);
+			const FixedKernel fy = MakeFixedKernel(kernelY);
+
+			// 出力画素 x は延長済みの行の [x, x + numTaps) を参照する（SIMD で 1 画素余分に読むため +1）
+			const std::pair<size_t, size_t> padX{ fx.center, (fx.weights.size() - fx.center) };
+			const std::pair<size_t, size_t> padY{ fy.center, (fy.weights.size() - fy.center) };
+
+			return ConvolveSeparable(src, padX, padY,
+				[&](const int16* pPadded, int16* pDst, const size_t width)
+				{
+					ConvolveRowFixed(pPadded, fx.weights.data(), fx.weights.size(), pDst, width, FirstPassShift);
+				},
+				[&](const int16* pPadded, int16* pDst, const size_t width)
+				{
+					ConvolveRowFixed(pPadded, fy.weights.data(), fy.weights.size(), pDst, width, SecondPassShift);
+				});
+		}
+
+		Grid<float> SeparableConvolve(const Grid<float>& src, std::span<const float> kernelX, std::span<const float> kernelY)
+		{
+			if (not src)
+			{
+				return{};
+			}
+
+			if (kernelX.empty())
+			{
+				kernelX = IdentityKernel;
+			}
+
+			if (kernelY.empty())
+			{
+				kernelY = IdentityKernel;
+			}
+
+			const std::pair<size_t, size_t> padX{ (kernelX.size() / 2), (kernelX.size() - 1 - kernelX.size() / 2) };
+			const std::pair<size_t, size_t> padY{ (kernelY.size() / 2), (kernelY.size() - 1 - kernelY.size() / 2) };
+
+			return ConvolveSeparable(src, padX, padY,
+				[&](const bool second, const float* pPadded, float* pDst, const size_t width)
+				{
+					const std::span<const float> kernel = (second ? kernelY : kernelX);
+					ConvolveRowFloat(pPadded, kernel.data(), kernel.size(), pDst, width);
+				});
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GaussianBlur
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image GaussianBlur(const Image& src, const double sigma)
+		{
+			if (sigma <= 0.0)
+			{
+				return src;
+			}
+
+			const Array<float> kernel = MakeGaussianKernel(sigma);
+			return SeparableConvolve(src, kernel, kernel);
+		}
+
+		Grid<float> GaussianBlur(const Grid<float>& src, const double sigma)
+		{
+			if (sigma <= 0.0)
+			{
+				return src;
+			}
+
+			const Array<float> kernel = MakeGaussianKernel(sigma);
+			return SeparableConvolve(src, kernel, kernel);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BoxBlur
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image BoxBlur(const Image& src, const int32 radius)
+		{
+			if (not src)
+			{
+				return{};
+			}
+
+			if (radius <= 0)
+			{
+				return src;
+			}
+
+			const size_t r = radius;
+			const std::pair<size_t, size_t> pad{ r, r };
+			const int64 scale = static_cast<int64>(std::llround(4294967296.0 / (r * 2 + 1)));
+
+			return ConvolveSeparable(src, pad, pad,
+				[&](const int16* pPadded, int16* pDst, const size_t width)
+				{
+					BoxRowFixed(pPadded, r, pDst, width, scale, (32 - IntermediateBits));
+				},
+				[&](const int16* pPadded, int16* pDst, const size_t width)
+				{
+					BoxRowFixed(pPadded, r, pDst, width, scale, (32 + IntermediateBits));
+				});
+		}
+
+		Grid<float> BoxBlur(const Grid<float>& src, const int32 radius)
+		{
+			if (not src)
+			{
+				return{};
+			}
+
+			if (radius <= 0)
+			{
+				return src;
+			}
+
+			const size_t r = radius;
+			const std::pair<size_t, size_t> pad{ r, r };
+
+			return ConvolveSeparable(src, pad, pad,
+				[&](bool, const float* pPadded, float* pDst, const size_t width)
+				{
+					BoxRowFloat(pPadded, r, pDst, width);
+				});
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Sharpen
+		//
+		////////////////////////////////////////////////////////////////
+
+		Image Sharpen(const Image& src, const double sigma, const double amount)
+		{
+			if ((sigma <= 0.0) || (amount == 0.0))
+			{
+				return src;
+			}
+
+			const Image blurred = GaussianBlur(src, sigma);
+			Image result{ src.size() };
+			const float a = static_cast<float>(amount);
+
+			Threading::ParallelFor(static_cast<size_t>(src.height()), [&](const size_t begin, const size_t end)
+			{
+				const size_t width = src.width();
+
+				for (size_t y = begin; y < end; ++y)
+				{
+					const Color* pSrc = src[y];
+					const Color* pBlurred = blurred[y];
+					Color* pDst = result[y];
+
+					for (size_t x = 0; x < width; ++x)
+					{
+						const Color s = pSrc[x];
+						const Color b = pBlurred[x];
+
+						pDst[x] = Color{
+							static_cast<uint8>(Clamp(std::lround(s.r + a * (s.r - b.r)), 0L, 255L)),
+							static_cast<uint8>(Clamp(std::lround(s.g + a * (s.g - b.g)), 0L, 255L)),
+							static_cast<uint8>(Clamp(std::lround(s.b + a * (s.b - b.b)), 0L, 255L)),
+							s.a };
+					}
+				}
+			}, MinRowsPerChunk);
+
+			return result;
+		}
+
+		Grid<float> Sharpen(const Grid<float>& src, const double sigma, const double amount)
+		{
+			if ((sigma <= 0.0) || (amount == 0.0))
+			{
+				return src;
+			}
+
+			Grid<float> result = GaussianBlur(src, sigma);
+			const float a = static_cast<float>(amount);
+			const float* pSrc = src.data();
+			float* pDst = result.data();
+
+			for (size_t i = 0; i < result.num_elements(); ++i)
+			{
+				pDst[i] = (pSrc[i] + a * (pSrc[i] - pDst[i]));
+			}
+
+			return result;
+		}
+	}
+}
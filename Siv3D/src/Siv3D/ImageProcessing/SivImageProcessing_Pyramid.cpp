@@ -0,0 +1,432 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/SIMD.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 並列処理する際の 1 チャンクあたりの最小の行数
+		constexpr size_t MinRowsPerChunk = 8;
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	LinearImage
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 各チャンネル 16-bit の RGBA 画像。ガンマ補正を行う場合、RGB は線形の値を持つ
+		struct LinearImage
+		{
+			uint32 width = 0;
+
+			uint32 height = 0;
+
+			Array<uint16> pixels;
+
+			LinearImage() = default;
+
+			LinearImage(const uint32 _width, const uint32 _height)
+				: width{ _width }
+				, height{ _height }
+				, pixels((static_cast<size_t>(_width) * _height * 4)) {}
+
+			[[nodiscard]]
+			uint16* operator [](const size_t y) noexcept
+			{
+				return (pixels.data() + (y * width * 4));
+			}
+
+			[[nodiscard]]
+			const uint16* operator [](const size_t y) const noexcept
+			{
+				return (pixels.data() + (y * width * 4));
+			}
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	sRGB <-> Linear
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief sRGB の 8-bit 値から、線形の 16-bit 値への変換表を返します。
+		[[nodiscard]]
+		static const std::array<uint16, 256>& GetSRGBToLinearTable()
+		{
+			static const std::array<uint16, 256> table = []()
+			{
+				std::array<uint16, 256> t{};
+
+				for (size_t i = 0; i < t.size(); ++i)
+				{
+					const double c = (i / 255.0);
+					const double linear = ((c <= 0.04045) ? (c / 12.92) : std::pow(((c + 0.055) / 1.055), 2.4));
+					t[i] = static_cast<uint16>(std::lround(linear * 65535.0));
+				}
+
+				return t;
+			}();
+
+			return table;
+		}
+
+		/// @brief 線形の 16-bit 値から、sRGB の 8-bit 値への変換表を返します。
+		[[nodiscard]]
+		static const Array<uint8>& GetLinearToSRGBTable()
+		{
+			static const Array<uint8> table = []()
+			{
+				Array<uint8> t(65536);
+
+				for (size_t i = 0; i < t.size(); ++i)
+				{
+					const double linear = (i / 65535.0);
+					const double c = ((linear <= 0.0031308) ? (linear * 12.92) : ((1.055 * std::pow(linear, (1.0 / 2.4))) - 0.055));
+					t[i] = static_cast<uint8>(std::lround(c * 255.0));
+				}
+
+				return t;
+			}();
+
+			return table;
+		}
+
+		/// @brief 16-bit 値を 8-bit 値に丸めます。
+		[[nodiscard]]
+		static constexpr uint8 To8Bit(const uint32 value) noexcept
+		{
+			return static_cast<uint8>(((value * 255) + 32767) / 65535);
+		}
+
+		[[nodiscard]]
+		static LinearImage ToLinearImage(const Image& image, const bool gammaCorrect)
+		{
+			const std::array<uint16, 256>& toLinear = GetSRGBToLinearTable();
+			LinearImage result{ static_cast<uint32>(image.width()), static_cast<uint32>(image.height()) };
+
+			Threading::ParallelFor(result.height, [&](const size_t begin, const size_t end)
+			{
+				for (size_t y = begin; y < end; ++y)
+				{
+					const Color* pSrc = image[y];
+					uint16* pDst = result[y];
+
+					for (uint32 x = 0; x < result.width; ++x)
+					{
+						if (gammaCorrect)
+						{
+							pDst[0] = toLinear[pSrc->r];
+							pDst[1] = toLinear[pSrc->g];
+							pDst[2] = toLinear[pSrc->b];
+						}
+						else
+						{
+							pDst[0] = static_cast<uint16>(pSrc->r * 257);
+							pDst[1] = static_cast<uint16>(pSrc->g * 257);
+							pDst[2] = static_cast<uint16>(pSrc->b * 257);
+						}
+
+						pDst[3] = static_cast<uint16>(pSrc->a * 257);
+						++pSrc;
+						pDst += 4;
+					}
+				}
+			}, MinRowsPerChunk);
+
+			return result;
+		}
+
+		static void ToColorRow(const uint16* pSrc, Color* pDst, const uint32 width, const bool gammaCorrect)
+		{
+			const Array<uint8>& toSRGB = GetLinearToSRGBTable();
+
+			for (uint32 x = 0; x < width; ++x)
+			{
+				if (gammaCorrect)
+				{
+					pDst->r = toSRGB[pSrc[0]];
+					pDst->g = toSRGB[pSrc[1]];
+					pDst->b = toSRGB[pSrc[2]];
+				}
+				else
+				{
+					pDst->r = To8Bit(pSrc[0]);
+					pDst->g = To8Bit(pSrc[1]);
+					pDst->b = To8Bit(pSrc[2]);
+				}
+
+				pDst->a = To8Bit(pSrc[3]);
+				pSrc += 4;
+				++pDst;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DownsampleRow2x2
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 2 行の入力から、2x2 画素の平均で 1 行を出力します。
+		/// @remark 縦方向、横方向の順に切り上げの平均 `(a + b + 1) / 2` をとります。SIMD 版と同じ結果になります。
+		static void DownsampleRow2x2_plain(const uint16* pSrc0, const uint16* pSrc1, uint16* pDst, const size_t dstWidth)
+		{
+			for (size_t x = 0; x < dstWidth; ++x)
+			{
+				for (size_t c = 0; c < 4; ++c)
+				{
+					const uint32 left = ((pSrc0[c] + pSrc1[c] + 1u) >> 1);
+					const uint32 right = ((pSrc0[4 + c] + pSrc1[4 + c] + 1u) >> 1);
+					pDst[c] = static_cast<uint16>((left + right + 1) >> 1);
+				}
+
+				pSrc0 += 8;
+				pSrc1 += 8;
+				pDst += 4;
+			}
+		}
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		static void DownsampleRow2x2_SSE2(const uint16* pSrc0, const uint16* pSrc1, uint16* pDst, const size_t dstWidth)
+		{
+			size_t x = 0;
+
+			for (; (x + 2) <= dstWidth; x += 2)
+			{
+				const __m128i a0 = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0));
+				const __m128i a1 = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + 8));
+				const __m128i b0 = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1));
+				const __m128i b1 = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + 8));
+
+				// 縦方向の平均 [p0 p1], [p2 p3]
+				const __m128i v0 = ::_mm_avg_epu16(a0, b0);
+				const __m128i v1 = ::_mm_avg_epu16(a1, b1);
+
+				// 横方向の平均 ([p0 p2] + [p1 p3]) / 2
+				const __m128i left = ::_mm_unpacklo_epi64(v0, v1);
+				const __m128i right = ::_mm_unpackhi_epi64(v0, v1);
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), ::_mm_avg_epu16(left, right));
+
+				pSrc0 += 16;
+				pSrc1 += 16;
+				pDst += 8;
+			}
+
+			DownsampleRow2x2_plain(pSrc0, pSrc1, pDst, (dstWidth - x));
+		}
+
+	# elif SIV3D_INTRINSIC(NEON)
+
+		static void DownsampleRow2x2_NEON(const uint16* pSrc0, const uint16* pSrc1, uint16* pDst, const size_t dstWidth)
+		{
+			size_t x = 0;
+
+			for (; (x + 2) <= dstWidth; x += 2)
+			{
+				const uint16x8_t v0 = vrhaddq_u16(vld1q_u16(pSrc0), vld1q_u16(pSrc1));
+				const uint16x8_t v1 = vrhaddq_u16(vld1q_u16(pSrc0 + 8), vld1q_u16(pSrc1 + 8));
+
+				const uint16x8_t left = vcombine_u16(vget_low_u16(v0), vget_low_u16(v1));
+				const uint16x8_t right = vcombine_u16(vget_high_u16(v0), vget_high_u16(v1));
+				vst1q_u16(pDst, vrhaddq_u16(left, right));
+
+				pSrc0 += 16;
+				pSrc1 += 16;
+				pDst += 8;
+			}
+
+			DownsampleRow2x2_plain(pSrc0, pSrc1, pDst, (dstWidth - x));
+		}
+
+	# endif
+
+		static void DownsampleRow2x2(const uint16* pSrc0, const uint16* pSrc1, uint16* pDst, const size_t dstWidth)
+		{
+		# if SIV3D_INTRINSIC(SSE)
+
+			DownsampleRow2x2_SSE2(pSrc0, pSrc1, pDst, dstWidth);
+
+		# elif SIV3D_INTRINSIC(NEON)
+
+			DownsampleRow2x2_NEON(pSrc0, pSrc1, pDst, dstWidth);
+
+		# else
+
+			DownsampleRow2x2_plain(pSrc0, pSrc1, pDst, dstWidth);
+
+		# endif
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DownsampleRowBox
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 縮小時に 1 つの出力画素が参照する入力画素と、その重み（合計 256）
+		struct BoxTaps
+		{
+			uint32 index[3]{};
+
+			uint32 weight[3]{};
+
+			uint32 count = 0;
+		};
+
+		/// @brief srcSize の軸を dstSize に縮小するときの面積平均の重みを計算します。
+		/// @remark dstSize == Max(1, srcSize / 2) であれば、1 つの出力画素が参照する入力画素は最大 3 つです。
+		[[nodiscard]]
+		static Array<BoxTaps> MakeBoxTaps(const uint32 srcSize, const uint32 dstSize)
+		{
+			Array<BoxTaps> taps(dstSize);
+
+			for (uint32 i = 0; i < dstSize; ++i)
+			{
+				// 入力の座標を dstSize 倍した空間で、出力画素 i が覆う範囲 [begin, end) と入力画素 k の重なりを求める
+				const uint64 begin = (uint64{ i } * srcSize);
+				const uint64 end = (begin + srcSize);
+				BoxTaps& t = taps[i];
+				uint32 total = 0;
+
+				for (uint64 k = (begin / dstSize); (((k * dstSize) < end) && (t.count < 3)); ++k)
+				{
+					const uint64 overlap = (Min(end, ((k + 1) * dstSize)) - Max(begin, (k * dstSize)));
+					const uint32 weight = static_cast<uint32>(((overlap * 256) + (srcSize / 2)) / srcSize);
+					t.index[t.count] = static_cast<uint32>(k);
+					t.weight[t.count] = weight;
+					++t.count;
+					total += weight;
+				}
+
+				// 丸め誤差を先頭の重みで吸収する
+				t.weight[0] = (t.weight[0] + 256 - total);
+			}
+
+			return taps;
+		}
+
+		/// @brief 奇数サイズを含む任意の 1/2 縮小で、1 行を出力します。
+		static void DownsampleRowBox(const LinearImage& src, const BoxTaps& yTaps, const Array<BoxTaps>& xTaps, uint16* pDst)
+		{
+			for (const auto& tx : xTaps)
+			{
+				uint32 sum[4]{};
+
+				for (uint32 j = 0; j < yTaps.count; ++j)
+				{
+					const uint16* pSrcLine = src[yTaps.index[j]];
+
+					for (uint32 i = 0; i < tx.count; ++i)
+					{
+						// 重みの積の合計は 65536 なので、uint32 に収まる
+						const uint32 weight = (yTaps.weight[j] * tx.weight[i]);
+						const uint16* pSrc = (pSrcLine + (tx.index[i] * 4));
+
+						for (size_t c = 0; c < 4; ++c)
+						{
+							sum[c] += (pSrc[c] * weight);
+						}
+					}
+				}
+
+				for (size_t c = 0; c < 4; ++c)
+				{
+					pDst[c] = static_cast<uint16>((sum[c] + 32768) >> 16);
+				}
+
+				pDst += 4;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	DownsampleHalf
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief 幅と高さを半分（最小 1）に縮小し、16-bit の結果と 8-bit の画像の両方を出力します。
+		static void DownsampleHalf(const LinearImage& src, LinearImage& dst, Image& image, const bool gammaCorrect)
+		{
+			const uint32 dstWidth = Max(1u, (src.width / 2));
+			const uint32 dstHeight = Max(1u, (src.height / 2));
+			const bool even = (((src.width % 2) == 0) && ((src.height % 2) == 0));
+
+			dst = LinearImage{ dstWidth, dstHeight };
+			image = Image{ dstWidth, dstHeight };
+
+			const Array<BoxTaps> xTaps = (even ? Array<BoxTaps>{} : MakeBoxTaps(src.width, dstWidth));
+			const Array<BoxTaps> yTaps = (even ? Array<BoxTaps>{} : MakeBoxTaps(src.height, dstHeight));
+
+			Threading::ParallelFor(dstHeight, [&](const size_t begin, const size_t end)
+			{
+				for (size_t y = begin; y < end; ++y)
+				{
+					if (even)
+					{
+						DownsampleRow2x2(src[y * 2], src[y * 2 + 1], dst[y], dstWidth);
+					}
+					else
+					{
+						DownsampleRowBox(src, yTaps[y], xTaps, dst[y]);
+					}
+
+					ToColorRow(dst[y], image[y], dstWidth, gammaCorrect);
+				}
+			}, MinRowsPerChunk);
+		}
+	}
+
+	namespace ImageProcessing
+	{
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildPyramid
+		//
+		////////////////////////////////////////////////////////////////
+
+		Array<Image> BuildPyramid(const Image& src, const GammaCorrect gammaCorrect, const IncludeSource includeSource)
+		{
+			if (not src)
+			{
+				return{};
+			}
+
+			const uint8 levels = CalculateMipmapLevel(src.width(), src.height());
+
+			Array<Image> pyramid;
+			pyramid.reserve(levels);
+
+			if (includeSource)
+			{
+				pyramid.push_back(src);
+			}
+
+			LinearImage current = ToLinearImage(src, gammaCorrect.getBool());
+			LinearImage next;
+
+			for (uint8 level = 1; level < levels; ++level)
+			{
+				Image image;
+				DownsampleHalf(current, next, image, gammaCorrect.getBool());
+				pyramid.push_back(std::move(image));
+				std::swap(current, next);
+			}
+
+			return pyramid;
+		}
+	}
+}
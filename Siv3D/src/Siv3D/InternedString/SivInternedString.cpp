@@ -0,0 +1,297 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <cstring>
+# include <memory>
+# include <mutex>
+# include <Siv3D/InternedString.hpp>
+# include <Siv3D/HashSet.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/FormatData.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	InternTable
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief インターン化された文字列の表
+	/// @remark 文字列のハッシュ値の上位ビットで分割したシャードごとにロックを持ち、異なるシャードへの操作は並行して行える
+	struct InternTable
+	{
+		using Entry = InternedString::Entry;
+
+		/// @brief シャードの個数のビット数
+		static constexpr uint32 ShardBits = 6;
+
+		/// @brief シャードの個数
+		static constexpr size_t NumShards = (size_t{ 1 } << ShardBits);
+
+		/// @brief アリーナのブロックのサイズ（uint64 単位）
+		static constexpr size_t BlockSize = (64 * 1024 / sizeof(uint64));
+
+		[[nodiscard]]
+		static StringView ToView(const Entry* entry) noexcept
+		{
+			return{ reinterpret_cast<const char32*>(entry + 1), entry->length };
+		}
+
+		/// @brief 表を検索するためのキー
+		struct Key
+		{
+			StringView view;
+
+			uint64 hash;
+		};
+
+		struct EntryHash
+		{
+			using is_transparent = void;
+
+			[[nodiscard]]
+			size_t operator ()(const Entry* entry) const noexcept
+			{
+				return static_cast<size_t>(entry->hash);
+			}
+
+			[[nodiscard]]
+			size_t operator ()(const Key& key) const noexcept
+			{
+				return static_cast<size_t>(key.hash);
+			}
+		};
+
+		struct EntryEqual
+		{
+			using is_transparent = void;
+
+			[[nodiscard]]
+			bool operator ()(const Entry* lhs, const Entry* rhs) const noexcept
+			{
+				return (lhs == rhs);
+			}
+
+			[[nodiscard]]
+			bool operator ()(const Entry* entry, const Key& key) const noexcept
+			{
+				return ((entry->hash == key.hash) && (ToView(entry) == key.view));
+			}
+
+			[[nodiscard]]
+			bool operator ()(const Key& key, const Entry* entry) const noexcept
+			{
+				return operator ()(entry, key);
+			}
+		};
+
+		/// @brief 文字列の実体を確保するアリーナ
+		/// @remark 確保したメモリはプログラムの終了まで解放しない
+		class Arena
+		{
+		public:
+
+			[[nodiscard]]
+			const Entry* create(const Key& key)
+			{
+				// Entry の直後に終端文字を含む文字列を置き、uint64 単位に切り上げる
+				const size_t bytes = (sizeof(Entry) + ((key.view.size() + 1) * sizeof(char32)));
+				const size_t words = ((bytes + sizeof(uint64) - 1) / sizeof(uint64));
+
+				uint64* p = allocate(words);
+
+				Entry* entry = ::new (p) Entry{ key.hash, key.view.size() };
+				char32* dst = reinterpret_cast<char32*>(entry + 1);
+				std::memcpy(dst, key.view.data(), (key.view.size() * sizeof(char32)));
+				dst[key.view.size()] = U'\0';
+
+				return entry;
+			}
+
+		private:
+
+			[[nodiscard]]
+			uint64* allocate(const size_t words)
+			{
+				// 大きな文字列には専用のブロックを割り当てる
+				if ((BlockSize / 4) < words)
+				{
+					return m_blocks.emplace_back(std::make_unique_for_overwrite<uint64[]>(words)).get();
+				}
+
+				if ((BlockSize - m_used) < words)
+				{
+					m_current = m_blocks.emplace_back(std::make_unique_for_overwrite<uint64[]>(BlockSize)).get();
+					m_used = 0;
+				}
+
+				uint64* p = (m_current + m_used);
+				m_used += words;
+				return p;
+			}
+
+			Array<std::unique_ptr<uint64[]>> m_blocks;
+
+			uint64* m_current = nullptr;
+
+			size_t m_used = BlockSize;
+		};
+
+		struct alignas(64) Shard
+		{
+			std::mutex mutex;
+
+			HashSet<const Entry*, EntryHash, EntryEqual> entries;
+
+			Arena arena;
+		};
+
+		std::array<Shard, NumShards> shards;
+
+		[[nodiscard]]
+		Shard& getShard(const uint64 hash) noexcept
+		{
+			return shards[static_cast<size_t>(hash >> (64 - ShardBits))];
+		}
+
+		[[nodiscard]]
+		const Entry* intern(const StringView s)
+		{
+			const Key key{ s, s.hash() };
+			Shard& shard = getShard(key.hash);
+
+			std::lock_guard lock{ shard.mutex };
+
+			if (auto it = shard.entries.find(key); it != shard.entries.end())
+			{
+				return *it;
+			}
+
+			const Entry* entry = shard.arena.create(key);
+			shard.entries.insert(entry);
+			return entry;
+		}
+
+		[[nodiscard]]
+		const Entry* find(const StringView s)
+		{
+			const Key key{ s, s.hash() };
+			Shard& shard = getShard(key.hash);
+
+			std::lock_guard lock{ shard.mutex };
+
+			if (auto it = shard.entries.find(key); it != shard.entries.end())
+			{
+				return *it;
+			}
+
+			return nullptr;
+		}
+
+		[[nodiscard]]
+		size_t count()
+		{
+			size_t result = 0;
+
+			for (auto& shard : shards)
+			{
+				std::lock_guard lock{ shard.mutex };
+				result += shard.entries.size();
+			}
+
+			return result;
+		}
+
+		[[nodiscard]]
+		static InternTable& Get()
+		{
+			// 静的オブジェクトのデストラクタから使われても安全なように、表は破棄しない
+			static InternTable* table = new InternTable;
+			return *table;
+		}
+	};
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	InternedString::InternedString(const StringView s)
+		: m_entry{ s.isEmpty() ? nullptr : InternTable::Get().intern(s) } {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Find
+	//
+	////////////////////////////////////////////////////////////////
+
+	Optional<InternedString> InternedString::Find(const StringView s)
+	{
+		if (s.isEmpty())
+		{
+			return InternedString{};
+		}
+
+		if (const Entry* entry = InternTable::Get().find(s))
+		{
+			return InternedString{ entry };
+		}
+
+		return none;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Count
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t InternedString::Count()
+	{
+		return InternTable::Get().count();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator <<
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::ostream& operator <<(std::ostream& output, const InternedString& value)
+	{
+		return (output << Unicode::ToUTF8(value.view()));
+	}
+
+	std::wostream& operator <<(std::wostream& output, const InternedString& value)
+	{
+		return (output << Unicode::ToWstring(value.view()));
+	}
+
+	std::basic_ostream<char32>& operator <<(std::basic_ostream<char32>& output, const InternedString& value)
+	{
+		return output.write(value.data(), value.size());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Formatter
+	//
+	////////////////////////////////////////////////////////////////
+
+	void Formatter(FormatData& formatData, const InternedString& value)
+	{
+		formatData.string.append(value.view());
+	}
+}
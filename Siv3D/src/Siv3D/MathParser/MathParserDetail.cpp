@@ -385,4 +385,211 @@ namespace s3d
 			}
 		}
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	compile
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::shared_ptr<const CompiledExpression::CompiledExpressionDetail> MathParser::MathParserDetail::compile(const std::span<const StringView> columnVariables) const
+	{
+		using Detail = CompiledExpression::CompiledExpressionDetail;
+		using OpCode = Detail::OpCode;
+
+		try
+		{
+			Array<const double*> columns(Arg::reserve = columnVariables.size());
+			{
+				const mu::varmap_type& variables = m_parser.GetVar();
+
+				for (const auto& name : columnVariables)
+				{
+					const auto it = variables.find(Unicode::ToWstring(name));
+
+					if (it == variables.end())
+					{
+						m_errorMessage = (L"Undefined column variable: " + Unicode::ToWstring(name));
+						return nullptr;
+					}
+
+					columns << it->second;
+				}
+			}
+
+			// 評価せずにバイトコードだけを生成させる（代入を含む数式で変数が書き換わらないようにする）
+			{
+				const mu::varmap_type& usedVariables = m_parser.GetUsedVar();
+				const mu::varmap_type& variables = m_parser.GetVar();
+
+				for (const auto& usedVariable : usedVariables)
+				{
+					if (not variables.contains(usedVariable.first))
+					{
+						m_errorMessage = (L"Undefined variable: " + usedVariable.first);
+						return nullptr;
+					}
+				}
+			}
+
+			const auto findColumn = [&](const double* p) -> Optional<uint32>
+			{
+				for (uint32 i = 0; i < columns.size(); ++i)
+				{
+					if (columns[i] == p)
+					{
+						return i;
+					}
+				}
+
+				return none;
+			};
+
+			const mu::ParserByteCode& byteCode = m_parser.GetByteCode();
+			const mu::SToken* tokens = byteCode.GetBase();
+
+			for (const mu::SToken* pTok = tokens; pTok->Cmd != mu::cmEND; ++pTok)
+			{
+				if (pTok->Cmd == mu::cmASSIGN)
+				{
+					m_errorMessage = L"The assignment operator cannot be used in a compiled expression";
+					return nullptr;
+				}
+			}
+
+			Array<Detail::Instruction> program(Arg::reserve = byteCode.GetSize());
+			size_t depth = 0;
+			size_t maxDepth = 0;
+			size_t maxMultiArgs = 0;
+
+			const auto emit = [&](const Detail::Instruction& instruction, const size_t numPopped, const size_t numPushed)
+			{
+				program << instruction;
+				depth = (depth - numPopped + numPushed);
+				maxDepth = Max(maxDepth, depth);
+			};
+
+			// 列として指定されなかった変数は、現在の値で定数にする
+			const auto emitVariable = [&](const OpCode columnOp, const double* p, const double a, const double b, const double constant)
+			{
+				if (const auto column = findColumn(p))
+				{
+					emit({ .op = columnOp, .index = *column, .a = a, .b = b }, 0, 1);
+				}
+				else
+				{
+					emit({ .op = OpCode::Constant, .a = constant }, 0, 1);
+				}
+			};
+
+			for (const mu::SToken* pTok = tokens; pTok->Cmd != mu::cmEND; ++pTok)
+			{
+				switch (pTok->Cmd)
+				{
+				case mu::cmLE:		emit({ .op = OpCode::LessEqual }, 2, 1); break;
+				case mu::cmGE:		emit({ .op = OpCode::GreaterEqual }, 2, 1); break;
+				case mu::cmNEQ:		emit({ .op = OpCode::NotEqual }, 2, 1); break;
+				case mu::cmEQ:		emit({ .op = OpCode::Equal }, 2, 1); break;
+				case mu::cmLT:		emit({ .op = OpCode::Less }, 2, 1); break;
+				case mu::cmGT:		emit({ .op = OpCode::Greater }, 2, 1); break;
+				case mu::cmADD:		emit({ .op = OpCode::Add }, 2, 1); break;
+				case mu::cmSUB:		emit({ .op = OpCode::Subtract }, 2, 1); break;
+				case mu::cmMUL:		emit({ .op = OpCode::Multiply }, 2, 1); break;
+				case mu::cmDIV:		emit({ .op = OpCode::Divide }, 2, 1); break;
+				case mu::cmPOW:		emit({ .op = OpCode::Pow }, 2, 1); break;
+				case mu::cmLAND:	emit({ .op = OpCode::LogicalAnd }, 2, 1); break;
+				case mu::cmLOR:		emit({ .op = OpCode::LogicalOr }, 2, 1); break;
+				case mu::cmIF:		emit({ .op = OpCode::If }, 0, 0); break;
+				case mu::cmELSE:	emit({ .op = OpCode::Else }, 0, 0); break;
+				case mu::cmENDIF:	emit({ .op = OpCode::EndIf }, 3, 1); break;
+				case mu::cmVAL:		emit({ .op = OpCode::Constant, .a = pTok->Val.data2 }, 0, 1); break;
+				case mu::cmVAR:
+					{
+						const double x = *pTok->Val.ptr;
+						emitVariable(OpCode::Column, pTok->Val.ptr, 0.0, 0.0, x);
+						break;
+					}
+				case mu::cmVARPOW2:
+					{
+						const double x = *pTok->Val.ptr;
+						emitVariable(OpCode::ColumnPow2, pTok->Val.ptr, 0.0, 0.0, (x * x));
+						break;
+					}
+				case mu::cmVARPOW3:
+					{
+						const double x = *pTok->Val.ptr;
+						emitVariable(OpCode::ColumnPow3, pTok->Val.ptr, 0.0, 0.0, (x * x * x));
+						break;
+					}
+				case mu::cmVARPOW4:
+					{
+						const double x = *pTok->Val.ptr;
+						emitVariable(OpCode::ColumnPow4, pTok->Val.ptr, 0.0, 0.0, (x * x * x * x));
+						break;
+					}
+				case mu::cmVARMUL:
+					{
+						// 最適化で変数が消えた場合は ptr が nullptr になる
+						if (pTok->Val.ptr == nullptr)
+						{
+							emit({ .op = OpCode::Constant, .a = pTok->Val.data2 }, 0, 1);
+						}
+						else
+						{
+							const double x = *pTok->Val.ptr;
+							emitVariable(OpCode::ColumnMulAdd, pTok->Val.ptr, pTok->Val.data, pTok->Val.data2, (x * pTok->Val.data + pTok->Val.data2));
+						}
+
+						break;
+					}
+				case mu::cmFUNC:
+					{
+						const int32 argc = pTok->Fun.argc;
+
+						if (10 < argc)
+						{
+							m_errorMessage = L"Functions with more than 10 arguments cannot be compiled";
+							return nullptr;
+						}
+
+						if (0 <= argc)
+						{
+							emit({ .op = OpCode::Function, .index = static_cast<uint32>(argc), .function = pTok->Fun.cb }, argc, 1);
+						}
+						else
+						{
+							// 可変長引数の関数は、引数の数を負の値で持つ
+							const size_t numArgs = static_cast<size_t>(-argc);
+							emit({ .op = OpCode::MultiArgFunction, .index = static_cast<uint32>(numArgs), .function = pTok->Fun.cb }, numArgs, 1);
+							maxMultiArgs = Max(maxMultiArgs, numArgs);
+						}
+
+						break;
+					}
+				default:
+					m_errorMessage = L"String functions and bulk functions cannot be used in a compiled expression";
+					return nullptr;
+				}
+			}
+
+			if (1 < depth)
+			{
+				m_errorMessage = L"Expressions with multiple results cannot be compiled";
+				return nullptr;
+			}
+			else if (depth != 1)
+			{
+				m_errorMessage = L"Failed to compile the expression";
+				return nullptr;
+			}
+
+			m_errorMessage.clear();
+			return std::make_shared<const Detail>(std::move(program), columns.size(), maxDepth, maxMultiArgs);
+		}
+		catch (mu::Parser::exception_type& e)
+		{
+			m_errorMessage = e.GetMsg();
+			return nullptr;
+		}
+	}
 }
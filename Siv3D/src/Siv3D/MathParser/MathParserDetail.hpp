@@ -10,7 +10,9 @@
 //-----------------------------------------------
 
 # pragma once
+# include <span>
 # include <Siv3D/MathParser.hpp>
+# include <Siv3D/CompiledExpression/CompiledExpressionDetail.hpp>
 # include <ThirdParty/muparser/muParser.h>
 
 namespace s3d
@@ -92,6 +94,9 @@ namespace s3d
 
 		void eval(double* dst, size_t count) const;
 
+		[[nodiscard]]
+		std::shared_ptr<const CompiledExpression::CompiledExpressionDetail> compile(std::span<const StringView> columnVariables) const;
+
 	private:
 
 		mu::Parser m_parser;
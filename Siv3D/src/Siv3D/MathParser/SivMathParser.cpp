@@ -310,6 +310,23 @@ namespace s3d
 		return pImpl->validPostfixCharacters();
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	compile
+	//
+	////////////////////////////////////////////////////////////////
+
+	CompiledExpression MathParser::compile(const std::initializer_list<StringView> columnVariables) const
+	{
+		return CompiledExpression{ pImpl->compile(std::span<const StringView>{ columnVariables.begin(), columnVariables.end() }) };
+	}
+
+	CompiledExpression MathParser::compile(const Array<String>& columnVariables) const
+	{
+		const Array<StringView> names = columnVariables.map([](const String& name) { return StringView{ name }; });
+		return CompiledExpression{ pImpl->compile(names) };
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	eval
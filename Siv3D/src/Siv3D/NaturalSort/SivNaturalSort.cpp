@@ -9,11 +9,249 @@
 //
 //-----------------------------------------------
 
+# include <array>
+# include <cstring>
+# include <utility>
 # include <Siv3D/NaturalSort.hpp>
 # include <Siv3D/Char.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Threading.hpp>
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief 数字のブロックの先頭に置くバイト
+		/// @remark 数字以外の文字 ch は `ch + 1` として符号化されるため、U'0' + 1 は数字以外の文字と重ならず、U'/' と U':' の間に並ぶ
+		constexpr uint8 DigitBlockMarker = (U'0' + 1);
+
+		/// @brief 文字の並びの終端を表すバイト（どの文字よりも小さい）
+		constexpr uint8 Terminator = 0x00;
+
+		/// @brief 符号化した長さの最大サイズ（バイト）
+		constexpr size_t MaxLengthSize = 9;
+
+		/// @brief 基数ソートで比較するキーの最大長（バイト）
+		constexpr size_t RadixSortMaxKeyLength = 16;
+
+		/// @brief 基数ソートを使う最小の要素数
+		constexpr size_t RadixSortMinCount = 256;
+
+		/// @brief 並列実行時に 1 つのタスクで処理する最小の要素数
+		constexpr size_t MinChunkSize = 4096;
+
+		/// @brief 大小関係を保ったまま長さを符号化します。
+		[[nodiscard]]
+		static uint8* WriteLength(uint8* dst, const size_t length) noexcept
+		{
+			if (length < 0xFF)
+			{
+				*dst++ = static_cast<uint8>(length);
+				return dst;
+			}
+
+			*dst++ = 0xFF;
+
+			for (int32 shift = 56; 0 <= shift; shift -= 8)
+			{
+				*dst++ = static_cast<uint8>(static_cast<uint64>(length) >> shift);
+			}
+
+			return dst;
+		}
+
+		/// @brief 大小関係を保ったまま文字を符号化します。
+		/// @remark 0 を終端に使うため `ch + 1` を UTF-8 と同じ方法で符号化します。UTF-8 のバイト列の辞書順はコードポイント順と一致します。
+		[[nodiscard]]
+		static uint8* WriteChar(uint8* dst, const char32 ch) noexcept
+		{
+			const uint32 c = (static_cast<uint32>(ch) + 1);
+
+			if (c < 0x80)
+			{
+				*dst++ = static_cast<uint8>(c);
+			}
+			else if (c < 0x800)
+			{
+				*dst++ = static_cast<uint8>(0xC0 | (c >> 6));
+				*dst++ = static_cast<uint8>(0x80 | (c & 0x3F));
+			}
+			else if (c < 0x10000)
+			{
+				*dst++ = static_cast<uint8>(0xE0 | (c >> 12));
+				*dst++ = static_cast<uint8>(0x80 | ((c >> 6) & 0x3F));
+				*dst++ = static_cast<uint8>(0x80 | (c & 0x3F));
+			}
+			else
+			{
+				*dst++ = static_cast<uint8>(0xF0 | ((c >> 18) & 0x07));
+				*dst++ = static_cast<uint8>(0x80 | ((c >> 12) & 0x3F));
+				*dst++ = static_cast<uint8>(0x80 | ((c >> 6) & 0x3F));
+				*dst++ = static_cast<uint8>(0x80 | (c & 0x3F));
+			}
+
+			return dst;
+		}
+
+		/// @brief バイト列のうち、指定した位置から 8 バイトをビッグエンディアンの整数として読み込みます。（範囲外は 0 で埋める）
+		[[nodiscard]]
+		static uint64 LoadBigEndian(const char* data, const size_t size, const size_t offset) noexcept
+		{
+			uint64 result = 0;
+
+			for (size_t i = 0; i < 8; ++i)
+			{
+				const size_t pos = (offset + i);
+				result = ((result << 8) | ((pos < size) ? static_cast<uint8>(data[pos]) : 0));
+			}
+
+			return result;
+		}
+
+		struct KeyRef
+		{
+			/// @brief 共通の接頭辞を除いた、キーの先頭 16 バイト
+			uint64 head[2];
+
+			/// @brief 元の配列でのインデックス
+			size_t index;
+		};
+
+		/// @brief キーの比較関数
+		/// @remark キーの先頭 16 バイトをキャッシュした整数で比較し、等しい場合だけ残りのバイト列を比較する
+		struct KeyLess
+		{
+			/// @brief 各キーのバイト列
+			const std::string_view* keys;
+
+			/// @brief すべてのキーに共通する接頭辞の長さ
+			size_t prefixLength;
+
+			[[nodiscard]]
+			bool operator()(const KeyRef& lhs, const KeyRef& rhs) const noexcept
+			{
+				if (lhs.head[0] != rhs.head[0])
+				{
+					return (lhs.head[0] < rhs.head[0]);
+				}
+
+				if (lhs.head[1] != rhs.head[1])
+				{
+					return (lhs.head[1] < rhs.head[1]);
+				}
+
+				const std::string_view lhsKey = keys[lhs.index];
+				const std::string_view rhsKey = keys[rhs.index];
+				const size_t offset = (prefixLength + RadixSortMaxKeyLength);
+
+				if ((offset < lhsKey.size()) || (offset < rhsKey.size()))
+				{
+					const auto cmp = NaturalSortKey::Compare(lhsKey.substr(Min(offset, lhsKey.size())), rhsKey.substr(Min(offset, rhsKey.size())));
+
+					if (cmp != 0)
+					{
+						return (cmp < 0);
+					}
+				}
+
+				// 安定にするため、キーが等しい場合は元の順序を保つ
+				return (lhs.index < rhs.index);
+			}
+		};
+
+		/// @brief キャッシュした先頭 16 バイトでキーを LSD 基数ソートします。
+		/// @remark どのキーも他のキーの接頭辞にならないため、短いキーの末尾を 0 で埋めて比較しても順序は変わらない
+		static void RadixSort(Array<KeyRef>& keys)
+		{
+			const size_t n = keys.size();
+
+			// すべての桁のヒストグラムを 1 回の走査で求める
+			Array<std::array<size_t, 256>> counts(RadixSortMaxKeyLength);
+
+			for (const auto& key : keys)
+			{
+				for (size_t digit = 0; digit < RadixSortMaxKeyLength; ++digit)
+				{
+					++counts[digit][(key.head[digit / 8] >> ((7 - (digit % 8)) * 8)) & 0xFF];
+				}
+			}
+
+			Array<KeyRef> buffer(n);
+
+			for (size_t digit = RadixSortMaxKeyLength; digit-- > 0;)
+			{
+				auto& count = counts[digit];
+
+				// すべてのキーでこの桁が同じ場合は並びが変わらない
+				if (std::ranges::find(count, n) != count.end())
+				{
+					continue;
+				}
+
+				size_t offset = 0;
+
+				for (auto& c : count)
+				{
+					offset += std::exchange(c, offset);
+				}
+
+				const size_t word = (digit / 8);
+				const size_t shift = ((7 - (digit % 8)) * 8);
+
+				for (const auto& key : keys)
+				{
+					buffer[count[(key.head[word] >> shift) & 0xFF]++] = key;
+				}
+
+				keys.swap(buffer);
+			}
+		}
+
+		/// @brief キーを区間ごとに並列にソートし、区間を並列にマージします。
+		static void ParallelMergeSort(Array<KeyRef>& keys, const KeyLess& less)
+		{
+			const size_t n = keys.size();
+			const size_t numChunks = Min(Threading::GetConcurrency(), Max<size_t>(1, (n / MinChunkSize)));
+
+			if (numChunks <= 1)
+			{
+				std::ranges::sort(keys, less);
+				return;
+			}
+
+			const auto chunkBegin = [=](const size_t chunk) { return ((n * chunk) / numChunks); };
+
+			Threading::ParallelFor(numChunks, [&](const size_t begin, const size_t end)
+				{
+					for (size_t chunk = begin; chunk < end; ++chunk)
+					{
+						std::sort((keys.begin() + chunkBegin(chunk)), (keys.begin() + chunkBegin(chunk + 1)), less);
+					}
+				});
+
+			for (size_t width = 1; width < numChunks; width *= 2)
+			{
+				const size_t numMerges = ((numChunks + (2 * width) - 1) / (2 * width));
+
+				Threading::ParallelFor(numMerges, [&](const size_t begin, const size_t end)
+					{
+						for (size_t i = begin; i < end; ++i)
+						{
+							const size_t first = (i * 2 * width);
+							const size_t middle = Min((first + width), numChunks);
+							const size_t last = Min((first + 2 * width), numChunks);
+
+							if (middle < last)
+							{
+								std::inplace_merge((keys.begin() + chunkBegin(first)), (keys.begin() + chunkBegin(middle)), (keys.begin() + chunkBegin(last)), less);
+							}
+						}
+					});
+			}
+		}
+	}
+
 	int32 NaturalSortCompare(const StringView left, const StringView right) noexcept
 	{
 		size_t leftIndex = 0;
@@ -115,4 +353,223 @@ namespace s3d
 	{
 		return (NaturalSortCompare(left, right) < 0);
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	NaturalSortKey
+	//
+	////////////////////////////////////////////////////////////////
+
+	NaturalSortKey::NaturalSortKey(const StringView s)
+	{
+		Encode(s, m_bytes);
+	}
+
+	const char* NaturalSortKey::data() const noexcept
+	{
+		return m_bytes.data();
+	}
+
+	size_t NaturalSortKey::size() const noexcept
+	{
+		return m_bytes.size();
+	}
+
+	void NaturalSortKey::Encode(const StringView s, std::string& dst)
+	{
+		const size_t length = s.size();
+		const size_t offset = dst.size();
+
+		// 1 文字あたり最大 4 バイト、1 桁の数字のブロックは最大 (2 + MaxLengthSize) バイト
+		const size_t maxSize = (offset + (length * (1 + MaxLengthSize)) + 1 + MaxLengthSize);
+
+		dst.resize_and_overwrite(maxSize, [&](char* const buffer, size_t)
+			{
+				uint8* p = reinterpret_cast<uint8*>(buffer + offset);
+
+				size_t i = 0;
+
+				while (i < length)
+				{
+					const char32 ch = s[i];
+
+					if (not IsDigit(ch))
+					{
+						p = WriteChar(p, ch);
+						++i;
+						continue;
+					}
+
+					// 数字のブロックは、先頭の 0 を除いた有効桁数を前置して並べる
+					// 有効桁数が多いほど大きく、有効桁数が同じなら各桁の辞書順で比較できる
+					size_t nonZeroIndex = i;
+
+					while ((nonZeroIndex < length) && (s[nonZeroIndex] == U'0'))
+					{
+						++nonZeroIndex;
+					}
+
+					size_t blockEnd = nonZeroIndex;
+
+					while ((blockEnd < length) && IsDigit(s[blockEnd]))
+					{
+						++blockEnd;
+					}
+
+					*p++ = DigitBlockMarker;
+					p = WriteLength(p, (blockEnd - nonZeroIndex));
+
+					for (size_t k = nonZeroIndex; k < blockEnd; ++k)
+					{
+						*p++ = static_cast<uint8>(s[k] - U'0');
+					}
+
+					i = blockEnd;
+				}
+
+				// NaturalSortCompare() と同様に、数値として等しい場合は文字列の長さで順序を決める
+				*p++ = Terminator;
+				p = WriteLength(p, length);
+
+				return static_cast<size_t>(reinterpret_cast<char*>(p) - buffer);
+			});
+	}
+
+	std::strong_ordering NaturalSortKey::Compare(const std::string_view lhs, const std::string_view rhs) noexcept
+	{
+		const size_t size = Min(lhs.size(), rhs.size());
+
+		if (size)
+		{
+			if (const int32 cmp = std::memcmp(lhs.data(), rhs.data(), size);
+				cmp != 0)
+			{
+				return ((cmp < 0) ? std::strong_ordering::less : std::strong_ordering::greater);
+			}
+		}
+
+		return (lhs.size() <=> rhs.size());
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	SortNatural
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SortNatural(const std::span<String> values, const Parallelize parallelize)
+	{
+		const size_t n = values.size();
+
+		if (n < 2)
+		{
+			return;
+		}
+
+		// 各文字列のキーを一度だけ作成する
+		const size_t numChunks = (parallelize ? Min((Threading::GetConcurrency() * 4), Max<size_t>(1, (n / MinChunkSize))) : 1);
+
+		Array<std::string> buffers(numChunks);
+		Array<std::string_view> keys(n);
+
+		const auto encodeChunk = [&](const size_t chunk)
+			{
+				const size_t begin = ((n * chunk) / numChunks);
+				const size_t end = ((n * (chunk + 1)) / numChunks);
+
+				std::string& buffer = buffers[chunk];
+
+				Array<size_t> sizes(Arg::reserve = (end - begin));
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const size_t offset = buffer.size();
+					NaturalSortKey::Encode(values[i], buffer);
+					sizes.push_back(buffer.size() - offset);
+				}
+
+				// バッファの再確保が終わってから参照を作る
+				const char* p = buffer.data();
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					keys[i] = std::string_view{ p, sizes[i - begin] };
+					p += sizes[i - begin];
+				}
+			};
+
+		const auto forEachChunk = [&](const auto& f)
+			{
+				if (numChunks == 1)
+				{
+					f(0);
+					return;
+				}
+
+				Threading::ParallelFor(numChunks, [&](const size_t begin, const size_t end)
+					{
+						for (size_t chunk = begin; chunk < end; ++chunk)
+						{
+							f(chunk);
+						}
+					});
+			};
+
+		forEachChunk(encodeChunk);
+
+		// すべてのキーに共通する接頭辞は比較に影響しないので読み飛ばす
+		size_t prefixLength = keys[0].size();
+		size_t maxKeyLength = 0;
+
+		for (const auto& key : keys)
+		{
+			const size_t maxLength = Min(prefixLength, key.size());
+			size_t i = 0;
+
+			while ((i < maxLength) && (key[i] == keys[0][i]))
+			{
+				++i;
+			}
+
+			prefixLength = i;
+			maxKeyLength = Max(maxKeyLength, key.size());
+		}
+
+		Array<KeyRef> refs(n);
+
+		forEachChunk([&](const size_t chunk)
+			{
+				const size_t begin = ((n * chunk) / numChunks);
+				const size_t end = ((n * (chunk + 1)) / numChunks);
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const std::string_view key = keys[i];
+					refs[i] = { { LoadBigEndian(key.data(), key.size(), prefixLength), LoadBigEndian(key.data(), key.size(), (prefixLength + 8)) }, i };
+				}
+			});
+
+		if ((RadixSortMinCount <= n) && ((maxKeyLength - prefixLength) <= RadixSortMaxKeyLength))
+		{
+			RadixSort(refs);
+		}
+		else if (parallelize)
+		{
+			ParallelMergeSort(refs, KeyLess{ keys.data(), prefixLength });
+		}
+		else
+		{
+			std::ranges::sort(refs, KeyLess{ keys.data(), prefixLength });
+		}
+
+		// 並び替えた順に文字列を移動する
+		Array<String> sorted(Arg::reserve = n);
+
+		for (const auto& ref : refs)
+		{
+			sorted.push_back(std::move(values[ref.index]));
+		}
+
+		std::ranges::move(sorted, values.begin());
+	}
 }
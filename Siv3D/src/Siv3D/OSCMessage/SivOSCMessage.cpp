@@ -44,6 +44,19 @@ namespace s3d
 		}
 	}
 
+	OSCMessage& OSCMessage::beginBundle(const uint64 timeTag)
+	{
+		try
+		{
+			pImpl->getStream() << osc::BeginBundle(timeTag);
+			return *this;
+		}
+		catch (const osc::OutOfBufferMemoryException&)
+		{
+			throw Error{ "OSCMessage::beginBundle(), out of buffer" };
+		}
+	}
+
 	OSCMessage& OSCMessage::endBundle()
 	{
 		try
@@ -399,6 +412,39 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	size
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t OSCMessage::size() const
+	{
+		return pImpl->getStreamPtr()->Size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isReady
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool OSCMessage::isReady() const
+	{
+		return pImpl->getStreamPtr()->IsReady();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void OSCMessage::clear()
+	{
+		pImpl->getStream().Clear();
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	_detail
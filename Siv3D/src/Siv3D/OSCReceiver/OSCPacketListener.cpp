@@ -9,118 +9,79 @@
 //
 //-----------------------------------------------
 
-# include <Siv3D/Unicode.hpp>
 # include "OSCPacketListener.hpp"
 
 namespace s3d
 {
-	bool OSCPacketListener::hasMessages()
+	bool OSCPacketListener::hasMessages() const noexcept
 	{
-		std::lock_guard lock{ m_mutex };
-
-		return (not m_messages.empty());
+		return (not m_messages.isEmpty());
 	}
 
-	size_t OSCPacketListener::num_messages()
+	size_t OSCPacketListener::num_messages() const noexcept
 	{
-		std::lock_guard lock{ m_mutex };
-
 		return m_messages.size();
 	}
 
-	OSCReceivedMessage OSCPacketListener::pop()
+	bool OSCPacketListener::tryPop(std::string& message)
 	{
-		std::lock_guard lock{ m_mutex };
-
-		OSCReceivedMessage message = m_messages.front();
-
-		m_messages.pop();
-
-		return message;
+		return m_messages.tryPop(message);
 	}
 
 	void OSCPacketListener::clear()
 	{
-		std::lock_guard lock{ m_mutex };
+		m_messages.clear();
+	}
 
-		while (not m_messages.empty())
+	void OSCPacketListener::processPacket(const char* data, const size_t size)
+	{
+		try
 		{
-			m_messages.pop();
+			const osc::ReceivedPacket packet{ data, size };
+
+			if (packet.IsBundle())
+			{
+				processBundle(osc::ReceivedBundle{ packet });
+			}
+			else
+			{
+				pushMessage(data, size);
+			}
+		}
+		catch (osc::Exception&)
+		{
+
 		}
 	}
 
-	void OSCPacketListener::push(OSCReceivedMessage&& message)
+	void OSCPacketListener::ProcessPacket(const char* data, const int size, const IpEndpointName&)
 	{
-		std::lock_guard lock{ m_mutex };
-
-		m_messages.push(std::move(message));
+		processPacket(data, static_cast<size_t>(size));
 	}
 
-	void OSCPacketListener::ProcessMessage(const osc::ReceivedMessage& m, const IpEndpointName&)
+	void OSCPacketListener::processBundle(const osc::ReceivedBundle& bundle)
 	{
-		try
+		for (auto it = bundle.ElementsBegin(); it != bundle.ElementsEnd(); ++it)
 		{
-			OSCReceivedMessage message;
-			message.addressPattern = Unicode::FromAscii(m.AddressPattern());
-			message.arguments.resize(m.ArgumentCount());
-
-			osc::ReceivedMessage::const_iterator arg = m.ArgumentsBegin();
-
-			for (auto& argument : message.arguments)
+			if (it->IsBundle())
 			{
-				argument.tag = OSCTypeTag{ arg->TypeTag() };
-
-				switch (arg->TypeTag())
-				{
-				case osc::TypeTagValues::FALSE_TYPE_TAG:
-				case osc::TypeTagValues::TRUE_TYPE_TAG:
-					argument.value = arg->AsBoolUnchecked();
-					break;
-				case osc::TypeTagValues::CHAR_TYPE_TAG:
-					argument.value = arg->AsCharUnchecked();
-					break;
-				case osc::TypeTagValues::INT32_TYPE_TAG:
-					argument.value = static_cast<int32>(arg->AsInt32Unchecked());
-					break;
-				case osc::TypeTagValues::INT64_TYPE_TAG:
-					argument.value = static_cast<int64>(arg->AsInt64Unchecked());
-					break;
-				case osc::TypeTagValues::FLOAT_TYPE_TAG:
-					argument.value = arg->AsFloatUnchecked();
-					break;
-				case osc::TypeTagValues::DOUBLE_TYPE_TAG:
-					argument.value = arg->AsDoubleUnchecked();
-					break;
-				case osc::TypeTagValues::MIDI_MESSAGE_TYPE_TAG:
-					argument.value = static_cast<uint32>(arg->AsMidiMessageUnchecked());
-					break;
-				case osc::TypeTagValues::TIME_TAG_TYPE_TAG:
-					argument.value = static_cast<uint64>(arg->AsTimeTagUnchecked());
-					break;
-				case osc::TypeTagValues::RGBA_COLOR_TYPE_TAG:
-					argument.value = Color::FromRGBA(static_cast<uint32>(arg->AsRgbaColorUnchecked()));
-					break;
-				case osc::TypeTagValues::STRING_TYPE_TAG:
-					argument.value = Unicode::FromUTF8(arg->AsStringUnchecked());
-					break;
-				case osc::TypeTagValues::SYMBOL_TYPE_TAG:
-					argument.value = Unicode::FromUTF8(arg->AsSymbolUnchecked());
-					break;
-				case osc::TypeTagValues::BLOB_TYPE_TAG:
-					argument.value = arg->AsBlobUnchecked();
-					break;
-				case osc::TypeTagValues::NIL_TYPE_TAG:
-				case osc::TypeTagValues::INFINITUM_TYPE_TAG:
-				case osc::TypeTagValues::ARRAY_BEGIN_TYPE_TAG:
-				case osc::TypeTagValues::ARRAY_END_TYPE_TAG:
-				default:
-					break;
-				}
-
-				++arg;
+				processBundle(osc::ReceivedBundle{ *it });
 			}
+			else
+			{
+				pushMessage(it->Contents(), static_cast<size_t>(it->Size()));
+			}
+		}
+	}
+
+	void OSCPacketListener::pushMessage(const char* data, const size_t size)
+	{
+		try
+		{
+			// 不正なメッセージはここで取り除く
+			[[maybe_unused]] const osc::ReceivedMessage message{ osc::ReceivedPacket{ data, size } };
 
-			push(std::move(message));
+			m_messages.push(std::string(data, size));
 		}
 		catch (osc::Exception&)
 		{
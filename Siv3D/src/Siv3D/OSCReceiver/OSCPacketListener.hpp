@@ -10,36 +10,47 @@
 //-----------------------------------------------
 
 # pragma once
-# include <mutex>
-# include <queue>
-# include <Siv3D/OSCReceivedMessage.hpp>
-# include <ThirdParty/oscpack/osc/OscPacketListener.h>
+# include <string>
+# include <Siv3D/Common.hpp>
+# include <ThirdParty/oscpack/ip/PacketListener.h>
+# include <ThirdParty/oscpack/osc/OscReceivedElements.h>
+# include "SPSCQueue.hpp"
 
 namespace s3d
 {
-	class OSCPacketListener : public osc::OscPacketListener
+	/// @brief 受信したパケットをメッセージ単位に分割し、キューに格納するリスナー
+	/// @remark バンドルは展開され、各メッセージのバイト列がそのまま格納されます。メッセージの解釈は取得側のスレッドで行います。
+	class OSCPacketListener : public PacketListener
 	{
 	public:
 
 		[[nodiscard]]
-		bool hasMessages();
+		bool hasMessages() const noexcept;
 
 		[[nodiscard]]
-		size_t num_messages();
+		size_t num_messages() const noexcept;
 
+		/// @brief 最も古いメッセージのバイト列を取り出します。
+		/// @param message 取り出したバイト列の格納先
+		/// @return 取り出した場合 true, メッセージがない場合は false
 		[[nodiscard]]
-		OSCReceivedMessage pop();
+		bool tryPop(std::string& message);
 
 		void clear();
 
-	private:
+		/// @brief 受信したパケットを処理します。（受信スレッド専用）
+		/// @param data パケットの先頭ポインタ
+		/// @param size パケットのサイズ（バイト）
+		void processPacket(const char* data, size_t size);
+
+		void ProcessPacket(const char* data, int size, const IpEndpointName&) override;
 
-		std::mutex m_mutex;
+	private:
 
-		std::queue<OSCReceivedMessage> m_messages;
+		SPSCQueue<std::string> m_messages;
 
-		void push(OSCReceivedMessage&& message);
+		void processBundle(const osc::ReceivedBundle& bundle);
 
-		void ProcessMessage(const osc::ReceivedMessage& m, const IpEndpointName&) override;
+		void pushMessage(const char* data, size_t size);
 	};
 }
@@ -11,25 +11,162 @@
 
 # include <Siv3D/Error.hpp>
 # include <Siv3D/IPv4Endpoint.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
 # include "OSCReceiverDetail.hpp"
 
+# if SIV3D_PLATFORM(LINUX)
+#	include <array>
+#	include <cerrno>
+#	include <poll.h>
+#	include <unistd.h>
+#	include <netinet/in.h>
+#	include <sys/eventfd.h>
+#	include <sys/socket.h>
+# endif
+
 namespace s3d
 {
+	namespace
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		/// @brief 1 回の recvmmsg() で受信するパケットの最大数
+		constexpr size_t ReceiveBatchSize = 32;
+
+		/// @brief 受信するパケットの最大サイズ（バイト）
+		constexpr size_t MaxPacketSize = 8192;
+
+		/// @brief 受信バッファのサイズ（バイト）
+		constexpr int ReceiveBufferSize = (4 << 20);
+
+	# endif
+
+		[[nodiscard]]
+		static OSCArgument ToArgument(const OSCArgumentView& view)
+		{
+			OSCArgument argument{ .tag = view.tag };
+
+			std::visit([&](const auto& value)
+				{
+					using Type = std::decay_t<decltype(value)>;
+
+					if constexpr (std::is_same_v<Type, std::string_view>)
+					{
+						argument.value = Unicode::FromUTF8(value);
+					}
+					else if constexpr (std::is_same_v<Type, std::span<const Byte>>)
+					{
+						argument.value = Blob{ value };
+					}
+					else
+					{
+						argument.value = value;
+					}
+				}, view.value);
+
+			return argument;
+		}
+	}
+
 	OSCReceiver::OSCReceiverDetail::OSCReceiverDetail(const IPv4Endpoint& endpoint)
-		: m_listner{}
-		, m_socket{ std::make_unique<UdpListeningReceiveSocket>(IpEndpointName{ endpoint.address().toNetworkUint32(),endpoint.port() }, &m_listner)}
+		: m_endpoint{ endpoint }
 	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		m_socket = ::socket(AF_INET, (SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC), 0);
+
+		if (m_socket == -1)
+		{
+			throw Error{ "OSCReceiver: socket() failed" };
+		}
+
+		// 受信が集中したときに取りこぼさないよう、カーネルの受信バッファを広げておく
+		::setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &ReceiveBufferSize, sizeof(ReceiveBufferSize));
+
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(endpoint.address().toNetworkUint32());
+		address.sin_port = htons(endpoint.port());
+
+		if (::bind(m_socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1)
+		{
+			::close(m_socket);
+			m_socket = -1;
+			throw Error{ "OSCReceiver: bind() failed" };
+		}
+
+		// ポート番号 0 を指定した場合は、OS が割り当てたポート番号を記録する
+		socklen_t addressLength = sizeof(address);
+
+		if (::getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0)
+		{
+			m_endpoint = IPv4Endpoint{ endpoint.address(), ntohs(address.sin_port) };
+		}
+
+		m_breakFD = ::eventfd(0, EFD_CLOEXEC);
+
+		if (m_breakFD == -1)
+		{
+			::close(m_socket);
+			m_socket = -1;
+			throw Error{ "OSCReceiver: eventfd() failed" };
+		}
+
+	# else
+
+		m_socket = std::make_unique<UdpListeningReceiveSocket>(IpEndpointName{ endpoint.address().toNetworkUint32(),endpoint.port() }, &m_listner);
+
+		// ポート番号 0 を指定した場合は、OS が割り当てたポート番号を記録する（受信を始める前に一時的に接続して調べる）
+		if (endpoint.port() == 0)
+		{
+			const IPv4Address remote = (endpoint.address().isAny() ? IPv4Address::Localhost() : endpoint.address());
+			const IpEndpointName local = m_socket->LocalEndpointFor(IpEndpointName{ remote.toNetworkUint32(), 9 });
+			m_endpoint = IPv4Endpoint{ endpoint.address(), static_cast<IPv4Endpoint::port_type>(local.port) };
+		}
+
+	# endif
+
 		m_task = Async(Run, this);
 	}
 
 	OSCReceiver::OSCReceiverDetail::~OSCReceiverDetail()
 	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		if (m_task.isValid())
+		{
+			const uint64 one = 1;
+			[[maybe_unused]] const auto written = ::write(m_breakFD, &one, sizeof(one));
+
+			m_task.get();
+		}
+
+		if (m_breakFD != -1)
+		{
+			::close(m_breakFD);
+		}
+
+		if (m_socket != -1)
+		{
+			::close(m_socket);
+		}
+
+	# else
+
 		if (m_task.isValid())
 		{
 			m_socket->AsynchronousBreak();
 
 			m_task.get();
 		}
+
+	# endif
+	}
+
+	IPv4Endpoint OSCReceiver::OSCReceiverDetail::endpoint() const
+	{
+		return m_endpoint;
 	}
 
 	bool OSCReceiver::OSCReceiverDetail::hasMessages()
@@ -44,12 +181,46 @@ namespace s3d
 
 	OSCReceivedMessage OSCReceiver::OSCReceiverDetail::pop()
 	{
-		if (not m_listner.hasMessages())
+		OSCReceivedMessageView view;
+
+		do
+		{
+			if (not m_listner.tryPop(m_message))
+			{
+				throw Error{ "OSCReceiver::pop(): no message exists" };
+			}
+		} while (not parseMessage(view));
+
+		OSCReceivedMessage message;
+		message.addressPattern = Unicode::FromAscii(view.addressPattern);
+		message.arguments.reserve(view.arguments.size());
+
+		for (const auto& argument : view.arguments)
+		{
+			message.arguments.push_back(ToArgument(argument));
+		}
+
+		return message;
+	}
+
+	size_t OSCReceiver::OSCReceiverDetail::consume(FunctionRef<void(const OSCReceivedMessageView&)> callback)
+	{
+		size_t count = 0;
+
+		OSCReceivedMessageView view;
+
+		while (m_listner.tryPop(m_message))
 		{
-			throw Error{ "OSCReceiver::pop(): no message exists" };
+			if (not parseMessage(view))
+			{
+				continue;
+			}
+
+			callback(view);
+			++count;
 		}
 
-		return m_listner.pop();
+		return count;
 	}
 
 	void OSCReceiver::OSCReceiverDetail::clear()
@@ -57,8 +228,158 @@ namespace s3d
 		m_listner.clear();
 	}
 
+	bool OSCReceiver::OSCReceiverDetail::parseMessage(OSCReceivedMessageView& view)
+	{
+		try
+		{
+			const osc::ReceivedMessage m{ osc::ReceivedPacket{ m_message.data(), m_message.size() } };
+
+			m_arguments.resize(m.ArgumentCount());
+
+			osc::ReceivedMessage::const_iterator arg = m.ArgumentsBegin();
+
+			for (auto& argument : m_arguments)
+			{
+				argument.tag = OSCTypeTag{ arg->TypeTag() };
+
+				switch (arg->TypeTag())
+				{
+				case osc::TypeTagValues::FALSE_TYPE_TAG:
+				case osc::TypeTagValues::TRUE_TYPE_TAG:
+					argument.value = arg->AsBoolUnchecked();
+					break;
+				case osc::TypeTagValues::CHAR_TYPE_TAG:
+					argument.value = arg->AsCharUnchecked();
+					break;
+				case osc::TypeTagValues::INT32_TYPE_TAG:
+					argument.value = static_cast<int32>(arg->AsInt32Unchecked());
+					break;
+				case osc::TypeTagValues::INT64_TYPE_TAG:
+					argument.value = static_cast<int64>(arg->AsInt64Unchecked());
+					break;
+				case osc::TypeTagValues::FLOAT_TYPE_TAG:
+					argument.value = arg->AsFloatUnchecked();
+					break;
+				case osc::TypeTagValues::DOUBLE_TYPE_TAG:
+					argument.value = arg->AsDoubleUnchecked();
+					break;
+				case osc::TypeTagValues::MIDI_MESSAGE_TYPE_TAG:
+					argument.value = static_cast<uint32>(arg->AsMidiMessageUnchecked());
+					break;
+				case osc::TypeTagValues::TIME_TAG_TYPE_TAG:
+					argument.value = static_cast<uint64>(arg->AsTimeTagUnchecked());
+					break;
+				case osc::TypeTagValues::RGBA_COLOR_TYPE_TAG:
+					argument.value = Color::FromRGBA(static_cast<uint32>(arg->AsRgbaColorUnchecked()));
+					break;
+				case osc::TypeTagValues::STRING_TYPE_TAG:
+					argument.value = std::string_view{ arg->AsStringUnchecked() };
+					break;
+				case osc::TypeTagValues::SYMBOL_TYPE_TAG:
+					argument.value = std::string_view{ arg->AsSymbolUnchecked() };
+					break;
+				case osc::TypeTagValues::BLOB_TYPE_TAG:
+					{
+						const void* data = nullptr;
+						osc::osc_bundle_element_size_t size = 0;
+						arg->AsBlobUnchecked(data, size);
+						argument.value = std::span<const Byte>{ static_cast<const Byte*>(data), static_cast<size_t>(size) };
+						break;
+					}
+				case osc::TypeTagValues::NIL_TYPE_TAG:
+				case osc::TypeTagValues::INFINITUM_TYPE_TAG:
+				case osc::TypeTagValues::ARRAY_BEGIN_TYPE_TAG:
+				case osc::TypeTagValues::ARRAY_END_TYPE_TAG:
+				default:
+					argument.value = std::monostate{};
+					break;
+				}
+
+				++arg;
+			}
+
+			view.addressPattern = m.AddressPattern();
+			view.arguments = m_arguments;
+			return true;
+		}
+		catch (osc::Exception&)
+		{
+			return false;
+		}
+	}
+
+# if SIV3D_PLATFORM(LINUX)
+
+	void OSCReceiver::OSCReceiverDetail::Run(OSCReceiverDetail* osc)
+	{
+		const auto buffer = std::make_unique_for_overwrite<char[]>(ReceiveBatchSize * MaxPacketSize);
+
+		std::array<iovec, ReceiveBatchSize> iovecs;
+		std::array<mmsghdr, ReceiveBatchSize> messages{};
+
+		for (size_t i = 0; i < ReceiveBatchSize; ++i)
+		{
+			iovecs[i].iov_base = (buffer.get() + (i * MaxPacketSize));
+			iovecs[i].iov_len = MaxPacketSize;
+			messages[i].msg_hdr.msg_iov = &iovecs[i];
+			messages[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		pollfd fds[2] = { { osc->m_socket, POLLIN, 0 }, { osc->m_breakFD, POLLIN, 0 } };
+
+		for (;;)
+		{
+			if (::poll(fds, 2, -1) == -1)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				LOG_FAIL("❌ OSCReceiver: poll() failed");
+				return;
+			}
+
+			if (fds[1].revents & POLLIN)
+			{
+				return;
+			}
+
+			// 1 回のシステムコールで複数のパケットを受け取り、ソケットが空になるまで繰り返す
+			for (;;)
+			{
+				const int count = ::recvmmsg(osc->m_socket, messages.data(), static_cast<unsigned int>(ReceiveBatchSize), MSG_DONTWAIT, nullptr);
+
+				if (count <= 0)
+				{
+					break;
+				}
+
+				for (int i = 0; i < count; ++i)
+				{
+					// 切り詰められたパケットは解釈できないので捨てる
+					if (messages[i].msg_hdr.msg_flags & MSG_TRUNC)
+					{
+						continue;
+					}
+
+					osc->m_listner.processPacket(static_cast<const char*>(iovecs[i].iov_base), messages[i].msg_len);
+				}
+
+				if (count < static_cast<int>(ReceiveBatchSize))
+				{
+					break;
+				}
+			}
+		}
+	}
+
+# else
+
 	void OSCReceiver::OSCReceiverDetail::Run(OSCReceiverDetail* osc)
 	{
 		osc->m_socket->Run();
 	}
+
+# endif
 }
@@ -10,10 +10,16 @@
 //-----------------------------------------------
 
 # pragma once
+# include <string>
 # include <Siv3D/OSCReceiver.hpp>
-# include "OSCPacketListener.hpp"
+# include <Siv3D/Array.hpp>
+# include <Siv3D/IPv4Endpoint.hpp>
 # include <Siv3D/AsyncTask.hpp>
-# include <ThirdParty/oscpack/ip/UdpSocket.h>
+# include "OSCPacketListener.hpp"
+
+# if not SIV3D_PLATFORM(LINUX)
+#	include <ThirdParty/oscpack/ip/UdpSocket.h>
+# endif
 
 namespace s3d
 {
@@ -27,6 +33,9 @@ namespace s3d
 
 		~OSCReceiverDetail();
 
+		[[nodiscard]]
+		IPv4Endpoint endpoint() const;
+
 		[[nodiscard]]
 		bool hasMessages();
 
@@ -36,16 +45,41 @@ namespace s3d
 		[[nodiscard]]
 		OSCReceivedMessage pop();
 
+		size_t consume(FunctionRef<void(const OSCReceivedMessageView&)> callback);
+
 		void clear();
 
 	private:
 
+		OSCPacketListener m_listner;
+
+		/// @brief 受信している IPv4 エンドポイント（OS が割り当てたポート番号を含む）
+		IPv4Endpoint m_endpoint;
+
+		/// @brief キューから取り出したメッセージのバイト列（取得側のスレッドで再利用する）
+		std::string m_message;
+
+		/// @brief 解釈した引数（取得側のスレッドで再利用する）
+		Array<OSCArgumentView> m_arguments;
+
 		static void Run(OSCReceiverDetail* osc);
 
-		OSCPacketListener m_listner;
+	# if SIV3D_PLATFORM(LINUX)
+
+		int32 m_socket = -1;
+
+		/// @brief 受信スレッドを終了させるための eventfd
+		int32 m_breakFD = -1;
+
+	# else
 
 		std::unique_ptr<UdpListeningReceiveSocket> m_socket;
 
+	# endif
+
 		AsyncTask<void> m_task;
+
+		[[nodiscard]]
+		bool parseMessage(OSCReceivedMessageView& view);
 	};
 }
@@ -0,0 +1,181 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include <new>
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	SPSCQueue
+	//
+	////////////////////////////////////////////////////////////////
+
+	/// @brief 単一のプロデューサスレッドと単一のコンシューマスレッドの間で使う、ロックフリーの上限なしキュー
+	/// @tparam Type 要素の型
+	/// @tparam BlockCapacity 1 ブロックあたりの要素数
+	/// @remark 要素は固定長のブロックに格納され、使い終わったブロックは 1 つだけ再利用のために保持されます。
+	/// @remark `push()` はプロデューサスレッドから、`tryPop()`, `clear()` はコンシューマスレッドからのみ呼び出せます。
+	template <class Type, size_t BlockCapacity = 256>
+	class SPSCQueue
+	{
+	public:
+
+		[[nodiscard]]
+		SPSCQueue()
+			: m_readBlock{ new Block }
+			, m_writeBlock{ m_readBlock } {}
+
+		SPSCQueue(const SPSCQueue&) = delete;
+
+		SPSCQueue& operator =(const SPSCQueue&) = delete;
+
+		~SPSCQueue()
+		{
+			clear();
+
+			Block* block = m_readBlock;
+
+			while (block)
+			{
+				Block* next = block->next.load(std::memory_order_relaxed);
+				delete block;
+				block = next;
+			}
+
+			delete m_spareBlock.load(std::memory_order_relaxed);
+		}
+
+		/// @brief 要素を末尾に追加します。（プロデューサスレッド専用）
+		/// @param value 追加する要素
+		void push(Type&& value)
+		{
+			if (m_writeIndex == BlockCapacity)
+			{
+				Block* block = m_spareBlock.exchange(nullptr, std::memory_order_acquire);
+
+				if (block)
+				{
+					block->next.store(nullptr, std::memory_order_relaxed);
+				}
+				else
+				{
+					block = new Block;
+				}
+
+				m_writeBlock->next.store(block, std::memory_order_release);
+				m_writeBlock = block;
+				m_writeIndex = 0;
+			}
+
+			::new (m_writeBlock->slot(m_writeIndex)) Type(std::move(value));
+			++m_writeIndex;
+
+			m_numPushed.store((m_numPushed.load(std::memory_order_relaxed) + 1), std::memory_order_release);
+		}
+
+		/// @brief 先頭の要素を取り出します。（コンシューマスレッド専用）
+		/// @param value 取り出した要素の格納先
+		/// @return 要素を取り出した場合 true, キューが空の場合は false
+		[[nodiscard]]
+		bool tryPop(Type& value)
+		{
+			const size_t numPopped = m_numPopped.load(std::memory_order_relaxed);
+
+			if (numPopped == m_numPushed.load(std::memory_order_acquire))
+			{
+				return false;
+			}
+
+			if (m_readIndex == BlockCapacity)
+			{
+				Block* next = m_readBlock->next.load(std::memory_order_acquire);
+				recycle(m_readBlock);
+				m_readBlock = next;
+				m_readIndex = 0;
+			}
+
+			Type* p = std::launder(static_cast<Type*>(m_readBlock->slot(m_readIndex)));
+			value = std::move(*p);
+			p->~Type();
+			++m_readIndex;
+
+			m_numPopped.store((numPopped + 1), std::memory_order_release);
+			return true;
+		}
+
+		/// @brief キューが空であるかを返します。
+		/// @return キューが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept
+		{
+			return (size() == 0);
+		}
+
+		/// @brief キューに含まれる要素数を返します。
+		/// @return キューに含まれる要素数
+		/// @remark 他方のスレッドが操作中の場合、呼び出し直後に値が変わっている可能性があります。
+		[[nodiscard]]
+		size_t size() const noexcept
+		{
+			const size_t numPopped = m_numPopped.load(std::memory_order_acquire);
+			return (m_numPushed.load(std::memory_order_acquire) - numPopped);
+		}
+
+		/// @brief キューに含まれるすべての要素を破棄します。（コンシューマスレッド専用）
+		void clear()
+		{
+			Type value;
+
+			while (tryPop(value)) {}
+		}
+
+	private:
+
+		struct Block
+		{
+			alignas(Type) std::byte storage[sizeof(Type) * BlockCapacity];
+
+			std::atomic<Block*> next = nullptr;
+
+			[[nodiscard]]
+			void* slot(const size_t index) noexcept
+			{
+				return (storage + (sizeof(Type) * index));
+			}
+		};
+
+		void recycle(Block* block)
+		{
+			delete m_spareBlock.exchange(block, std::memory_order_acq_rel);
+		}
+
+		// コンシューマ側
+		alignas(64) Block* m_readBlock = nullptr;
+
+		size_t m_readIndex = 0;
+
+		std::atomic<size_t> m_numPopped = 0;
+
+		// プロデューサ側
+		alignas(64) Block* m_writeBlock = nullptr;
+
+		size_t m_writeIndex = 0;
+
+		std::atomic<size_t> m_numPushed = 0;
+
+		alignas(64) std::atomic<Block*> m_spareBlock = nullptr;
+	};
+}
@@ -23,6 +23,11 @@ namespace s3d
 
 	OSCReceiver::~OSCReceiver() {}
 
+	IPv4Endpoint OSCReceiver::endpoint() const
+	{
+		return pImpl->endpoint();
+	}
+
 	bool OSCReceiver::hasMessages()
 	{
 		return pImpl->hasMessages();
@@ -38,6 +43,11 @@ namespace s3d
 		return pImpl->pop();
 	}
 
+	size_t OSCReceiver::consume(const FunctionRef<void(const OSCReceivedMessageView&)> callback)
+	{
+		return pImpl->consume(callback);
+	}
+
 	void OSCReceiver::clear()
 	{
 		pImpl->clear();
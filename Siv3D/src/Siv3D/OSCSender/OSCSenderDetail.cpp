@@ -0,0 +1,137 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Error.hpp>
+# include <Siv3D/IPv4Endpoint.hpp>
+# include <Siv3D/Utility.hpp>
+# include "OSCSenderDetail.hpp"
+
+# if SIV3D_PLATFORM(LINUX)
+#	include <array>
+#	include <cerrno>
+#	include <unistd.h>
+#	include <netinet/in.h>
+#	include <sys/socket.h>
+# endif
+
+namespace s3d
+{
+	namespace
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		/// @brief 1 回の sendmmsg() で送信するパケットの最大数
+		constexpr size_t SendBatchSize = 64;
+
+	# endif
+	}
+
+	OSCSender::OSCSenderDetail::OSCSenderDetail(const IPv4Endpoint& endpoint)
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		m_socket = ::socket(AF_INET, (SOCK_DGRAM | SOCK_CLOEXEC), 0);
+
+		if (m_socket == -1)
+		{
+			throw Error{ "OSCSender: socket() failed" };
+		}
+
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(endpoint.address().toNetworkUint32());
+		address.sin_port = htons(endpoint.port());
+
+		if (::connect(m_socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1)
+		{
+			::close(m_socket);
+			m_socket = -1;
+			throw Error{ "OSCSender: connect() failed" };
+		}
+
+	# else
+
+		m_transmitSocket = std::make_unique<UdpTransmitSocket>(IpEndpointName{ endpoint.address().toNetworkUint32(),endpoint.port() });
+
+	# endif
+	}
+
+	OSCSender::OSCSenderDetail::~OSCSenderDetail()
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		if (m_socket != -1)
+		{
+			::close(m_socket);
+		}
+
+	# endif
+	}
+
+	void OSCSender::OSCSenderDetail::send(const std::string_view packet)
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		while ((::send(m_socket, packet.data(), packet.size(), 0) == -1) && (errno == EINTR)) {}
+
+	# else
+
+		m_transmitSocket->Send(packet.data(), packet.size());
+
+	# endif
+	}
+
+	void OSCSender::OSCSenderDetail::send(const std::span<const std::string_view> packets)
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		std::array<iovec, SendBatchSize> iovecs;
+		std::array<mmsghdr, SendBatchSize> messages;
+
+		size_t index = 0;
+
+		while (index < packets.size())
+		{
+			const size_t count = Min((packets.size() - index), SendBatchSize);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const std::string_view packet = packets[index + i];
+				iovecs[i].iov_base = const_cast<char*>(packet.data());
+				iovecs[i].iov_len = packet.size();
+				messages[i] = {};
+				messages[i].msg_hdr.msg_iov = &iovecs[i];
+				messages[i].msg_hdr.msg_iovlen = 1;
+			}
+
+			const int sent = ::sendmmsg(m_socket, messages.data(), static_cast<unsigned int>(count), 0);
+
+			if (0 < sent)
+			{
+				index += sent;
+			}
+			else if (errno != EINTR)
+			{
+				// 送信できなかったパケットは、send() と同様に捨てて次に進む
+				++index;
+			}
+		}
+
+	# else
+
+		for (const auto& packet : packets)
+		{
+			m_transmitSocket->Send(packet.data(), packet.size());
+		}
+
+	# endif
+	}
+}
@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include <string_view>
+# include <Siv3D/OSCSender.hpp>
+
+# if not SIV3D_PLATFORM(LINUX)
+#	include <ThirdParty/oscpack/ip/UdpSocket.h>
+# endif
+
+namespace s3d
+{
+	class OSCSender::OSCSenderDetail
+	{
+	public:
+
+		OSCSenderDetail(const IPv4Endpoint& endpoint);
+
+		~OSCSenderDetail();
+
+		void send(std::string_view packet);
+
+		void send(std::span<const std::string_view> packets);
+
+	private:
+
+	# if SIV3D_PLATFORM(LINUX)
+
+		int32 m_socket = -1;
+
+	# else
+
+		std::unique_ptr<UdpTransmitSocket> m_transmitSocket;
+
+	# endif
+	};
+}
@@ -11,13 +11,46 @@
 
 # include <Siv3D/OSCSender.hpp>
 # include <Siv3D/OSCMessage.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/IPv4Endpoint.hpp>
-# include <ThirdParty/oscpack/ip/IpEndpointName.h>
-# include <ThirdParty/oscpack/ip/UdpSocket.h>
+# include <Siv3D/OSCSender/OSCSenderDetail.hpp>
 # include <ThirdParty/oscpack/osc/OscOutboundPacketStream.h>
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief バンドル内の各要素の先頭に置かれるサイズのフィールドのサイズ
+		constexpr size_t BundleElementSizeSize = 4;
+
+		[[nodiscard]]
+		static std::string_view GetPacket(const OSCMessage& message)
+		{
+			const osc::OutboundPacketStream* pStream = message._detail();
+
+			if ((pStream->Size() == 0) || (not pStream->IsReady()))
+			{
+				return{};
+			}
+
+			return{ pStream->Data(), pStream->Size() };
+		}
+
+		static void AppendBigEndian(std::string& buffer, const uint64 value, const size_t size)
+		{
+			for (size_t i = 0; i < size; ++i)
+			{
+				buffer.push_back(static_cast<char>(value >> (8 * (size - 1 - i))));
+			}
+		}
+
+		static void BeginBundle(std::string& buffer, const uint64 timeTag)
+		{
+			buffer.append("#bundle", 8);
+			AppendBigEndian(buffer, timeTag, 8);
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	(constructor)
@@ -25,7 +58,7 @@ namespace s3d
 	////////////////////////////////////////////////////////////////
 
 	OSCSender::OSCSender(const IPv4Endpoint& endpoint)
-		: m_transmitSocket{ std::make_shared<UdpTransmitSocket>(IpEndpointName{ endpoint.address().toNetworkUint32(),endpoint.port() }) } {}
+		: pImpl{ std::make_shared<OSCSenderDetail>(endpoint) } {}
 
 	////////////////////////////////////////////////////////////////
 	//
@@ -35,12 +68,96 @@ namespace s3d
 
 	void OSCSender::send(const OSCMessage& message)
 	{
-		if (not m_transmitSocket)
+		if (not pImpl)
 		{
 			return;
 		}
 
 		const osc::OutboundPacketStream* pStream = message._detail();
-		m_transmitSocket->Send(pStream->Data(), pStream->Size());
+		pImpl->send(std::string_view{ pStream->Data(), pStream->Size() });
+	}
+
+	void OSCSender::send(const std::span<const OSCMessage> messages)
+	{
+		if (not pImpl)
+		{
+			return;
+		}
+
+		Array<std::string_view> packets(Arg::reserve = messages.size());
+
+		for (const auto& message : messages)
+		{
+			if (const std::string_view packet = GetPacket(message);
+				not packet.empty())
+			{
+				packets.push_back(packet);
+			}
+		}
+
+		pImpl->send(packets);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	sendBundle
+	//
+	////////////////////////////////////////////////////////////////
+
+	void OSCSender::sendBundle(const std::span<const OSCMessage> messages, const uint64 timeTag, const size_t maxPacketSize)
+	{
+		if (not pImpl)
+		{
+			return;
+		}
+
+		// すべてのバンドルを 1 つのバッファに書き込み、各バンドルの範囲を記録する
+		std::string buffer;
+		Array<std::pair<size_t, size_t>> ranges;
+
+		size_t bundleBegin = 0;
+		size_t numElements = 0;
+
+		for (const auto& message : messages)
+		{
+			const std::string_view packet = GetPacket(message);
+
+			if (packet.empty())
+			{
+				continue;
+			}
+
+			const size_t elementSize = (BundleElementSizeSize + packet.size());
+
+			if (numElements && (maxPacketSize < ((buffer.size() - bundleBegin) + elementSize)))
+			{
+				ranges.emplace_back(bundleBegin, (buffer.size() - bundleBegin));
+				numElements = 0;
+			}
+
+			if (numElements == 0)
+			{
+				bundleBegin = buffer.size();
+				BeginBundle(buffer, timeTag);
+			}
+
+			AppendBigEndian(buffer, packet.size(), BundleElementSizeSize);
+			buffer.append(packet);
+			++numElements;
+		}
+
+		if (numElements)
+		{
+			ranges.emplace_back(bundleBegin, (buffer.size() - bundleBegin));
+		}
+
+		Array<std::string_view> packets(Arg::reserve = ranges.size());
+
+		for (const auto& [offset, size] : ranges)
+		{
+			packets.emplace_back((buffer.data() + offset), size);
+		}
+
+		pImpl->send(packets);
 	}
 }
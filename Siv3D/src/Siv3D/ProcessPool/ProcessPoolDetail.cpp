@@ -0,0 +1,535 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <cmath>
+# include <climits>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ProcessPoolDetail.hpp"
+
+# if SIV3D_PLATFORM(LINUX)
+#	include <unistd.h>
+#	include <sys/epoll.h>
+# elif SIV3D_PLATFORM(WINDOWS)
+#	include <thread>
+# else
+#	include <poll.h>
+# endif
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief イベントが書き込み可能を示すことを表すフラグ（下位 32 ビットはワーカーのインデックス）
+		constexpr uint64 WriteEventFlag = (1ull << 32);
+
+		/// @brief ジョブを完了しないまま連続して終了したワーカーを、再起動せずに停止するまでの回数
+		constexpr size_t MaxConsecutiveRestarts = 3;
+
+		[[nodiscard]]
+		static int ToMilliseconds(const Duration& timeout) noexcept
+		{
+			const double milliseconds = std::ceil(timeout.count() * 1000.0);
+			return static_cast<int>(Clamp(milliseconds, 0.0, static_cast<double>(INT_MAX)));
+		}
+	}
+
+	ProcessPool::ProcessPoolDetail::ProcessPoolDetail(const FilePathView path, const Array<String>& commands, const size_t numWorkers)
+		: m_path{ path }
+		, m_commands{ commands }
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		m_epollFD = ::epoll_create1(EPOLL_CLOEXEC);
+
+		if (m_epollFD == -1)
+		{
+			LOG_FAIL("❌ ProcessPool: epoll_create1() failed");
+			return;
+		}
+
+	# endif
+
+		m_workers.resize(Max<size_t>(numWorkers, 1));
+
+		size_t numStarted = 0;
+
+		for (size_t i = 0; i < m_workers.size(); ++i)
+		{
+			if (spawnWorker(m_workers[i], i))
+			{
+				++numStarted;
+			}
+		}
+
+		if (numStarted == 0)
+		{
+			LOG_FAIL(fmt::format("❌ ProcessPool: Failed to start `{}`", path.toUTF8()));
+			m_workers.clear();
+			return;
+		}
+
+		LOG_INFO(fmt::format("ℹ️ ProcessPool: Started {} workers of `{}`", numStarted, path.toUTF8()));
+	}
+
+	ProcessPool::ProcessPoolDetail::~ProcessPoolDetail()
+	{
+		terminate();
+
+	# if SIV3D_PLATFORM(LINUX)
+
+		if (m_epollFD != -1)
+		{
+			::close(m_epollFD);
+		}
+
+	# endif
+	}
+
+	bool ProcessPool::ProcessPoolDetail::isValid() const
+	{
+		return hasLiveWorkers();
+	}
+
+	size_t ProcessPool::ProcessPoolDetail::num_workers() const
+	{
+		return static_cast<size_t>(std::ranges::count_if(m_workers, [](const Worker& worker) { return worker.process.isValid(); }));
+	}
+
+	size_t ProcessPool::ProcessPoolDetail::num_pendingJobs() const
+	{
+		return (m_jobs.size() + m_numRunningJobs);
+	}
+
+	uint64 ProcessPool::ProcessPoolDetail::submit(const StringView input)
+	{
+		if (not hasLiveWorkers())
+		{
+			return 0;
+		}
+
+		if (input.contains(U'\n'))
+		{
+			LOG_FAIL("❌ ProcessPool::submit(): input must not contain a newline");
+			return 0;
+		}
+
+		const uint64 jobID = m_nextJobID++;
+
+		std::string line = input.toUTF8();
+		line.push_back('\n');
+
+		m_jobs.push_back(Job{ .id = jobID, .input = std::move(line) });
+
+		dispatch();
+
+		return jobID;
+	}
+
+	void ProcessPool::ProcessPoolDetail::update(const Duration& timeout)
+	{
+		dispatch();
+
+		waitForEvents(timeout);
+
+		dispatch();
+	}
+
+	Array<ProcessPool::JobResult> ProcessPool::ProcessPoolDetail::retrieveResults()
+	{
+		return std::exchange(m_results, Array<JobResult>{});
+	}
+
+	void ProcessPool::ProcessPoolDetail::waitAll()
+	{
+		while (num_pendingJobs())
+		{
+			if (not hasLiveWorkers())
+			{
+				failQueuedJobs();
+				break;
+			}
+
+			update(SecondsF{ 0.1 });
+		}
+	}
+
+	void ProcessPool::ProcessPoolDetail::terminate()
+	{
+		for (size_t i = 0; i < m_workers.size(); ++i)
+		{
+			stopWorker(i);
+		}
+
+		m_workers.clear();
+		m_jobs.clear();
+		m_numRunningJobs = 0;
+	}
+
+	bool ProcessPool::ProcessPoolDetail::spawnWorker(Worker& worker, const size_t index)
+	{
+		worker.jobID.reset();
+		worker.writeBuffer.clear();
+		worker.writeOffset = 0;
+		worker.readBuffer.clear();
+		worker.waitingForWrite = false;
+
+	# if SIV3D_PLATFORM(WINDOWS)
+
+		worker.process = ChildProcess{ m_path, m_commands, Pipe::StdInOut };
+
+		if (not worker.process)
+		{
+			return false;
+		}
+
+	# else
+
+		if (not worker.process.spawn(m_path, m_commands, Pipe::StdInOut))
+		{
+			return false;
+		}
+
+	# endif
+
+	# if SIV3D_PLATFORM(LINUX)
+
+		epoll_event event{ .events = EPOLLIN, .data = { .u64 = index } };
+		::epoll_ctl(m_epollFD, EPOLL_CTL_ADD, worker.process.readFD(), &event);
+
+	# else
+
+		(void)index;
+
+	# endif
+
+		return true;
+	}
+
+	void ProcessPool::ProcessPoolDetail::restartWorker(const size_t index)
+	{
+		Worker& worker = m_workers[index];
+
+		if (worker.jobID)
+		{
+			m_results.push_back(JobResult{ .jobID = *worker.jobID, .output = Unicode::FromUTF8(worker.readBuffer), .succeeded = false });
+			--m_numRunningJobs;
+		}
+
+		stopWorker(index);
+
+		// 起動直後に終了し続けるワーカーを再起動し続けないよう、回数を制限する
+		if (MaxConsecutiveRestarts <= worker.numConsecutiveRestarts)
+		{
+			LOG_FAIL(fmt::format("❌ ProcessPool: `{}` exited {} times in a row without completing a job. The worker is stopped", m_path.toUTF8(), (worker.numConsecutiveRestarts + 1)));
+		}
+		else
+		{
+			++worker.numConsecutiveRestarts;
+
+			if (not spawnWorker(worker, index))
+			{
+				LOG_FAIL(fmt::format("❌ ProcessPool: Failed to restart `{}`", m_path.toUTF8()));
+			}
+		}
+
+		// 起動しているワーカーがなくなった場合、待機中のジョブを失敗として報告する
+		if (not hasLiveWorkers())
+		{
+			failQueuedJobs();
+		}
+	}
+
+	void ProcessPool::ProcessPoolDetail::stopWorker(const size_t index)
+	{
+		Worker& worker = m_workers[index];
+
+		if (not worker.process.isValid())
+		{
+			return;
+		}
+
+		setWaitingForWrite(index, false);
+
+	# if SIV3D_PLATFORM(LINUX)
+
+		::epoll_ctl(m_epollFD, EPOLL_CTL_DEL, worker.process.readFD(), nullptr);
+
+	# endif
+
+		worker.process.closeStdIn();
+
+		if (worker.process.isRunning())
+		{
+			worker.process.terminate();
+		}
+
+		worker.process = WorkerProcess{};
+		worker.jobID.reset();
+	}
+
+	void ProcessPool::ProcessPoolDetail::dispatch()
+	{
+		if (m_jobs.empty())
+		{
+			return;
+		}
+
+		if (not hasLiveWorkers())
+		{
+			failQueuedJobs();
+			return;
+		}
+
+		for (size_t i = 0; (i < m_workers.size()) && (not m_jobs.empty()); ++i)
+		{
+			Worker& worker = m_workers[i];
+
+			if (worker.jobID || (not worker.process.isValid()))
+			{
+				continue;
+			}
+
+			Job job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+
+			worker.jobID = job.id;
+			worker.writeBuffer = std::move(job.input);
+			worker.writeOffset = 0;
+			++m_numRunningJobs;
+
+			writeTo(i);
+		}
+	}
+
+	void ProcessPool::ProcessPoolDetail::readFrom(const size_t index)
+	{
+		Worker& worker = m_workers[index];
+
+		if (not worker.process.isValid())
+		{
+			return;
+		}
+
+		char buffer[16384];
+		bool closed = false;
+
+		for (;;)
+		{
+			const Optional<size_t> result = worker.process.tryRead(buffer, sizeof(buffer));
+
+			if (not result)
+			{
+				closed = true;
+				break;
+			}
+
+			if (*result == 0)
+			{
+				break;
+			}
+
+			worker.readBuffer.append(buffer, *result);
+		}
+
+		// 終了前に書き出された結果も受け取る
+		size_t lineBegin = 0;
+
+		for (size_t lineEnd; (lineEnd = worker.readBuffer.find('\n', lineBegin)) != std::string::npos; lineBegin = (lineEnd + 1))
+		{
+			std::string_view line{ (worker.readBuffer.data() + lineBegin), (lineEnd - lineBegin) };
+
+			if (line.ends_with('\r'))
+			{
+				line.remove_suffix(1);
+			}
+
+			if (worker.jobID)
+			{
+				m_results.push_back(JobResult{ .jobID = *worker.jobID, .output = Unicode::FromUTF8(line), .succeeded = true });
+				worker.jobID.reset();
+				--m_numRunningJobs;
+				worker.numConsecutiveRestarts = 0;
+			}
+		}
+
+		worker.readBuffer.erase(0, lineBegin);
+
+		if (closed)
+		{
+			restartWorker(index);
+		}
+	}
+
+	void ProcessPool::ProcessPoolDetail::writeTo(const size_t index)
+	{
+		Worker& worker = m_workers[index];
+
+		while (worker.writeOffset < worker.writeBuffer.size())
+		{
+			const Optional<size_t> result = worker.process.tryWrite((worker.writeBuffer.data() + worker.writeOffset), (worker.writeBuffer.size() - worker.writeOffset));
+
+			if (not result)
+			{
+				restartWorker(index);
+				return;
+			}
+
+			if (*result == 0)
+			{
+				setWaitingForWrite(index, true);
+				return;
+			}
+
+			worker.writeOffset += *result;
+		}
+
+		setWaitingForWrite(index, false);
+		worker.writeBuffer.clear();
+		worker.writeOffset = 0;
+	}
+
+	void ProcessPool::ProcessPoolDetail::setWaitingForWrite(const size_t index, const bool waiting)
+	{
+		Worker& worker = m_workers[index];
+
+		if (worker.waitingForWrite == waiting)
+		{
+			return;
+		}
+
+	# if SIV3D_PLATFORM(LINUX)
+
+		epoll_event event{ .events = EPOLLOUT, .data = { .u64 = (index | WriteEventFlag) } };
+		::epoll_ctl(m_epollFD, (waiting ? EPOLL_CTL_ADD : EPOLL_CTL_DEL), worker.process.writeFD(), &event);
+
+	# endif
+
+		worker.waitingForWrite = waiting;
+	}
+
+	void ProcessPool::ProcessPoolDetail::waitForEvents(const Duration& timeout)
+	{
+	# if SIV3D_PLATFORM(LINUX)
+
+		epoll_event events[64];
+		const int numEvents = ::epoll_wait(m_epollFD, events, static_cast<int>(std::size(events)), ToMilliseconds(timeout));
+
+		for (int i = 0; i < numEvents; ++i)
+		{
+			const uint64 tag = events[i].data.u64;
+			const size_t index = static_cast<size_t>(tag & 0xFFFF'FFFF);
+
+			if (tag & WriteEventFlag)
+			{
+				writeTo(index);
+			}
+			else
+			{
+				readFrom(index);
+			}
+		}
+
+	# elif SIV3D_PLATFORM(WINDOWS)
+
+		// 匿名パイプは待機できないため、短い間隔で確認する
+		const auto deadline = (std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout));
+
+		for (;;)
+		{
+			const size_t numResults = m_results.size();
+
+			for (size_t i = 0; i < m_workers.size(); ++i)
+			{
+				if (m_workers[i].waitingForWrite)
+				{
+					writeTo(i);
+				}
+
+				readFrom(i);
+			}
+
+			if ((numResults != m_results.size())
+				|| (deadline <= std::chrono::steady_clock::now()))
+			{
+				break;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+		}
+
+	# else
+
+		Array<pollfd> fds;
+		Array<uint64> tags;
+
+		for (size_t i = 0; i < m_workers.size(); ++i)
+		{
+			const Worker& worker = m_workers[i];
+
+			if (not worker.process.isValid())
+			{
+				continue;
+			}
+
+			fds.push_back(pollfd{ .fd = worker.process.readFD(), .events = POLLIN, .revents = 0 });
+			tags.push_back(i);
+
+			if (worker.waitingForWrite)
+			{
+				fds.push_back(pollfd{ .fd = worker.process.writeFD(), .events = POLLOUT, .revents = 0 });
+				tags.push_back(i | WriteEventFlag);
+			}
+		}
+
+		if (::poll(fds.data(), static_cast<nfds_t>(fds.size()), ToMilliseconds(timeout)) <= 0)
+		{
+			return;
+		}
+
+		for (size_t i = 0; i < fds.size(); ++i)
+		{
+			if (fds[i].revents == 0)
+			{
+				continue;
+			}
+
+			const size_t index = static_cast<size_t>(tags[i] & 0xFFFF'FFFF);
+
+			if (tags[i] & WriteEventFlag)
+			{
+				writeTo(index);
+			}
+			else
+			{
+				readFrom(index);
+			}
+		}
+
+	# endif
+	}
+
+	void ProcessPool::ProcessPoolDetail::failQueuedJobs()
+	{
+		for (const auto& job : m_jobs)
+		{
+			m_results.push_back(JobResult{ .jobID = job.id, .output = {}, .succeeded = false });
+		}
+
+		m_jobs.clear();
+	}
+
+	bool ProcessPool::ProcessPoolDetail::hasLiveWorkers() const
+	{
+		return std::ranges::any_of(m_workers, [](const Worker& worker) { return worker.process.isValid(); });
+	}
+}
@@ -0,0 +1,135 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# pragma once
+# include <deque>
+# include <string>
+# include <Siv3D/ProcessPool.hpp>
+# include <Siv3D/Optional.hpp>
+
+# if SIV3D_PLATFORM(WINDOWS)
+#	include <Siv3D/ChildProcess.hpp>
+# else
+#	include <Siv3D/ChildProcess/PosixProcess.hpp>
+# endif
+
+namespace s3d
+{
+	class ProcessPool::ProcessPoolDetail
+	{
+	public:
+
+		ProcessPoolDetail() = default;
+
+		ProcessPoolDetail(FilePathView path, const Array<String>& commands, size_t numWorkers);
+
+		~ProcessPoolDetail();
+
+		[[nodiscard]]
+		bool isValid() const;
+
+		[[nodiscard]]
+		size_t num_workers() const;
+
+		[[nodiscard]]
+		size_t num_pendingJobs() const;
+
+		uint64 submit(StringView input);
+
+		void update(const Duration& timeout);
+
+		[[nodiscard]]
+		Array<JobResult> retrieveResults();
+
+		void waitAll();
+
+		void terminate();
+
+	private:
+
+	# if SIV3D_PLATFORM(WINDOWS)
+		using WorkerProcess = ChildProcess;
+	# else
+		using WorkerProcess = PosixProcess;
+	# endif
+
+		struct Job
+		{
+			uint64 id = 0;
+
+			/// @brief 改行を含む UTF-8 の入力
+			std::string input;
+		};
+
+		struct Worker
+		{
+			WorkerProcess process;
+
+			/// @brief 実行中のジョブ
+			Optional<uint64> jobID;
+
+			/// @brief 書き込み中のジョブの入力
+			std::string writeBuffer;
+
+			/// @brief `writeBuffer` のうち書き込み済みのサイズ
+			size_t writeOffset = 0;
+
+			/// @brief 改行が届いていない出力
+			std::string readBuffer;
+
+			/// @brief 書き込み可能になるのを待っているか
+			bool waitingForWrite = false;
+
+			/// @brief ジョブを完了しないまま連続して再起動した回数
+			size_t numConsecutiveRestarts = 0;
+		};
+
+		FilePath m_path;
+
+		Array<String> m_commands;
+
+		Array<Worker> m_workers;
+
+		std::deque<Job> m_jobs;
+
+		Array<JobResult> m_results;
+
+		uint64 m_nextJobID = 1;
+
+		size_t m_numRunningJobs = 0;
+
+	# if SIV3D_PLATFORM(LINUX)
+		int32 m_epollFD = -1;
+	# endif
+
+		bool spawnWorker(Worker& worker, size_t index);
+
+		void restartWorker(size_t index);
+
+		void dispatch();
+
+		void readFrom(size_t index);
+
+		void writeTo(size_t index);
+
+		void setWaitingForWrite(size_t index, bool waiting);
+
+		void stopWorker(size_t index);
+
+		void waitForEvents(const Duration& timeout);
+
+		void failQueuedJobs();
+
+		[[nodiscard]]
+		bool hasLiveWorkers() const;
+	};
+}
@@ -0,0 +1,146 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+
+# include <Siv3D/ProcessPool.hpp>
+# include "ProcessPoolDetail.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProcessPool::ProcessPool()
+		: pImpl{ std::make_unique<ProcessPoolDetail>() } {}
+
+	ProcessPool::ProcessPool(const FilePathView path, const Array<String>& commands, const size_t numWorkers)
+		: pImpl{ std::make_unique<ProcessPoolDetail>(path, commands, numWorkers) } {}
+
+	ProcessPool::ProcessPool(ProcessPool&& other) noexcept = default;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(destructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProcessPool::~ProcessPool() {}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator =
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProcessPool& ProcessPool::operator =(ProcessPool&& other) noexcept = default;
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	operator bool
+	//
+	////////////////////////////////////////////////////////////////
+
+	ProcessPool::operator bool() const
+	{
+		return isValid();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isValid
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ProcessPool::isValid() const
+	{
+		return pImpl->isValid();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_workers
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t ProcessPool::num_workers() const
+	{
+		return pImpl->num_workers();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_pendingJobs
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t ProcessPool::num_pendingJobs() const
+	{
+		return pImpl->num_pendingJobs();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	submit
+	//
+	////////////////////////////////////////////////////////////////
+
+	uint64 ProcessPool::submit(const StringView input)
+	{
+		return pImpl->submit(input);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	update
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ProcessPool::update(const Duration& timeout)
+	{
+		pImpl->update(timeout);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	retrieveResults
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<ProcessPool::JobResult> ProcessPool::retrieveResults()
+	{
+		return pImpl->retrieveResults();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	waitAll
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ProcessPool::waitAll()
+	{
+		pImpl->waitAll();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	terminate
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ProcessPool::terminate()
+	{
+		pImpl->terminate();
+	}
+}
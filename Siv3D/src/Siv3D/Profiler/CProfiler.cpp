@@ -157,4 +157,26 @@ namespace s3d
 	{
 		m_stats[FromEnum(stat)] += delta;
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setEngineInitMetrics
+	//
+	////////////////////////////////////////////////////////////////
+
+	void CProfiler::setEngineInitMetrics(EngineInitMetrics&& metrics)
+	{
+		m_engineInitMetrics = std::move(metrics);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getEngineInitMetrics
+	//
+	////////////////////////////////////////////////////////////////
+
+	const EngineInitMetrics& CProfiler::getEngineInitMetrics() const
+	{
+		return m_engineInitMetrics;
+	}
 }
@@ -12,6 +12,7 @@
 # pragma once
 # include <array>
 # include <Siv3D/FrameMetrics.hpp>
+# include <Siv3D/EngineInitMetrics.hpp>
 # include "IProfiler.hpp"
 
 namespace s3d
@@ -38,6 +39,10 @@ namespace s3d
 
 		void reportStat(ProfilerStat stat, int64 delta) override;
 
+		void setEngineInitMetrics(EngineInitMetrics&& metrics) override;
+
+		const EngineInitMetrics& getEngineInitMetrics() const override;
+
 	private:
 
 		struct FPSCounter
@@ -55,5 +60,7 @@ namespace s3d
 		std::array<uint64, 8> m_timestamps{};
 
 		std::array<int64, 2> m_stats{};
+
+		EngineInitMetrics m_engineInitMetrics;
 	};
 }
@@ -18,6 +18,7 @@
 namespace s3d
 {
 	struct FrameMetrics;
+	struct EngineInitMetrics;
 
 	class SIV3D_NOVTABLE ISiv3DProfiler
 	{
@@ -43,5 +44,9 @@ namespace s3d
 		virtual void reportEvent(ProfilerEvent event) = 0;
 
 		virtual void reportStat(ProfilerStat stat, int64 delta) = 0;
+
+		virtual void setEngineInitMetrics(EngineInitMetrics&& metrics) = 0;
+
+		virtual const EngineInitMetrics& getEngineInitMetrics() const = 0;
 	};
 }
@@ -32,5 +32,10 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Profiler)->getFrameMetrics();
 		}
+
+		const EngineInitMetrics& GetEngineInitMetrics()
+		{
+			return SIV3D_ENGINE(Profiler)->getEngineInitMetrics();
+		}
 	}
 }
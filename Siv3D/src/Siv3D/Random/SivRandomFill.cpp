@@ -0,0 +1,458 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <bit>
+# include <cmath>
+# include <Siv3D/RandomFill.hpp>
+# include <Siv3D/Random.hpp>
+# include <Siv3D/PRNG.hpp>
+# include <Siv3D/Int128.hpp>
+# include <Siv3D/MathConstants.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/CPUInfo.hpp>
+# include <Siv3D/SIMD.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+		/// @brief 同時に進める Xoshiro256++ の本数
+		constexpr size_t Lanes = 8;
+
+		/// @brief 1 つの独立したストリームが生成する要素数。結果を並列化の有無に依存させないための単位
+		constexpr size_t BlockSize = (1 << 16);
+
+		/// @brief 一度に生成する乱数の個数
+		constexpr size_t ChunkSize = 512;
+
+		static_assert((ChunkSize % (Lanes * 2)) == 0);
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	Xoshiro256PlusPlusX8
+		//
+		////////////////////////////////////////////////////////////////
+
+		struct alignas(32) Xoshiro256PlusPlusX8
+		{
+			uint64 s0[Lanes];
+
+			uint64 s1[Lanes];
+
+			uint64 s2[Lanes];
+
+			uint64 s3[Lanes];
+
+			Xoshiro256PlusPlusX8(const uint64 seed, const uint64 stream) noexcept
+			{
+				PRNG::SplitMix64 splitMix{ (seed + (stream * 0xD1B54A32D192ED03ull)) };
+
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					s0[lane] = splitMix();
+					s1[lane] = splitMix();
+					s2[lane] = splitMix();
+					s3[lane] = splitMix();
+				}
+			}
+		};
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GenerateBits_*
+		//
+		////////////////////////////////////////////////////////////////
+
+		// 出力の i 番目は、レーン (i % Lanes) の (i / Lanes) 番目の値。どの実装でも同じ列を生成する
+
+		[[maybe_unused]]
+		static void GenerateBits_plain(Xoshiro256PlusPlusX8& state, uint64* dst, const size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; i += Lanes)
+			{
+				for (size_t lane = 0; lane < Lanes; ++lane)
+				{
+					const uint64 result = (std::rotl((state.s0[lane] + state.s3[lane]), 23) + state.s0[lane]);
+					const uint64 t = (state.s1[lane] << 17);
+
+					state.s2[lane] ^= state.s0[lane];
+					state.s3[lane] ^= state.s1[lane];
+					state.s1[lane] ^= state.s2[lane];
+					state.s0[lane] ^= state.s3[lane];
+					state.s2[lane] ^= t;
+					state.s3[lane] = std::rotl(state.s3[lane], 45);
+
+					dst[i + lane] = result;
+				}
+			}
+		}
+
+	# if SIV3D_INTRINSIC(SSE)
+
+		template <int K>
+		[[nodiscard]]
+		static __m128i Rotl_SSE(const __m128i x) noexcept
+		{
+			return _mm_or_si128(_mm_slli_epi64(x, K), _mm_srli_epi64(x, (64 - K)));
+		}
+
+		static void GenerateBits_SSE2(Xoshiro256PlusPlusX8& state, uint64* dst, const size_t count) noexcept
+		{
+			constexpr size_t N = (Lanes / 2);
+
+			__m128i s0[N], s1[N], s2[N], s3[N];
+
+			for (size_t k = 0; k < N; ++k)
+			{
+				s0[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s0) + k);
+				s1[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s1) + k);
+				s2[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s2) + k);
+				s3[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(state.s3) + k);
+			}
+
+			for (size_t i = 0; i < count; i += Lanes)
+			{
+				for (size_t k = 0; k < N; ++k)
+				{
+					const __m128i result = _mm_add_epi64(Rotl_SSE<23>(_mm_add_epi64(s0[k], s3[k])), s0[k]);
+					const __m128i t = _mm_slli_epi64(s1[k], 17);
+
+					s2[k] = _mm_xor_si128(s2[k], s0[k]);
+					s3[k] = _mm_xor_si128(s3[k], s1[k]);
+					s1[k] = _mm_xor_si128(s1[k], s2[k]);
+					s0[k] = _mm_xor_si128(s0[k], s3[k]);
+					s2[k] = _mm_xor_si128(s2[k], t);
+					s3[k] = Rotl_SSE<45>(s3[k]);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i) + k, result);
+				}
+			}
+
+			for (size_t k = 0; k < N; ++k)
+			{
+				_mm_store_si128(reinterpret_cast<__m128i*>(state.s0) + k, s0[k]);
+				_mm_store_si128(reinterpret_cast<__m128i*>(state.s1) + k, s1[k]);
+				_mm_store_si128(reinterpret_cast<__m128i*>(state.s2) + k, s2[k]);
+				_mm_store_si128(reinterpret_cast<__m128i*>(state.s3) + k, s3[k]);
+			}
+		}
+
+		template <int K>
+		[[nodiscard]]
+		static __m256i Rotl_AVX2(const __m256i x) noexcept
+		{
+			return _mm256_or_si256(_mm256_slli_epi64(x, K), _mm256_srli_epi64(x, (64 - K)));
+		}
+
+		static void GenerateBits_AVX2(Xoshiro256PlusPlusX8& state, uint64* dst, const size_t count) noexcept
+		{
+			constexpr size_t N = (Lanes / 4);
+
+			__m256i s0[N], s1[N], s2[N], s3[N];
+
+			for (size_t k = 0; k < N; ++k)
+			{
+				s0[k] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s0) + k);
+				s1[k] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s1) + k);
+				s2[k] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s2) + k);
+				s3[k] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state.s3) + k);
+			}
+
+			for (size_t i = 0; i < count; i += Lanes)
+			{
+				for (size_t k = 0; k < N; ++k)
+				{
+					const __m256i result = _mm256_add_epi64(Rotl_AVX2<23>(_mm256_add_epi64(s0[k], s3[k])), s0[k]);
+					const __m256i t = _mm256_slli_epi64(s1[k], 17);
+
+					s2[k] = _mm256_xor_si256(s2[k], s0[k]);
+					s3[k] = _mm256_xor_si256(s3[k], s1[k]);
+					s1[k] = _mm256_xor_si256(s1[k], s2[k]);
+					s0[k] = _mm256_xor_si256(s0[k], s3[k]);
+					s2[k] = _mm256_xor_si256(s2[k], t);
+					s3[k] = Rotl_AVX2<45>(s3[k]);
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i) + k, result);
+				}
+			}
+
+			for (size_t k = 0; k < N; ++k)
+			{
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state.s0) + k, s0[k]);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state.s1) + k, s1[k]);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state.s2) + k, s2[k]);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state.s3) + k, s3[k]);
+			}
+		}
+
+	# endif
+
+		using GenerateBitsFunc = void(*)(Xoshiro256PlusPlusX8&, uint64*, size_t) noexcept;
+
+		[[nodiscard]]
+		static GenerateBitsFunc GetGenerateBitsFunc() noexcept
+		{
+		# if SIV3D_CPU(X86_64)
+
+			static const GenerateBitsFunc func = (SupportsAVX2() ? GenerateBits_AVX2 : GenerateBits_SSE2);
+			return func;
+
+		# else
+
+			return GenerateBits_plain;
+
+		# endif
+		}
+
+		/// @brief 64-bit の乱数を [0, 1) の範囲の double 型に変換します。
+		[[nodiscard]]
+		static double ToUnit(const uint64 bits) noexcept
+		{
+			return (std::bit_cast<double>((bits >> 12) | 0x3FF0000000000000ull) - 1.0);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	GenerateBlocks
+		//
+		////////////////////////////////////////////////////////////////
+
+		/// @brief numElements 個の要素を生成するための乱数を、ブロックごとに独立したストリームから生成します。
+		/// @param numElements 要素数
+		/// @param bitsPerElement 1 要素あたりに必要な乱数の個数（1 または 2）
+		/// @param seed シード値
+		/// @param parallelize 複数のスレッドで並列に生成するか
+		/// @param f 生成した乱数を受け取る関数 `f(const uint64* bits, size_t begin, size_t end)`
+		template <class Fty>
+		static void GenerateBlocks(const size_t numElements, const size_t bitsPerElement, const uint64 seed, const Parallelize parallelize, Fty f)
+		{
+			if (numElements == 0)
+			{
+				return;
+			}
+
+			const GenerateBitsFunc generateBits = GetGenerateBitsFunc();
+			const size_t numBlocks = ((numElements + (BlockSize - 1)) / BlockSize);
+			const size_t elementsPerChunk = (ChunkSize / bitsPerElement);
+
+			const auto processBlocks = [&](const size_t blockBegin, const size_t blockEnd)
+			{
+				alignas(32) uint64 bits[ChunkSize];
+
+				for (size_t block = blockBegin; block < blockEnd; ++block)
+				{
+					Xoshiro256PlusPlusX8 state{ seed, block };
+
+					const size_t elementEnd = Min(((block + 1) * BlockSize), numElements);
+
+					for (size_t i = (block * BlockSize); i < elementEnd; i += elementsPerChunk)
+					{
+						const size_t n = Min(elementsPerChunk, (elementEnd - i));
+						const size_t numBits = (((n * bitsPerElement) + (Lanes - 1)) / Lanes * Lanes);
+
+						generateBits(state, bits, numBits);
+
+						f(bits, i, (i + n));
+					}
+				}
+			};
+
+			if (parallelize && (1 < numBlocks))
+			{
+				Threading::ParallelFor(numBlocks, processBlocks);
+			}
+			else
+			{
+				processBlocks(0, numBlocks);
+			}
+		}
+
+		template <class Float>
+		static void FillUniform(const std::span<Float> dst, Float min, Float max, const uint64 seed, const Parallelize parallelize)
+		{
+			if (max < min)
+			{
+				std::swap(min, max);
+			}
+
+			const double dmin = min;
+			const double scale = (static_cast<double>(max) - min);
+			const Float upper = ((min < max) ? std::nextafter(max, min) : max);
+
+			GenerateBlocks(dst.size(), 1, seed, parallelize, [=](const uint64* bits, const size_t begin, const size_t end)
+			{
+				Float* pDst = (dst.data() + begin);
+
+				for (size_t i = 0; i < (end - begin); ++i)
+				{
+					pDst[i] = Min(static_cast<Float>(dmin + ToUnit(bits[i]) * scale), upper);
+				}
+			});
+		}
+
+		template <class Float>
+		static void FillNormal(const std::span<Float> dst, const Float mean, const Float stddev, const uint64 seed, const Parallelize parallelize)
+		{
+			GenerateBlocks(dst.size(), 1, seed, parallelize, [=](const uint64* bits, const size_t begin, const size_t end)
+			{
+				Float* pDst = (dst.data() + begin);
+				const size_t n = (end - begin);
+
+				// Box-Muller 法
+				for (size_t i = 0; i < n; i += 2)
+				{
+					const double r = std::sqrt(-2.0 * std::log(1.0 - ToUnit(bits[i])));
+					const double theta = (Math::TwoPi * ToUnit(bits[i + 1]));
+
+					pDst[i] = static_cast<Float>(mean + stddev * (r * std::cos(theta)));
+
+					if ((i + 1) < n)
+					{
+						pDst[i + 1] = static_cast<Float>(mean + stddev * (r * std::sin(theta)));
+					}
+				}
+			});
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFill
+	//
+	////////////////////////////////////////////////////////////////
+
+	void RandomFill(const std::span<double> dst, const double min, const double max, const Parallelize parallelize)
+	{
+		FillUniform(dst, min, max, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFill(const std::span<double> dst, const double min, const double max, const uint64 seed, const Parallelize parallelize)
+	{
+		FillUniform(dst, min, max, seed, parallelize);
+	}
+
+	void RandomFill(const std::span<float> dst, const float min, const float max, const Parallelize parallelize)
+	{
+		FillUniform(dst, min, max, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFill(const std::span<float> dst, const float min, const float max, const uint64 seed, const Parallelize parallelize)
+	{
+		FillUniform(dst, min, max, seed, parallelize);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFillNormal
+	//
+	////////////////////////////////////////////////////////////////
+
+	void RandomFillNormal(const std::span<double> dst, const double mean, const double stddev, const Parallelize parallelize)
+	{
+		FillNormal(dst, mean, stddev, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFillNormal(const std::span<double> dst, const double mean, const double stddev, const uint64 seed, const Parallelize parallelize)
+	{
+		FillNormal(dst, mean, stddev, seed, parallelize);
+	}
+
+	void RandomFillNormal(const std::span<float> dst, const float mean, const float stddev, const Parallelize parallelize)
+	{
+		FillNormal(dst, mean, stddev, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFillNormal(const std::span<float> dst, const float mean, const float stddev, const uint64 seed, const Parallelize parallelize)
+	{
+		FillNormal(dst, mean, stddev, seed, parallelize);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFillInt
+	//
+	////////////////////////////////////////////////////////////////
+
+	void RandomFillInt(const std::span<int32> dst, const int32 min, const int32 max, const Parallelize parallelize)
+	{
+		RandomFillInt(dst, min, max, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFillInt(const std::span<int32> dst, int32 min, int32 max, const uint64 seed, const Parallelize parallelize)
+	{
+		if (max < min)
+		{
+			std::swap(min, max);
+		}
+
+		const uint64 range = (static_cast<uint64>(static_cast<int64>(max) - min) + 1);
+
+		GenerateBlocks(dst.size(), 1, seed, parallelize, [=](const uint64* bits, const size_t begin, const size_t end)
+		{
+			int32* pDst = (dst.data() + begin);
+
+			for (size_t i = 0; i < (end - begin); ++i)
+			{
+				// Lemire の方法（偏りは range / 2^64 以下）
+				const uint64 offset = absl::Uint128High64(uint128{ bits[i] } * range);
+				pDst[i] = static_cast<int32>(min + static_cast<int64>(offset));
+			}
+		});
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RandomFillVec2
+	//
+	////////////////////////////////////////////////////////////////
+
+	void RandomFillVec2(const std::span<Vec2> dst, const double length, const Parallelize parallelize)
+	{
+		RandomFillVec2(dst, length, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFillVec2(const std::span<Vec2> dst, const double length, const uint64 seed, const Parallelize parallelize)
+	{
+		GenerateBlocks(dst.size(), 1, seed, parallelize, [=](const uint64* bits, const size_t begin, const size_t end)
+		{
+			Vec2* pDst = (dst.data() + begin);
+
+			for (size_t i = 0; i < (end - begin); ++i)
+			{
+				const double theta = (Math::TwoPi * ToUnit(bits[i]));
+				pDst[i].set((std::cos(theta) * length), (std::sin(theta) * length));
+			}
+		});
+	}
+
+	void RandomFillVec2(const std::span<Vec2> dst, const std::pair<double, double>& xMinMax, const std::pair<double, double>& yMinMax, const Parallelize parallelize)
+	{
+		RandomFillVec2(dst, xMinMax, yMinMax, GetDefaultRNG()(), parallelize);
+	}
+
+	void RandomFillVec2(const std::span<Vec2> dst, const std::pair<double, double>& xMinMax, const std::pair<double, double>& yMinMax, const uint64 seed, const Parallelize parallelize)
+	{
+		const double xMin = xMinMax.first;
+		const double xScale = (xMinMax.second - xMinMax.first);
+		const double yMin = yMinMax.first;
+		const double yScale = (yMinMax.second - yMinMax.first);
+
+		GenerateBlocks(dst.size(), 2, seed, parallelize, [=](const uint64* bits, const size_t begin, const size_t end)
+		{
+			Vec2* pDst = (dst.data() + begin);
+
+			for (size_t i = 0; i < (end - begin); ++i)
+			{
+				pDst[i].set((xMin + ToUnit(bits[i * 2]) * xScale), (yMin + ToUnit(bits[i * 2 + 1]) * yScale));
+			}
+		});
+	}
+}
@@ -2008,6 +2008,22 @@ namespace s3d
 		};
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	DrawBatch
+	//
+	////////////////////////////////////////////////////////////////
+
+	void RectF::DrawBatch(const std::span<const RectF> rects, const ColorF& color)
+	{
+		SIV3D_ENGINE(Renderer2D)->addRects(rects, color.toFloat4());
+	}
+
+	void RectF::DrawBatch(const std::span<const RectF> rects, const std::span<const ColorF> colors)
+	{
+		SIV3D_ENGINE(Renderer2D)->addRects(rects, colors);
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	Formatter
@@ -24,6 +24,7 @@ namespace s3d
 {
 	struct FloatRect;
 	struct FloatQuad;
+	struct GlyphQuad;
 	struct LineStyle;
 	struct BlendState;
 	struct RasterizerState;
@@ -61,6 +62,10 @@ namespace s3d
 
 		virtual void addRect(const FloatRect& rect, const PatternParameters& pattern) = 0;
 
+		virtual void addRects(std::span<const RectF> rects, const Float4& color) = 0;
+
+		virtual void addRects(std::span<const RectF> rects, std::span<const ColorF> colors) = 0;
+
 		virtual void addRectFrame(const FloatRect& innerRect, float thickness, const Float4& color0, const Float4& color1, ColorFillDirection colorType) = 0;
 
 		virtual void addRectFrame(const FloatRect& innerRect, float thickness, const PatternParameters& pattern) = 0;
@@ -71,6 +76,10 @@ namespace s3d
 
 		virtual void addCircle(const Float2& center, float r, const PatternParameters& pattern) = 0;
 
+		virtual void addCircles(std::span<const Circle> circles, const Float4& color) = 0;
+
+		virtual void addCircles(std::span<const Circle> circles, std::span<const ColorF> colors) = 0;
+
 		virtual void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor) = 0;
 
 		virtual void addCircleFrame(const Float2& center, float rInner, float thickness, const PatternParameters& pattern) = 0;
@@ -158,6 +167,8 @@ namespace s3d
 
 		virtual void addTexturedQuad(const Texture& texture, const FloatQuad& quad, const FloatRect& uv, const Float4(&colors)[4]) = 0;
 
+		virtual void addGlyphQuads(const Texture& texture, std::span<const GlyphQuad> glyphQuads, const Float4& color) = 0;
+
 		virtual void addTexturedRoundRect(const Texture& texture, const FloatRect& rect, float w, float h, float r, const FloatRect& uvRect, const Float4& color) = 0;
 
 
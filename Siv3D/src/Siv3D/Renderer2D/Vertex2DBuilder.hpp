@@ -15,18 +15,48 @@
 # include <Siv3D/FloatRect.hpp>
 # include <Siv3D/TriangleIndex.hpp>
 # include <Siv3D/FunctionRef.hpp>
+# include <Siv3D/Utility.hpp>
 # include "Vertex2DBufferPointer.hpp"
 # include "ColorFillDirection.hpp"
 
 namespace s3d
 {
 	using BufferCreatorFunc = FunctionRef<Vertex2DBufferPointer(Vertex2D::IndexType, Vertex2D::IndexType)>;
+	using DrawSubmitterFunc = FunctionRef<void(Vertex2D::IndexType)>;
 	struct LineStyle;
 	struct FloatQuad;
+	struct GlyphQuad;
 	enum class LineCap : uint8;
 
 	namespace Vertex2DBuilder
 	{
+		/// @brief 1 回の描画コマンドで扱える長方形の最大数（1 個あたり 4 頂点・6 インデックス）
+		inline constexpr size_t MaxBatchRectCount = Min<size_t>((Vertex2D::MaxBatchVertexCount / 4), (Vertex2D::MaxBatchIndexCount / 6));
+
+		/// @brief 図形の配列を、1 回の描画に収まる範囲ずつ頂点に変換し、範囲ごとに描画コマンドを発行します。
+		/// @param count 図形の個数
+		/// @param buildBatch `(size_t offset, size_t& builtCount)` を受け取り、offset 番目以降の図形の頂点を生成してインデックス数を返す関数
+		/// @param submitDraw 範囲ごとに、生成したインデックス数を受け取る関数
+		template <class BuildBatch>
+		void BuildBatches(const size_t count, BuildBatch&& buildBatch, const DrawSubmitterFunc& submitDraw)
+		{
+			for (size_t offset = 0; offset < count;)
+			{
+				size_t builtCount = 0;
+
+				const Vertex2D::IndexType indexCount = buildBatch(offset, builtCount);
+
+				if ((indexCount == 0) || (builtCount == 0))
+				{
+					return;
+				}
+
+				submitDraw(indexCount);
+
+				offset += builtCount;
+			}
+		}
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildLine(const BufferCreatorFunc& bufferCreator, LineCap startCap, LineCap endCap, const Float2& start, const Float2& end, float thickness, const Float4(&colors)[2], float scale);
 
@@ -48,6 +78,22 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRect(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, const Float4(&colors)[4]);
 
+		/// @brief 1 回の描画に収まる先頭の長方形の頂点をまとめて生成します。
+		/// @param builtCount 頂点を生成した長方形の個数の格納先
+		[[nodiscard]]
+		Vertex2D::IndexType BuildRects(const BufferCreatorFunc& bufferCreator, std::span<const RectF> rects, const Float4& color, size_t& builtCount);
+
+		/// @brief 1 回の描画に収まる先頭の長方形の頂点を、それぞれの色でまとめて生成します。
+		/// @param builtCount 頂点を生成した長方形の個数の格納先
+		[[nodiscard]]
+		Vertex2D::IndexType BuildRects(const BufferCreatorFunc& bufferCreator, std::span<const RectF> rects, std::span<const ColorF> colors, size_t& builtCount);
+
+		/// @brief 長方形の頂点を 1 回の描画に収まる個数ずつ生成し、そのたびに submitDraw を呼びます。
+		void BuildRectBatches(const BufferCreatorFunc& bufferCreator, std::span<const RectF> rects, const Float4& color, const DrawSubmitterFunc& submitDraw);
+
+		/// @brief 長方形の頂点をそれぞれの色で 1 回の描画に収まる個数ずつ生成し、そのたびに submitDraw を呼びます。
+		void BuildRectBatches(const BufferCreatorFunc& bufferCreator, std::span<const RectF> rects, std::span<const ColorF> colors, const DrawSubmitterFunc& submitDraw);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRectFrame(const BufferCreatorFunc& bufferCreator, const FloatRect& innerRect, float thickness, ColorFillDirection colorType, const Float4& color0, const Float4& color1);
 
@@ -57,6 +103,22 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircle(const BufferCreatorFunc& bufferCreator, const Float2& center, float r, ColorFillDirection colorType, const Float4& color0, const Float4& color1, float scale);
 
+		/// @brief 1 回の描画に収まる先頭の円の頂点をまとめて生成します。
+		/// @param builtCount 頂点を生成した円の個数の格納先
+		[[nodiscard]]
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, std::span<const Circle> circles, const Float4& color, float scale, size_t& builtCount);
+
+		/// @brief 1 回の描画に収まる先頭の円の頂点を、それぞれの色でまとめて生成します。
+		/// @param builtCount 頂点を生成した円の個数の格納先
+		[[nodiscard]]
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, std::span<const Circle> circles, std::span<const ColorF> colors, float scale, size_t& builtCount);
+
+		/// @brief 円の頂点を 1 回の描画に収まる個数ずつ生成し、そのたびに submitDraw を呼びます。
+		void BuildCircleBatches(const BufferCreatorFunc& bufferCreator, std::span<const Circle> circles, const Float4& color, float scale, const DrawSubmitterFunc& submitDraw);
+
+		/// @brief 円の頂点をそれぞれの色で 1 回の描画に収まる個数ずつ生成し、そのたびに submitDraw を呼びます。
+		void BuildCircleBatches(const BufferCreatorFunc& bufferCreator, std::span<const Circle> circles, std::span<const ColorF> colors, float scale, const DrawSubmitterFunc& submitDraw);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircleFrame(const BufferCreatorFunc& bufferCreator, const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor, float scale);
 
@@ -138,6 +200,14 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildTexturedQuad(const BufferCreatorFunc& bufferCreator, const FloatQuad& rect, const FloatRect& uv, const Float4(&colors)[4]);
 
+		/// @brief 1 回の描画に収まる先頭のグリフの頂点をまとめて生成します。
+		/// @param builtCount 頂点を生成したグリフの個数の格納先
+		[[nodiscard]]
+		Vertex2D::IndexType BuildGlyphQuads(const BufferCreatorFunc& bufferCreator, std::span<const GlyphQuad> glyphQuads, const Float4& color, size_t& builtCount);
+
+		/// @brief グリフの頂点を 1 回の描画に収まる個数ずつ生成し、そのたびに submitDraw を呼びます。
+		void BuildGlyphQuadBatches(const BufferCreatorFunc& bufferCreator, std::span<const GlyphQuad> glyphQuads, const Float4& color, const DrawSubmitterFunc& submitDraw);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildTexturedRoundRect(const BufferCreatorFunc& bufferCreator, const FloatRect& rect, float w, float h, float r, const FloatRect& uvRect, const Float4& color, float scale);
 
@@ -15,6 +15,7 @@
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/FloatQuad.hpp>
 # include <Siv3D/QuarterArcTable.hpp>
+# include <Siv3D/SIMD.hpp>
 
 namespace s3d
 {
@@ -677,8 +678,8 @@ namespace s3d
 		[[nodiscard]]
 		static Vertex2D::IndexType EmitLineStringStrip(const BufferCreatorFunc& bufferCreator, const std::span<const Float2> pts, const float halfThickness, const bool closed, ColorFn&& colorAt, float* pStartAngle = nullptr, float* pEndAngle = nullptr)
 		{
-			// 頂点数 (2n) とインデックス数 (6n) の双方が IndexType に収まる点数に制限する。
-			constexpr size_t MaxPointCount = (std::numeric_limits<Vertex2D::IndexType>::max() / 6);
+			// 頂点数 (2n) とインデックス数 (6n) の双方が 1 回の描画バッチに収まる点数に制限する。
+			constexpr size_t MaxPointCount = Min<size_t>((Vertex2D::MaxBatchVertexCount / 2), (Vertex2D::MaxBatchIndexCount / 6));
 
 			const size_t n = pts.size();
 
@@ -1021,6 +1022,117 @@ namespace s3d
 
 			return ((cycle * Math::TwoPiF) + (segment * Math::TwoPiF / segmentCount));
 		}
+
+		/// @brief 円の外周の頂点を書き込みます。
+		/// @param pDst 書き込み先（円周の頂点数 = unitVectors.size() * 4）
+		/// @param centerX 円の中心の X 座標
+		/// @param centerY 円の中心の Y 座標
+		/// @param r 円の半径
+		/// @param unitVectors 円周の 1/4 に相当する単位ベクトル
+		/// @param color 色
+		static void WriteCircleRim(Vertex2D* pDst, const float centerX, const float centerY, const float r, const std::span<const Float2> unitVectors, const Float4& color) noexcept
+		{
+			const size_t quality = unitVectors.size();
+			Vertex2D* pDst0 = pDst;
+			Vertex2D* pDst1 = (pDst0 + quality);
+			Vertex2D* pDst2 = (pDst1 + quality);
+			Vertex2D* pDst3 = (pDst2 + quality);
+
+		# if SIV3D_INTRINSIC(SSE)
+
+			// 1 つの単位ベクトルから 2 象限分の座標を 1 本のレジスタで求める
+			const __m128 center = ::_mm_setr_ps(centerX, centerY, centerX, centerY);
+			const __m128 radius = ::_mm_set1_ps(r);
+			const __m128 negateZ = ::_mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f);
+			const __m128 c = ::_mm_loadu_ps(&color.x);
+
+			for (size_t i = 0; i < quality; ++i)
+			{
+				const __m128 cs = ::_mm_castpd_ps(::_mm_load1_pd(reinterpret_cast<const double*>(&unitVectors[i]))); // [x, y, x, y]
+				const __m128 xy = ::_mm_mul_ps(cs, radius);
+				const __m128 offset = ::_mm_xor_ps(_mm_shuffle_ps(xy, xy, _MM_SHUFFLE(0, 1, 1, 0)), negateZ); // [x, y, -y, x]
+				const __m128 p01 = ::_mm_add_ps(center, offset); // [cx + x, cy + y, cx - y, cy + x]
+				const __m128 p23 = ::_mm_sub_ps(center, offset); // [cx - x, cy - y, cx + y, cy - x]
+
+				::_mm_storel_pi(reinterpret_cast<__m64*>(&pDst0[i].pos), p01);
+				::_mm_storeh_pi(reinterpret_cast<__m64*>(&pDst1[i].pos), p01);
+				::_mm_storel_pi(reinterpret_cast<__m64*>(&pDst2[i].pos), p23);
+				::_mm_storeh_pi(reinterpret_cast<__m64*>(&pDst3[i].pos), p23);
+
+				::_mm_store_ps(&pDst0[i].color.x, c);
+				::_mm_store_ps(&pDst1[i].color.x, c);
+				::_mm_store_ps(&pDst2[i].color.x, c);
+				::_mm_store_ps(&pDst3[i].color.x, c);
+			}
+
+		# else
+
+			for (size_t i = 0; i < quality; ++i)
+			{
+				const float x = (unitVectors[i].x * r);
+				const float y = (unitVectors[i].y * r);
+
+				pDst0[i].set((centerX + x), (centerY + y), color);
+				pDst1[i].set((centerX - y), (centerY + x), color);
+				pDst2[i].set((centerX - x), (centerY - y), color);
+				pDst3[i].set((centerX + y), (centerY - x), color);
+			}
+
+		# endif
+		}
+
+		/// @brief 中心と外周からなる扇状の円のインデックスを書き込みます。
+		/// @param pIndex 書き込み先
+		/// @param indexOffset 中心の頂点のインデックス
+		/// @param fullQuality 円周の頂点数
+		/// @return 書き込み先の終端
+		static Vertex2D::IndexType* WriteCircleIndices(Vertex2D::IndexType* pIndex, const Vertex2D::IndexType indexOffset, const Vertex2D::IndexType fullQuality) noexcept
+		{
+			for (Vertex2D::IndexType i = 0; i < (fullQuality - 1); ++i)
+			{
+				*pIndex++ = indexOffset;
+				*pIndex++ = indexOffset + (i + 1);
+				*pIndex++ = indexOffset + (i + 2);
+			}
+
+			*pIndex++ = indexOffset;
+			*pIndex++ = (indexOffset + fullQuality);
+			*pIndex++ = (indexOffset + 1);
+
+			return pIndex;
+		}
+
+		/// @brief 円の配列から、1 回の描画に収まる先頭の円の個数と、必要な頂点数・インデックス数を求めます。
+		/// @param circles 円の配列
+		/// @param scale 拡大率
+		/// @param vertexCount 必要な頂点数の格納先
+		/// @param indexCount 必要なインデックス数の格納先
+		/// @return 1 回の描画に収まる円の個数
+		[[nodiscard]]
+		static size_t CountCircleBatch(const std::span<const Circle> circles, const float scale, uint32& vertexCount, uint32& indexCount) noexcept
+		{
+			vertexCount = 0;
+			indexCount = 0;
+
+			size_t count = 0;
+
+			for (const auto& circle : circles)
+			{
+				const uint32 fullQuality = (CalculateCircleQuality(Abs(static_cast<float>(circle.r)) * scale) * 4);
+
+				if ((Vertex2D::MaxBatchIndexCount < (indexCount + fullQuality * 3))
+					|| (Vertex2D::MaxBatchVertexCount < (vertexCount + fullQuality + 1)))
+				{
+					break;
+				}
+
+				vertexCount += (fullQuality + 1);
+				indexCount += (fullQuality * 3);
+				++count;
+			}
+
+			return count;
+		}
 	}
 
 	namespace Vertex2DBuilder
@@ -1275,6 +1387,108 @@ namespace s3d
 			return IndexCount;
 		}
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildCircles
+		//
+		////////////////////////////////////////////////////////////////
+
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, const std::span<const Circle> circles, const Float4& color, const float scale, size_t& builtCount)
+		{
+			uint32 vertexCount, indexCount;
+			builtCount = CountCircleBatch(circles, scale, vertexCount, indexCount);
+
+			if (builtCount == 0)
+			{
+				return 0;
+			}
+
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(static_cast<Vertex2D::IndexType>(vertexCount), static_cast<Vertex2D::IndexType>(indexCount));
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			for (const auto& circle : circles.first(builtCount))
+			{
+				const float r = Abs(static_cast<float>(circle.r));
+				const Vertex2D::IndexType Quality = CalculateCircleQuality(r * scale);
+				const Vertex2D::IndexType FullQuality = (Quality * 4);
+				const float centerX = static_cast<float>(circle.x);
+				const float centerY = static_cast<float>(circle.y);
+
+				pVertex->set(centerX, centerY, color);
+				WriteCircleRim((pVertex + 1), centerX, centerY, r, QuarterArcTable::GetUnitVectors(Quality), color);
+				pIndex = WriteCircleIndices(pIndex, indexOffset, FullQuality);
+
+				pVertex += (FullQuality + 1);
+				indexOffset += (FullQuality + 1);
+			}
+
+			return static_cast<Vertex2D::IndexType>(indexCount);
+		}
+
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, const std::span<const Circle> circles, const std::span<const ColorF> colors, const float scale, size_t& builtCount)
+		{
+			uint32 vertexCount, indexCount;
+			builtCount = CountCircleBatch(circles.first(Min(circles.size(), colors.size())), scale, vertexCount, indexCount);
+
+			if (builtCount == 0)
+			{
+				return 0;
+			}
+
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(static_cast<Vertex2D::IndexType>(vertexCount), static_cast<Vertex2D::IndexType>(indexCount));
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			for (size_t i = 0; i < builtCount; ++i)
+			{
+				const Circle& circle = circles[i];
+				const Float4 color = colors[i].toFloat4();
+				const float r = Abs(static_cast<float>(circle.r));
+				const Vertex2D::IndexType Quality = CalculateCircleQuality(r * scale);
+				const Vertex2D::IndexType FullQuality = (Quality * 4);
+				const float centerX = static_cast<float>(circle.x);
+				const float centerY = static_cast<float>(circle.y);
+
+				pVertex->set(centerX, centerY, color);
+				WriteCircleRim((pVertex + 1), centerX, centerY, r, QuarterArcTable::GetUnitVectors(Quality), color);
+				pIndex = WriteCircleIndices(pIndex, indexOffset, FullQuality);
+
+				pVertex += (FullQuality + 1);
+				indexOffset += (FullQuality + 1);
+			}
+
+			return static_cast<Vertex2D::IndexType>(indexCount);
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildCircleBatches
+		//
+		////////////////////////////////////////////////////////////////
+
+		void BuildCircleBatches(const BufferCreatorFunc& bufferCreator, const std::span<const Circle> circles, const Float4& color, const float scale, const DrawSubmitterFunc& submitDraw)
+		{
+			BuildBatches(circles.size(), [&](const size_t offset, size_t& builtCount)
+				{
+					return BuildCircles(bufferCreator, circles.subspan(offset), color, scale, builtCount);
+				}, submitDraw);
+		}
+
+		void BuildCircleBatches(const BufferCreatorFunc& bufferCreator, const std::span<const Circle> circles, const std::span<const ColorF> colors, const float scale, const DrawSubmitterFunc& submitDraw)
+		{
+			BuildBatches(Min(circles.size(), colors.size()), [&](const size_t offset, size_t& builtCount)
+				{
+					return BuildCircles(bufferCreator, circles.subspan(offset), colors.subspan(offset), scale, builtCount);
+				}, submitDraw);
+		}
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	BuildCircleFrame
@@ -1371,9 +1585,7 @@ namespace s3d
 			const size_t vertexCount = (static_cast<size_t>(dashCount) * Quality * 2);
 			const size_t indexCount = (static_cast<size_t>(dashCount) * (Quality - 1) * 6);
 
-			constexpr size_t MaxIndexValue = static_cast<size_t>(std::numeric_limits<Vertex2D::IndexType>::max());
-
-			if ((MaxIndexValue < vertexCount) || (MaxIndexValue < indexCount))
+			if ((Vertex2D::MaxBatchVertexCount < vertexCount) || (Vertex2D::MaxBatchIndexCount < indexCount))
 			{
 				return 0;
 			}
@@ -1864,9 +2076,7 @@ namespace s3d
 			const size_t vertexCount = (static_cast<size_t>(dashCount) * pointCountPerDash * 2);
 			const size_t indexCount = (static_cast<size_t>(dashCount) * (pointCountPerDash - 1) * 6);
 
-			constexpr size_t MaxIndexValue = static_cast<size_t>(std::numeric_limits<Vertex2D::IndexType>::max());
-
-			if ((MaxIndexValue < vertexCount) || (MaxIndexValue < indexCount))
+			if ((Vertex2D::MaxBatchVertexCount < vertexCount) || (Vertex2D::MaxBatchIndexCount < indexCount))
 			{
 				return 0;
 			}
@@ -3125,9 +3335,7 @@ namespace s3d
 			const size_t vertexCount = (totalVertexPairs * 2);
 			const size_t indexCount = (totalQuads * 6);
 
-			constexpr size_t MaxIndexValue = static_cast<size_t>(std::numeric_limits<Vertex2D::IndexType>::max());
-
-			if ((vertexCount == 0) || (indexCount == 0) || (MaxIndexValue < vertexCount) || (MaxIndexValue < indexCount))
+			if ((vertexCount == 0) || (indexCount == 0) || (Vertex2D::MaxBatchVertexCount < vertexCount) || (Vertex2D::MaxBatchIndexCount < indexCount))
 			{
 				return 0;
 			}
@@ -10,9 +10,11 @@
 //-----------------------------------------------
 
 # include <array>
+# include <limits>
 # include "Vertex2DBuilder.hpp"
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/GlyphQuad.hpp>
 
 namespace s3d
 {
@@ -22,6 +24,23 @@ namespace s3d
 
 		static constexpr Vertex2D::IndexType RectFrameIndexTable[24] = { 0, 2, 1, 1, 2, 3, 2, 4, 3, 3, 4, 5, 4, 6, 5, 5, 6, 7, 6, 0, 7, 7, 0, 1 };
 
+		/// @brief 連続する長方形のインデックスを書き込みます。
+		/// @param pIndex 書き込み先
+		/// @param indexOffset 最初の長方形の頂点のインデックス
+		/// @param count 長方形の個数
+		static void WriteRectIndices(Vertex2D::IndexType* pIndex, Vertex2D::IndexType indexOffset, const size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				for (Vertex2D::IndexType k = 0; k < 6; ++k)
+				{
+					*pIndex++ = (indexOffset + RectIndexTable[k]);
+				}
+
+				indexOffset += 4;
+			}
+		}
+
 		struct RectFrameDashedQuad
 		{
 			float left;
@@ -438,6 +457,110 @@ namespace s3d
 			return IndexCount;
 		}
 
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildRects
+		//
+		////////////////////////////////////////////////////////////////
+
+		Vertex2D::IndexType BuildRects(const BufferCreatorFunc& bufferCreator, const std::span<const RectF> rects, const Float4& color, size_t& builtCount)
+		{
+			builtCount = Min(rects.size(), MaxBatchRectCount);
+
+			if (builtCount == 0)
+			{
+				return 0;
+			}
+
+			const Vertex2D::IndexType VertexCount	= static_cast<Vertex2D::IndexType>(builtCount * 4);
+			const Vertex2D::IndexType IndexCount	= static_cast<Vertex2D::IndexType>(builtCount * 6);
+			auto [pVertex, pIndex, indexOffset]		= bufferCreator(VertexCount, IndexCount);
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			for (const auto& rect : rects.first(builtCount))
+			{
+				const float left	= static_cast<float>(rect.x);
+				const float top		= static_cast<float>(rect.y);
+				const float right	= static_cast<float>(rect.x + rect.w);
+				const float bottom	= static_cast<float>(rect.y + rect.h);
+
+				pVertex[0].set(left, top, color);
+				pVertex[1].set(right, top, color);
+				pVertex[2].set(left, bottom, color);
+				pVertex[3].set(right, bottom, color);
+				pVertex += 4;
+			}
+
+			WriteRectIndices(pIndex, indexOffset, builtCount);
+
+			return IndexCount;
+		}
+
+		Vertex2D::IndexType BuildRects(const BufferCreatorFunc& bufferCreator, const std::span<const RectF> rects, const std::span<const ColorF> colors, size_t& builtCount)
+		{
+			builtCount = Min(Min(rects.size(), colors.size()), MaxBatchRectCount);
+
+			if (builtCount == 0)
+			{
+				return 0;
+			}
+
+			const Vertex2D::IndexType VertexCount	= static_cast<Vertex2D::IndexType>(builtCount * 4);
+			const Vertex2D::IndexType IndexCount	= static_cast<Vertex2D::IndexType>(builtCount * 6);
+			auto [pVertex, pIndex, indexOffset]		= bufferCreator(VertexCount, IndexCount);
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			for (size_t i = 0; i < builtCount; ++i)
+			{
+				const RectF& rect	= rects[i];
+				const Float4 color	= colors[i].toFloat4();
+				const float left	= static_cast<float>(rect.x);
+				const float top		= static_cast<float>(rect.y);
+				const float right	= static_cast<float>(rect.x + rect.w);
+				const float bottom	= static_cast<float>(rect.y + rect.h);
+
+				pVertex[0].set(left, top, color);
+				pVertex[1].set(right, top, color);
+				pVertex[2].set(left, bottom, color);
+				pVertex[3].set(right, bottom, color);
+				pVertex += 4;
+			}
+
+			WriteRectIndices(pIndex, indexOffset, builtCount);
+
+			return IndexCount;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildRectBatches
+		//
+		////////////////////////////////////////////////////////////////
+
+		void BuildRectBatches(const BufferCreatorFunc& bufferCreator, const std::span<const RectF> rects, const Float4& color, const DrawSubmitterFunc& submitDraw)
+		{
+			BuildBatches(rects.size(), [&](const size_t offset, size_t& builtCount)
+				{
+					return BuildRects(bufferCreator, rects.subspan(offset), color, builtCount);
+				}, submitDraw);
+		}
+
+		void BuildRectBatches(const BufferCreatorFunc& bufferCreator, const std::span<const RectF> rects, const std::span<const ColorF> colors, const DrawSubmitterFunc& submitDraw)
+		{
+			BuildBatches(Min(rects.size(), colors.size()), [&](const size_t offset, size_t& builtCount)
+				{
+					return BuildRects(bufferCreator, rects.subspan(offset), colors.subspan(offset), builtCount);
+				}, submitDraw);
+		}
+
 		////////////////////////////////////////////////////////////////
 		//
 		//	BuildRectFrame
@@ -554,9 +677,7 @@ namespace s3d
 
 			const size_t vertexCount = (quadCount * 4);
 			const size_t indexCount = (quadCount * 6);
-			constexpr size_t MaxIndexValue = static_cast<size_t>(std::numeric_limits<Vertex2D::IndexType>::max());
-
-			if ((MaxIndexValue < vertexCount) || (MaxIndexValue < indexCount))
+			if ((Vertex2D::MaxBatchVertexCount < vertexCount) || (Vertex2D::MaxBatchIndexCount < indexCount))
 			{
 				return 0;
 			}
@@ -846,5 +967,60 @@ namespace s3d
 
 			return IndexCount;
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildGlyphQuads
+		//
+		////////////////////////////////////////////////////////////////
+
+		Vertex2D::IndexType BuildGlyphQuads(const BufferCreatorFunc& bufferCreator, const std::span<const GlyphQuad> glyphQuads, const Float4& color, size_t& builtCount)
+		{
+			builtCount = Min(glyphQuads.size(), MaxBatchRectCount);
+
+			if (builtCount == 0)
+			{
+				return 0;
+			}
+
+			const Vertex2D::IndexType VertexCount	= static_cast<Vertex2D::IndexType>(builtCount * 4);
+			const Vertex2D::IndexType IndexCount	= static_cast<Vertex2D::IndexType>(builtCount * 6);
+			auto [pVertex, pIndex, indexOffset]		= bufferCreator(VertexCount, IndexCount);
+
+			if (not pVertex)
+			{
+				return 0;
+			}
+
+			for (const auto& glyphQuad : glyphQuads.first(builtCount))
+			{
+				const FloatRect& rect	= glyphQuad.rect;
+				const FloatRect& uv		= glyphQuad.uvRect;
+
+				pVertex[0].set(rect.left, rect.top, uv.left, uv.top, color);
+				pVertex[1].set(rect.right, rect.top, uv.right, uv.top, color);
+				pVertex[2].set(rect.left, rect.bottom, uv.left, uv.bottom, color);
+				pVertex[3].set(rect.right, rect.bottom, uv.right, uv.bottom, color);
+				pVertex += 4;
+			}
+
+			WriteRectIndices(pIndex, indexOffset, builtCount);
+
+			return IndexCount;
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	BuildGlyphQuadBatches
+		//
+		////////////////////////////////////////////////////////////////
+
+		void BuildGlyphQuadBatches(const BufferCreatorFunc& bufferCreator, const std::span<const GlyphQuad> glyphQuads, const Float4& color, const DrawSubmitterFunc& submitDraw)
+		{
+			BuildBatches(glyphQuads.size(), [&](const size_t offset, size_t& builtCount)
+				{
+					return BuildGlyphQuads(bufferCreator, glyphQuads.subspan(offset), color, builtCount);
+				}, submitDraw);
+		}
 	}
 }
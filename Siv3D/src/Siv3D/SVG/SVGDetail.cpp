@@ -9,10 +9,54 @@
 //
 //-----------------------------------------------
 
+# include <bit>
 # include "SVGDetail.hpp"
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/EngineLog.hpp>
 
 namespace s3d
 {
+	namespace
+	{
+		/// @brief a / b の値を負の無限大方向に丸めます。
+		[[nodiscard]]
+		static constexpr int64 FloorDiv(const int64 a, const int64 b) noexcept
+		{
+			return ((a >= 0) ? (a / b) : -((-a + b - 1) / b));
+		}
+
+		/// @brief SVG のタイルを 1 枚レンダリングします。
+		/// @param document SVG ドキュメント
+		/// @param tileX タイルの X インデックス
+		/// @param tileY タイルの Y インデックス
+		/// @param scale 拡大率
+		/// @param background 背景色
+		/// @param premultiplyAlpha アルファ乗算を適用するか
+		/// @return レンダリング結果
+		[[nodiscard]]
+		static Image RenderTile(const lunasvg::Document& document, const int32 tileX, const int32 tileY, const double scale, const Color& background, const PremultiplyAlpha premultiplyAlpha)
+		{
+			Image image{ Size{ SVG::TileSize, SVG::TileSize } };
+
+			// Image のメモリに直接レンダリングする
+			lunasvg::Bitmap bitmap{ reinterpret_cast<uint8_t*>(image.data()), image.width(), image.height(), (image.width() * static_cast<int>(sizeof(Color))) };
+			bitmap.clear(background.abgr().asUint32());
+
+			const lunasvg::Matrix matrix{ static_cast<float>(scale), 0.0f, 0.0f, static_cast<float>(scale),
+				static_cast<float>(-static_cast<int64>(tileX) * SVG::TileSize), static_cast<float>(-static_cast<int64>(tileY) * SVG::TileSize) };
+			document.render(bitmap, matrix);
+
+			image.bgraToRGBA();
+
+			if (not premultiplyAlpha)
+			{
+				image.unpremultiplyAlpha();
+			}
+
+			return image;
+		}
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	parse
@@ -25,7 +69,17 @@ namespace s3d
 
 		m_document = lunasvg::Document::loadFromData(source);
 
-		return static_cast<bool>(m_document);
+		if (not m_document)
+		{
+			return false;
+		}
+
+		m_source = source;
+
+		// 文字のグリフは全ての文書で共有されるフォントにキャッシュされるため、text 要素を含む文書は並列にレンダリングしない
+		m_hasText = (not m_document->querySelectorAll("text").empty());
+
+		return true;
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -80,6 +134,14 @@ namespace s3d
 	void SVG::SVGDetail::clear()
 	{
 		m_document.reset();
+		m_source.clear();
+		m_source.shrink_to_fit();
+		m_hasText = false;
+
+		clearTileCache();
+
+		std::lock_guard lock{ m_mutex };
+		m_renderDocuments.clear();
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -114,4 +176,239 @@ namespace s3d
 
 		return image;
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	renderRegion
+	//
+	////////////////////////////////////////////////////////////////
+
+	Image SVG::SVGDetail::renderRegion(const RectF& region, const double scale, const Color& background, const PremultiplyAlpha premultiplyAlpha, const Parallelize parallelize) const
+	{
+		if ((not m_document) || (region.w <= 0.0) || (region.h <= 0.0) || (scale <= 0.0))
+		{
+			return{};
+		}
+
+		// 出力するピクセルの範囲（拡大後の座標系）
+		const double left = std::floor(region.x * scale);
+		const double top = std::floor(region.y * scale);
+		const double right = std::ceil((region.x + region.w) * scale);
+		const double bottom = std::ceil((region.y + region.h) * scale);
+
+		// 整数に変換する前に、座標がタイルの番号に収まるかを調べる
+		constexpr double MaxCoordinate = std::numeric_limits<int32>::max();
+
+		if ((not (Abs(left) <= MaxCoordinate)) || (not (Abs(top) <= MaxCoordinate))
+			|| (not (Abs(right) <= MaxCoordinate)) || (not (Abs(bottom) <= MaxCoordinate)))
+		{
+			LOG_FAIL(fmt::format("❌ SVG::renderRegion(): The region {} scaled by {} is out of range", region, scale));
+			return{};
+		}
+
+		const int64 xBegin = static_cast<int64>(left);
+		const int64 yBegin = static_cast<int64>(top);
+		const int64 xEnd = static_cast<int64>(right);
+		const int64 yEnd = static_cast<int64>(bottom);
+
+		// int32 に変換する前に、画像の最大サイズを超えていないかを調べる
+		if ((Image::MaxWidth < (xEnd - xBegin)) || (Image::MaxHeight < (yEnd - yBegin)))
+		{
+			LOG_FAIL(fmt::format("❌ SVG::renderRegion(): The output size {}x{} exceeds the maximum image size {}x{}", (xEnd - xBegin), (yEnd - yBegin), Image::MaxWidth, Image::MaxHeight));
+			return{};
+		}
+
+		Image image{ Size{ static_cast<int32>(xEnd - xBegin), static_cast<int32>(yEnd - yBegin) } };
+
+		if (not image)
+		{
+			return{};
+		}
+
+		const int32 tileXBegin = static_cast<int32>(FloorDiv(xBegin, TileSize));
+		const int32 tileYBegin = static_cast<int32>(FloorDiv(yBegin, TileSize));
+		const int32 tileXEnd = static_cast<int32>(FloorDiv((xEnd - 1), TileSize) + 1);
+		const int32 tileYEnd = static_cast<int32>(FloorDiv((yEnd - 1), TileSize) + 1);
+
+		Array<TileKey> keys;
+		Array<std::shared_ptr<const Image>> tiles;
+		Array<size_t> missingIndices;
+
+		for (int32 tileY = tileYBegin; tileY < tileYEnd; ++tileY)
+		{
+			for (int32 tileX = tileXBegin; tileX < tileXEnd; ++tileX)
+			{
+				const TileKey key{
+					.scaleBits			= std::bit_cast<uint64>(scale),
+					.x					= tileX,
+					.y					= tileY,
+					.background			= background.asUint32(),
+					.premultiplyAlpha	= static_cast<uint32>(premultiplyAlpha.getBool()),
+				};
+
+				std::shared_ptr<const Image> tile = findTile(key);
+
+				if (not tile)
+				{
+					missingIndices << keys.size();
+				}
+
+				keys << key;
+				tiles << std::move(tile);
+			}
+		}
+
+		// キャッシュに無いタイルだけをレンダリングする
+		if (missingIndices)
+		{
+			std::unique_lock textLock{ m_textRenderMutex, std::defer_lock };
+
+			if (m_hasText)
+			{
+				textLock.lock();
+			}
+
+			const auto renderTiles = [&](const size_t begin, const size_t end)
+			{
+				std::unique_ptr<lunasvg::Document> document = acquireRenderDocument();
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					const size_t index = missingIndices[i];
+					tiles[index] = std::make_shared<const Image>(RenderTile(*document, keys[index].x, keys[index].y, scale, background, premultiplyAlpha));
+				}
+
+				releaseRenderDocument(std::move(document));
+			};
+
+			if (parallelize && (not m_hasText) && (1 < missingIndices.size()))
+			{
+				Threading::ParallelFor(missingIndices.size(), renderTiles);
+			}
+			else
+			{
+				renderTiles(0, missingIndices.size());
+			}
+
+			for (const size_t index : missingIndices)
+			{
+				addTile(keys[index], tiles[index]);
+			}
+		}
+
+		for (size_t i = 0; i < keys.size(); ++i)
+		{
+			const Point pos{ static_cast<int32>((static_cast<int64>(keys[i].x) * TileSize) - xBegin),
+				static_cast<int32>((static_cast<int64>(keys[i].y) * TileSize) - yBegin) };
+			tiles[i]->overwrite(image, pos);
+		}
+
+		return image;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setTileCacheCapacity, getTileCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SVG::SVGDetail::setTileCacheCapacity(const size_t capacity)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_tileCacheCapacity = capacity;
+
+		while (m_tileCacheCapacity < m_tiles.size())
+		{
+			m_tileIndex.erase(m_tiles.back().first);
+			m_tiles.pop_back();
+		}
+	}
+
+	size_t SVG::SVGDetail::getTileCacheCapacity() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_tileCacheCapacity;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clearTileCache
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SVG::SVGDetail::clearTileCache()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_tiles.clear();
+		m_tileIndex.clear();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	(private function)
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::unique_ptr<lunasvg::Document> SVG::SVGDetail::acquireRenderDocument() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if (m_renderDocuments)
+		{
+			std::unique_ptr<lunasvg::Document> document = std::move(m_renderDocuments.back());
+			m_renderDocuments.pop_back();
+			return document;
+		}
+
+		// 同じソースから、このスレッド専用の文書を作成する
+		std::unique_ptr<lunasvg::Document> document = lunasvg::Document::loadFromData(m_source);
+		document->updateLayout();
+		return document;
+	}
+
+	void SVG::SVGDetail::releaseRenderDocument(std::unique_ptr<lunasvg::Document>&& document) const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_renderDocuments.push_back(std::move(document));
+	}
+
+	std::shared_ptr<const Image> SVG::SVGDetail::findTile(const TileKey& key) const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		const auto it = m_tileIndex.find(key);
+
+		if (it == m_tileIndex.end())
+		{
+			return nullptr;
+		}
+
+		// 最近使ったタイルとして先頭に移動する
+		m_tiles.splice(m_tiles.begin(), m_tiles, it->second);
+
+		return it->second->second;
+	}
+
+	void SVG::SVGDetail::addTile(const TileKey& key, const std::shared_ptr<const Image>& tile) const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		if ((m_tileCacheCapacity == 0) || m_tileIndex.contains(key))
+		{
+			return;
+		}
+
+		m_tiles.emplace_front(key, tile);
+		m_tileIndex.emplace(key, m_tiles.begin());
+
+		while (m_tileCacheCapacity < m_tiles.size())
+		{
+			m_tileIndex.erase(m_tiles.back().first);
+			m_tiles.pop_back();
+		}
+	}
 }
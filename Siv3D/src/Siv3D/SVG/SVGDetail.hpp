@@ -10,7 +10,11 @@
 //-----------------------------------------------
 
 # pragma once
+# include <list>
+# include <mutex>
 # include <Siv3D/SVG.hpp>
+# include <Siv3D/HashMap.hpp>
+# include <Siv3D/Hash.hpp>
 # include <ThirdParty/lunasvg/lunasvg.h>
 
 namespace s3d
@@ -35,8 +39,84 @@ namespace s3d
 		[[nodiscard]]
 		Image render(const Optional<int32>& maxWidth, const Optional<int32>& maxHeight, const Color& background, PremultiplyAlpha premultiplyAlpha) const;
 
+		[[nodiscard]]
+		Image renderRegion(const RectF& region, double scale, const Color& background, PremultiplyAlpha premultiplyAlpha, Parallelize parallelize) const;
+
+		void setTileCacheCapacity(size_t capacity);
+
+		[[nodiscard]]
+		size_t getTileCacheCapacity() const;
+
+		void clearTileCache();
+
 	private:
 
+		/// @brief タイルキャッシュのキー
+		struct TileKey
+		{
+			/// @brief 拡大率のビット表現
+			uint64 scaleBits;
+
+			/// @brief タイルの X インデックス
+			int32 x;
+
+			/// @brief タイルの Y インデックス
+			int32 y;
+
+			/// @brief 背景色
+			uint32 background;
+
+			/// @brief アルファ乗算を適用しているか
+			uint32 premultiplyAlpha;
+
+			[[nodiscard]]
+			friend constexpr bool operator ==(const TileKey&, const TileKey&) noexcept = default;
+		};
+
+		struct TileKeyHash
+		{
+			[[nodiscard]]
+			size_t operator ()(const TileKey& key) const noexcept
+			{
+				return static_cast<size_t>(Hash(key));
+			}
+		};
+
+		using TileList = std::list<std::pair<TileKey, std::shared_ptr<const Image>>>;
+
 		std::unique_ptr<lunasvg::Document> m_document;
+
+		/// @brief SVG のソース。タイルのレンダリング用の文書を作成するために保持する
+		std::string m_source;
+
+		/// @brief 文書が text 要素を含むか
+		bool m_hasText = false;
+
+		/// @brief タイルキャッシュとレンダリング用の文書を保護するミューテックス
+		mutable std::mutex m_mutex;
+
+		/// @brief text 要素を含む文書のタイルのレンダリングを直列化するミューテックス
+		mutable std::mutex m_textRenderMutex;
+
+		/// @brief 使用されていない、タイルのレンダリング用の文書
+		/// @remark lunasvg の Document はレイアウトやクリップ・マスクの境界矩形を描画時に計算して書き換えるため、スレッドごとに別の文書を用いる。
+		mutable Array<std::unique_ptr<lunasvg::Document>> m_renderDocuments;
+
+		/// @brief 使用された順に並べたタイル（先頭が最新）
+		mutable TileList m_tiles;
+
+		mutable HashMap<TileKey, TileList::iterator, TileKeyHash> m_tileIndex;
+
+		size_t m_tileCacheCapacity = SVG::DefaultTileCacheCapacity;
+
+		[[nodiscard]]
+		std::unique_ptr<lunasvg::Document> acquireRenderDocument() const;
+
+		void releaseRenderDocument(std::unique_ptr<lunasvg::Document>&& document) const;
+
+		[[nodiscard]]
+		std::shared_ptr<const Image> findTile(const TileKey& key) const;
+
+		void addTile(const TileKey& key, const std::shared_ptr<const Image>& tile) const;
 	};
 }
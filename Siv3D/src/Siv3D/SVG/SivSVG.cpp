@@ -202,6 +202,44 @@ namespace s3d
 			return pImpl->render(unspecified, unspecified, background, premultiplyAlpha);
 		}
 	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	renderRegion
+	//
+	////////////////////////////////////////////////////////////////
+
+	Image SVG::renderRegion(const RectF& region, const double scale, const Color& background, const PremultiplyAlpha premultiplyAlpha, const Parallelize parallelize) const
+	{
+		return pImpl->renderRegion(region, scale, background, premultiplyAlpha, parallelize);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setTileCacheCapacity, getTileCacheCapacity
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SVG::setTileCacheCapacity(const size_t capacity)
+	{
+		pImpl->setTileCacheCapacity(capacity);
+	}
+
+	size_t SVG::getTileCacheCapacity() const
+	{
+		return pImpl->getTileCacheCapacity();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clearTileCache
+	//
+	////////////////////////////////////////////////////////////////
+
+	void SVG::clearTileCache()
+	{
+		pImpl->clearTileCache();
+	}
 		
 	////////////////////////////////////////////////////////////////
 	//
@@ -10,8 +10,10 @@
 //-----------------------------------------------
 
 # include <cfloat>
+# include <bit>
 # include <Siv3D/Number.hpp>
 # include <Siv3D/Subdivision2D.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/Error.hpp>
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -107,6 +109,67 @@ namespace s3d
 			const double cwArea = ((org.x - pt.x) * diff.y - (org.y - pt.y) * diff.x);
 			return ((0 < cwArea) - (cwArea < 0));
 		}
+
+		/// @brief BRIO のラウンド数の上限
+		constexpr uint32 MaxBRIORounds = 24;
+
+		/// @brief Hilbert 曲線上の位置を計算します。
+		/// @param x X 座標 [0, 65535]
+		/// @param y Y 座標 [0, 65535]
+		/// @return Hilbert 曲線上の位置
+		[[nodiscard]]
+		static constexpr uint32 HilbertIndex(uint32 x, uint32 y) noexcept
+		{
+			constexpr uint32 N = (1u << 16);
+			uint32 d = 0;
+
+			for (uint32 s = (N / 2); 0 < s; s /= 2)
+			{
+				const uint32 rx = ((x & s) != 0);
+				const uint32 ry = ((y & s) != 0);
+
+				d += (s * s * ((3 * rx) ^ ry));
+
+				if (ry == 0)
+				{
+					if (rx == 1)
+					{
+						x = ((N - 1) - x);
+						y = ((N - 1) - y);
+					}
+
+					std::swap(x, y);
+				}
+			}
+
+			return d;
+		}
+
+		/// @brief 点のインデックスから BRIO のラウンドを決定します。
+		/// @param index 点のインデックス
+		/// @return ラウンド（0 が最後のラウンドで、全体の約半数の点が含まれる）
+		[[nodiscard]]
+		static constexpr uint32 BRIORound(const uint64 index) noexcept
+		{
+			// SplitMix64
+			uint64 z = (index + 0x9E3779B97F4A7C15ull);
+			z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull);
+			z = ((z ^ (z >> 27)) * 0x94D049BB133111EBull);
+			z = (z ^ (z >> 31));
+
+			return Min(static_cast<uint32>(std::countr_zero(z)), MaxBRIORounds);
+		}
+
+		/// @brief 点の挿入順序を決めるソートキーを計算します。
+		[[nodiscard]]
+		static uint64 InsertionKey(const Vec2& point, const size_t index, const Vec2& topLeft, const Vec2& scale) noexcept
+		{
+			const uint32 x = static_cast<uint32>(Clamp(((point.x - topLeft.x) * scale.x), 0.0, 65535.0));
+			const uint32 y = static_cast<uint32>(Clamp(((point.y - topLeft.y) * scale.y), 0.0, 65535.0));
+
+			// 点の少ないラウンドから順に挿入し、各ラウンド内では Hilbert 曲線順に挿入する
+			return ((static_cast<uint64>(MaxBRIORounds - BRIORound(index)) << 32) | HilbertIndex(x, y));
+		}
 	}
 
 	////////////////////////////////////////////////////////////////
@@ -298,6 +361,59 @@ namespace s3d
 		}
 	}
 
+	////////////////////////////////////////////////////////////////
+	//
+	//	addPointsBulk
+	//
+	////////////////////////////////////////////////////////////////
+
+	Array<Subdivision2D::VertexID> Subdivision2D::addPointsBulk(const Array<Vec2>& points, const Parallelize parallelize)
+	{
+		if (points.isEmpty())
+		{
+			return{};
+		}
+
+		const size_t num_points = points.size();
+		const Vec2 size = (m_internal.bottomRight - m_internal.topLeft);
+		const Vec2 scale{ ((0.0 < size.x) ? (65536.0 / size.x) : 0.0), ((0.0 < size.y) ? (65536.0 / size.y) : 0.0) };
+
+		Array<std::pair<uint64, uint32>> order(num_points);
+		{
+			const auto computeKeys = [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					order[i] = { InsertionKey(points[i], i, m_internal.topLeft, scale), static_cast<uint32>(i) };
+				}
+			};
+
+			if (parallelize)
+			{
+				Threading::ParallelFor(num_points, computeKeys, 16384);
+			}
+			else
+			{
+				computeKeys(0, num_points);
+			}
+
+			std::sort(order.begin(), order.end());
+		}
+
+		// 1 点の追加につき、頂点は 1 個、QuadEdge はおよそ 3 個増える
+		m_internal.vertices.reserve(m_internal.vertices.size() + num_points);
+		m_internal.qEdges.reserve(m_internal.qEdges.size() + (num_points * 3));
+
+		Array<VertexID> vertexIDs(num_points);
+
+		for (const auto& [key, index] : order)
+		{
+			vertexIDs[index] = addPoint(points[index]);
+		}
+
+		return vertexIDs;
+	}
+
 	////////////////////////////////////////////////////////////////
 	//
 	//	findNearestVertex
@@ -9,8 +9,12 @@
 //
 //-----------------------------------------------
 
+# include <typeinfo>
 # include <Siv3D/GlyphContext.hpp>
+# include <Siv3D/GlyphQuad.hpp>
 # include <Siv3D/TextEffect/BasicTextEffect.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
+# include <Siv3D/Engine/Siv3DEngine.hpp>
 
 namespace s3d
 {
@@ -22,5 +26,44 @@ namespace s3d
 
 			textureRegion.draw(glyphContext.pos, color);
 		}
+
+		void BasicTextEffect::drawBatch(const Texture& texture, std::span<const GlyphQuad> glyphQuads, std::span<const GlyphContext> glyphContexts) const
+		{
+			// draw() をオーバーライドした派生クラスはグリフごとの描画にフォールバックする
+			if (not isBatchable())
+			{
+				ITextEffect::drawBatch(texture, glyphQuads, glyphContexts);
+				return;
+			}
+
+			const size_t count = Min(glyphQuads.size(), glyphContexts.size());
+			glyphQuads = glyphQuads.first(count);
+			glyphContexts = glyphContexts.first(count);
+
+			// カラーグリフかどうかで色が変わるため、同じ種類が続く範囲ごとにまとめて描画する
+			while (not glyphQuads.empty())
+			{
+				const bool isColorGlyph = glyphContexts.front().isColorGlyph;
+				size_t runLength = 1;
+
+				while ((runLength < glyphContexts.size()) && (glyphContexts[runLength].isColorGlyph == isColorGlyph))
+				{
+					++runLength;
+				}
+
+				const ColorF color = (isColorGlyph ? ColorF{ 1.0, m_color.a } : m_color);
+
+				SIV3D_ENGINE(Renderer2D)->addGlyphQuads(texture, glyphQuads.first(runLength), color.toFloat4());
+
+				glyphQuads = glyphQuads.subspan(runLength);
+				glyphContexts = glyphContexts.subspan(runLength);
+			}
+		}
+
+		bool BasicTextEffect::isBatchable() const noexcept
+		{
+			// 派生クラスの draw() を飛ばさないよう、BasicTextEffect そのものに限る
+			return (typeid(*this) == typeid(BasicTextEffect));
+		}
 	}
 }
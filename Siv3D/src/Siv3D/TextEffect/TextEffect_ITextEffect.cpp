@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ITextEffect.hpp>
+# include <Siv3D/GlyphContext.hpp>
+# include <Siv3D/GlyphQuad.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	drawBatch
+	//
+	////////////////////////////////////////////////////////////////
+
+	void ITextEffect::drawBatch(const Texture& texture, const std::span<const GlyphQuad> glyphQuads, const std::span<const GlyphContext> glyphContexts) const
+	{
+		const size_t count = Min(glyphQuads.size(), glyphContexts.size());
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const FloatRect& rect = glyphQuads[i].rect;
+			const TextureRegion textureRegion{ texture, glyphQuads[i].uvRect, SizeF{ (rect.right - rect.left), (rect.bottom - rect.top) } };
+
+			draw(textureRegion, glyphContexts[i]);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	isBatchable
+	//
+	////////////////////////////////////////////////////////////////
+
+	bool ITextEffect::isBatchable() const noexcept
+	{
+		return false;
+	}
+}
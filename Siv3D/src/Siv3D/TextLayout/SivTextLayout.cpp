@@ -0,0 +1,486 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/TextLayout.hpp>
+# include <Siv3D/Math.hpp>
+# include <Siv3D/Indexed.hpp>
+# include <Siv3D/TextEffect/BasicTextEffect.hpp>
+# include <Siv3D/Font/IFont.hpp>
+# include <Siv3D/Font/FontUtility.hpp>
+# include <Siv3D/Font/GlyphCache/GlyphCacheCommon.hpp>
+# include <Siv3D/Engine/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	(constructor)
+	//
+	////////////////////////////////////////////////////////////////
+
+	TextLayout::TextLayout(const Font& font, const double fontSize, const double width, const TextStyle& textStyle)
+		: TextLayout{ font, fontSize, width, U"", textStyle } {}
+
+	TextLayout::TextLayout(const Font& font, const double fontSize, const double width, const StringView text, const TextStyle& textStyle)
+		: m_font{ font }
+		, m_textStyle{ textStyle }
+		, m_fontSize{ fontSize }
+		, m_width{ Max(width, 0.0) }
+		, m_lineHeight{ font.height(fontSize) * textStyle.lineSpacing }
+	{
+		setText(text);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setText
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::setText(const StringView text)
+	{
+		m_paragraphs.clear();
+
+		replaceParagraphs(0, 0, text);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	getText
+	//
+	////////////////////////////////////////////////////////////////
+
+	String TextLayout::getText() const
+	{
+		String text;
+		text.reserve(num_characters());
+
+		for (auto&& [i, paragraph] : Indexed(m_paragraphs))
+		{
+			if (i)
+			{
+				text.push_back(U'\n');
+			}
+
+			text.append(paragraph.text);
+		}
+
+		return text;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	append
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::append(const StringView text)
+	{
+		insert(num_characters(), text);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	insert
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::insert(const size_t index, const StringView text)
+	{
+		if (text.isEmpty())
+		{
+			return;
+		}
+
+		if (m_paragraphs.isEmpty())
+		{
+			setText(text);
+			return;
+		}
+
+		const auto [paragraphIndex, offset] = locate(index);
+		const String& current = m_paragraphs[paragraphIndex].text;
+
+		String newText;
+		newText.reserve(current.size() + text.size());
+		newText.append(current.data(), offset);
+		newText.append(text.data(), text.size());
+		newText.append(current.data() + offset, (current.size() - offset));
+
+		replaceParagraphs(paragraphIndex, (paragraphIndex + 1), newText);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	erase
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::erase(size_t index, const size_t count)
+	{
+		const size_t numCharacters = num_characters();
+
+		if ((count == 0) || (numCharacters <= index))
+		{
+			return;
+		}
+
+		const size_t last = (index + Min(count, (numCharacters - index)));
+
+		const auto [firstParagraph, firstOffset] = locate(index);
+		const auto [lastParagraph, lastOffset] = locate(last);
+		const String& head = m_paragraphs[firstParagraph].text;
+		const String& tail = m_paragraphs[lastParagraph].text;
+
+		String newText;
+		newText.reserve(firstOffset + (tail.size() - lastOffset));
+		newText.append(head.data(), firstOffset);
+		newText.append(tail.data() + lastOffset, (tail.size() - lastOffset));
+
+		replaceParagraphs(firstParagraph, (lastParagraph + 1), newText);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	clear
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::clear()
+	{
+		setText(U"");
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	setWidth
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::setWidth(double width)
+	{
+		width = Max(width, 0.0);
+
+		if (width == m_width)
+		{
+			return;
+		}
+
+		m_width = width;
+
+		for (auto& paragraph : m_paragraphs)
+		{
+			// 行に分配されているグリフを元の並びに戻してから改行位置を計算し直す
+			Array<ResolvedGlyph> resolvedGlyphs(Arg::reserve = paragraph.xAdvances.size());
+
+			for (const auto& line : paragraph.lines)
+			{
+				resolvedGlyphs.append(line.glyphs);
+			}
+
+			breakLines(paragraph, resolvedGlyphs);
+		}
+
+		updateOffsets(0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	width
+	//
+	////////////////////////////////////////////////////////////////
+
+	double TextLayout::width() const noexcept
+	{
+		return m_width;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	height
+	//
+	////////////////////////////////////////////////////////////////
+
+	double TextLayout::height() const noexcept
+	{
+		return (num_lines() * m_lineHeight);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	lineHeight
+	//
+	////////////////////////////////////////////////////////////////
+
+	double TextLayout::lineHeight() const noexcept
+	{
+		return m_lineHeight;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_lines
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t TextLayout::num_lines() const noexcept
+	{
+		return (m_lineOffsets ? m_lineOffsets.back() : 0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_paragraphs
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t TextLayout::num_paragraphs() const noexcept
+	{
+		return m_paragraphs.size();
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	num_characters
+	//
+	////////////////////////////////////////////////////////////////
+
+	size_t TextLayout::num_characters() const noexcept
+	{
+		return (m_paragraphs ? (m_textOffsets.back() - 1) : 0);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	region
+	//
+	////////////////////////////////////////////////////////////////
+
+	RectF TextLayout::region(const Vec2& pos) const noexcept
+	{
+		return{ pos, m_width, height() };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	draw
+	//
+	////////////////////////////////////////////////////////////////
+
+	RectF TextLayout::draw(const Vec2& pos, const ColorF& color) const
+	{
+		return draw(pos, region(pos), TextEffect::BasicTextEffect{ color });
+	}
+
+	RectF TextLayout::draw(const Vec2& pos, const RectF& viewport, const ColorF& color) const
+	{
+		return draw(pos, viewport, TextEffect::BasicTextEffect{ color });
+	}
+
+	RectF TextLayout::draw(const Vec2& pos, const ITextEffect& textEffect) const
+	{
+		return draw(pos, region(pos), textEffect);
+	}
+
+	RectF TextLayout::draw(const Vec2& pos, const RectF& viewport, const ITextEffect& textEffect) const
+	{
+		const size_t numLines = num_lines();
+
+		if ((numLines == 0) || (m_lineHeight <= 0.0))
+		{
+			return region(pos);
+		}
+
+		// 表示領域と重なる行の範囲 [firstLine, lastLine) を求める
+		const double top = (viewport.y - pos.y);
+		const double bottom = (top + viewport.h);
+
+		if ((bottom <= 0.0) || ((numLines * m_lineHeight) <= top))
+		{
+			return region(pos);
+		}
+
+		const size_t firstLine = static_cast<size_t>(Max((top / m_lineHeight), 0.0));
+		const size_t lastLine = static_cast<size_t>(Min(Math::Ceil(bottom / m_lineHeight), static_cast<double>(numLines)));
+
+		// firstLine を含む段落を二分探索で求める
+		size_t paragraphIndex = (std::distance(m_lineOffsets.begin(),
+			std::upper_bound(m_lineOffsets.begin(), (m_lineOffsets.begin() + m_paragraphs.size()), firstLine)) - 1);
+
+		const auto pFont = SIV3D_ENGINE(Font);
+		const Font::IDType fontID = m_font.id();
+		size_t lineIndex = firstLine;
+
+		while (lineIndex < lastLine)
+		{
+			const Paragraph& paragraph = m_paragraphs[paragraphIndex];
+
+			for (size_t i = (lineIndex - m_lineOffsets[paragraphIndex]); ((i < paragraph.lines.size()) && (lineIndex < lastLine)); ++i, ++lineIndex)
+			{
+				if (const LineLayout& line = paragraph.lines[i];
+					line.glyphs)
+				{
+					// 改行位置の計算時に求めたグリフの位置をそのまま使う
+					pFont->drawGlyphsAt(fontID, paragraph.text, line.glyphs, line.xOffsets, pos.movedBy(0, (lineIndex * m_lineHeight)), m_fontSize, m_textStyle, textEffect);
+				}
+			}
+
+			++paragraphIndex;
+		}
+
+		return region(pos);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	makeParagraph
+	//
+	////////////////////////////////////////////////////////////////
+
+	TextLayout::Paragraph TextLayout::makeParagraph(const StringView text) const
+	{
+		Paragraph paragraph{ .text = String{ text } };
+
+		const auto pFont = SIV3D_ENGINE(Font);
+		const Font::IDType fontID = m_font.id();
+
+		const Array<ResolvedGlyph> resolvedGlyphs = pFont->getResolvedGlyphs(fontID, paragraph.text, ReadingDirection::LeftToRight, EnableFontFallback::Yes, EnableLigatures::Yes);
+		paragraph.xAdvances = pFont->getXAdvances(fontID, paragraph.text, resolvedGlyphs, m_fontSize);
+
+		breakLines(paragraph, resolvedGlyphs);
+
+		return paragraph;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	breakLines
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::breakLines(Paragraph& paragraph, const Array<ResolvedGlyph>& resolvedGlyphs) const
+	{
+		const auto& info = SIV3D_ENGINE(Font)->getInfo(m_font.id());
+		const double scale = (m_fontSize / info.baseSize);
+
+		paragraph.lines.clear();
+
+		LineLayout line;
+		double penX = 0.0;
+
+		for (auto&& [index, resolvedGlyph] : Indexed(resolvedGlyphs))
+		{
+			const char32 ch = paragraph.text[resolvedGlyph.pos];
+			double advance = 0.0;
+
+			if (ch == U'\t')
+			{
+				advance = GetTabAdvance(info.spaceXAdvance, scale, 0.0, penX, info.tabSize);
+			}
+			else if (not IsControl(ch))
+			{
+				advance = Max((paragraph.xAdvances.fetch(index, 0.0) + m_textStyle.characterSpacing), 0.0);
+			}
+
+			// 1 行に少なくとも 1 グリフは置く
+			if (line.glyphs && (m_width < (penX + advance)))
+			{
+				paragraph.lines.push_back(std::exchange(line, {}));
+				penX = 0.0;
+
+				if (ch == U'\t')
+				{
+					advance = GetTabAdvance(info.spaceXAdvance, scale, 0.0, penX, info.tabSize);
+				}
+			}
+
+			line.glyphs.push_back(resolvedGlyph);
+			line.xOffsets.push_back(penX);
+			penX += advance;
+		}
+
+		paragraph.lines.push_back(std::move(line));
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	replaceParagraphs
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::replaceParagraphs(const size_t first, const size_t last, const StringView text)
+	{
+		Array<Paragraph> paragraphs;
+
+		for (size_t begin = 0;;)
+		{
+			const size_t end = text.find(U'\n', begin);
+
+			if (end == StringView::npos)
+			{
+				paragraphs.push_back(makeParagraph(text.substr(begin)));
+				break;
+			}
+
+			paragraphs.push_back(makeParagraph(text.substr(begin, (end - begin))));
+			begin = (end + 1);
+		}
+
+		const auto it = m_paragraphs.erase((m_paragraphs.begin() + first), (m_paragraphs.begin() + last));
+		m_paragraphs.insert(it, std::make_move_iterator(paragraphs.begin()), std::make_move_iterator(paragraphs.end()));
+
+		updateOffsets(first);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	locate
+	//
+	////////////////////////////////////////////////////////////////
+
+	std::pair<size_t, size_t> TextLayout::locate(size_t index) const noexcept
+	{
+		index = Min(index, num_characters());
+
+		const size_t paragraphIndex = (std::distance(m_textOffsets.begin(),
+			std::upper_bound(m_textOffsets.begin(), (m_textOffsets.begin() + m_paragraphs.size()), index)) - 1);
+
+		return{ paragraphIndex, (index - m_textOffsets[paragraphIndex]) };
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	updateOffsets
+	//
+	////////////////////////////////////////////////////////////////
+
+	void TextLayout::updateOffsets(const size_t first)
+	{
+		// first より前の段落は変更されていないので、first の位置のオフセットはそのまま使える
+		size_t lineOffset = (first ? m_lineOffsets[first] : 0);
+		size_t textOffset = (first ? m_textOffsets[first] : 0);
+
+		m_lineOffsets.resize(m_paragraphs.size() + 1);
+		m_textOffsets.resize(m_paragraphs.size() + 1);
+
+		for (size_t i = first; i < m_paragraphs.size(); ++i)
+		{
+			m_lineOffsets[i] = lineOffset;
+			m_textOffsets[i] = textOffset;
+
+			lineOffset += m_paragraphs[i].lines.size();
+			textOffset += (m_paragraphs[i].text.size() + 1);
+		}
+
+		m_lineOffsets.back() = lineOffset;
+		m_textOffsets.back() = textOffset;
+	}
+}
@@ -10,7 +10,9 @@
 //-----------------------------------------------
 
 # include <thread>
+# include <future>
 # include <Siv3D/Threading.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/Utility.hpp>
 
 namespace s3d
@@ -28,5 +30,60 @@ namespace s3d
 			static const size_t n = Max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	ParallelFor
+		//
+		////////////////////////////////////////////////////////////////
+
+		void ParallelFor(const size_t count, const FunctionRef<void(size_t, size_t)> f, const size_t minChunkSize)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			const size_t numThreads = Min(GetConcurrency(), Max<size_t>(1, (count / Max<size_t>(1, minChunkSize))));
+
+			if (numThreads <= 1)
+			{
+				f(0, count);
+				return;
+			}
+
+			const size_t countPerThread = ((count + (numThreads - 1)) / numThreads);
+
+			Array<std::future<void>> tasks;
+
+			size_t begin = 0;
+
+			for (size_t i = 0; i < (numThreads - 1); ++i)
+			{
+				const size_t n = Min(countPerThread, (count - begin));
+
+				if (n == 0)
+				{
+					break;
+				}
+
+				tasks.emplace_back(std::async(std::launch::async, [=]()
+				{
+					f(begin, (begin + n));
+				}));
+
+				begin += n;
+			}
+
+			if (begin < count)
+			{
+				f(begin, count);
+			}
+
+			for (auto& task : tasks)
+			{
+				task.get();
+			}
+		}
 	}
 }
@@ -209,6 +209,23 @@ namespace s3d
 
 			return result;
 		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	AppendUTF8
+		//
+		////////////////////////////////////////////////////////////////
+
+		void AppendUTF8(std::string& dst, const StringView s)
+		{
+			const size_t offset = dst.size();
+			const size_t requiredLength = simdutf::utf8_length_from_utf32(s.data(), s.size());
+
+			dst.resize_and_overwrite((offset + requiredLength), [&](char* buf, size_t)
+				{
+					return (offset + simdutf::convert_utf32_to_utf8(s.data(), s.size(), (buf + offset)));
+				});
+		}
 			
 		////////////////////////////////////////////////////////////////
 		//
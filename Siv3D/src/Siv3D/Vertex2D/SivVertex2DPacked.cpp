@@ -0,0 +1,77 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <Siv3D/Vertex2DPacked.hpp>
+# include <Siv3D/SIMD.hpp>
+
+namespace s3d
+{
+	namespace
+	{
+	# if SIV3D_INTRINSIC(SSE)
+
+		/// @brief Float4 の色を 8-bit UNORM に変換します。結果は Color::ToUint8() と一致します。
+		[[nodiscard]]
+		static Color PackColor(const Float4& color) noexcept
+		{
+			const __m128 c = ::_mm_load_ps(&color.x);
+			const __m128 clamped = ::_mm_min_ps(::_mm_max_ps(c, ::_mm_setzero_ps()), ::_mm_set1_ps(1.0f));
+			const __m128i i32 = ::_mm_cvttps_epi32(::_mm_add_ps(::_mm_mul_ps(clamped, ::_mm_set1_ps(255.0f)), ::_mm_set1_ps(0.5f)));
+			const __m128i i16 = ::_mm_packs_epi32(i32, i32);
+			const __m128i u8 = ::_mm_packus_epi16(i16, i16);
+
+			const int32 bits = ::_mm_cvtsi128_si32(u8);
+			Color result;
+			std::memcpy(&result, &bits, sizeof(Color));
+			return result;
+		}
+
+	# else
+
+		[[nodiscard]]
+		static constexpr Color PackColor(const Float4& color) noexcept
+		{
+			return{ Color::ToUint8(color.x), Color::ToUint8(color.y), Color::ToUint8(color.z), Color::ToUint8(color.w) };
+		}
+
+	# endif
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	PackVertex2D
+	//
+	////////////////////////////////////////////////////////////////
+
+	void PackVertex2D(const std::span<const Vertex2D> src, Vertex2DPacked* dst) noexcept
+	{
+		for (const auto& vertex : src)
+		{
+			dst->pos	= vertex.pos;
+			dst->tex	= vertex.tex;
+			dst->color	= PackColor(vertex.color);
+			++dst;
+		}
+	}
+
+	void PackVertex2D(const std::span<const Vertex2D> src, Vertex2DPackedHalf* dst) noexcept
+	{
+		for (const auto& vertex : src)
+		{
+			dst->pos	= vertex.pos;
+			dst->tex[0]	= HalfFloat{ vertex.tex.x };
+			dst->tex[1]	= HalfFloat{ vertex.tex.y };
+			dst->color	= PackColor(vertex.color);
+			++dst;
+		}
+	}
+}
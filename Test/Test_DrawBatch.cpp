@@ -0,0 +1,244 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+# include "../Siv3D/src/Siv3D/Renderer2D/Vertex2DBuilder.hpp"
+
+// 1 回の描画コマンドで生成された頂点とインデックス
+struct CapturedDraw
+{
+	Array<Vertex2D> vertices;
+
+	Array<Vertex2D::IndexType> indices;
+};
+
+// 描画コマンドごとに新しいバッファを割り当て、submitDraw までに書き込まれた内容を記録する
+static Array<CapturedDraw> CaptureDraws(FunctionRef<void(const BufferCreatorFunc&, const DrawSubmitterFunc&)> build)
+{
+	Array<CapturedDraw> draws;
+	CapturedDraw current;
+
+	const auto bufferCreator = [&](const Vertex2D::IndexType vertexCount, const Vertex2D::IndexType indexCount)
+		{
+			const size_t vertexOffset = current.vertices.size();
+			const size_t indexOffset = current.indices.size();
+			current.vertices.resize(vertexOffset + vertexCount);
+			current.indices.resize(indexOffset + indexCount);
+			return Vertex2DBufferPointer{ (current.vertices.data() + vertexOffset), (current.indices.data() + indexOffset), static_cast<Vertex2D::IndexType>(vertexOffset) };
+		};
+
+	const auto submitDraw = [&](const Vertex2D::IndexType indexCount)
+		{
+			CHECK_EQ(indexCount, current.indices.size());
+			draws << std::move(current);
+			current = {};
+		};
+
+	build(bufferCreator, submitDraw);
+
+	return draws;
+}
+
+[[nodiscard]]
+static bool NearlyEqual(const Vertex2D& a, const Vertex2D& b)
+{
+	return ((Abs(a.pos.x - b.pos.x) <= 0.001f)
+		&& (Abs(a.pos.y - b.pos.y) <= 0.001f)
+		&& (a.color == b.color));
+}
+
+// 図形ごとの描画 (unbatched) の結果を連結したものと、まとめて描画した結果が一致するかを調べる
+static void CheckSameAsUnbatched(const Array<CapturedDraw>& batched, const Array<CapturedDraw>& unbatched)
+{
+	size_t shapeIndex = 0;
+
+	for (const auto& draw : batched)
+	{
+		CHECK(draw.vertices.size() <= Vertex2D::MaxBatchVertexCount);
+		CHECK(draw.indices.size() <= Vertex2D::MaxBatchIndexCount);
+		CHECK(draw.indices.all([&](const Vertex2D::IndexType index) { return (index < draw.vertices.size()); }));
+
+		size_t vertexBase = 0;
+		size_t indexBase = 0;
+		bool matched = true;
+
+		while ((vertexBase < draw.vertices.size()) && (shapeIndex < unbatched.size()))
+		{
+			const CapturedDraw& shape = unbatched[shapeIndex++];
+
+			if ((draw.vertices.size() < (vertexBase + shape.vertices.size()))
+				|| (draw.indices.size() < (indexBase + shape.indices.size())))
+			{
+				matched = false;
+				break;
+			}
+
+			for (size_t i = 0; i < shape.vertices.size(); ++i)
+			{
+				matched &= NearlyEqual(draw.vertices[vertexBase + i], shape.vertices[i]);
+			}
+
+			for (size_t i = 0; i < shape.indices.size(); ++i)
+			{
+				matched &= (draw.indices[indexBase + i] == (shape.indices[i] + vertexBase));
+			}
+
+			vertexBase += shape.vertices.size();
+			indexBase += shape.indices.size();
+		}
+
+		CHECK(matched);
+		CHECK_EQ(vertexBase, draw.vertices.size());
+		CHECK_EQ(indexBase, draw.indices.size());
+	}
+
+	CHECK_EQ(shapeIndex, unbatched.size());
+}
+
+TEST_CASE("DrawBatch")
+{
+	SUBCASE("Chunk size")
+	{
+		CHECK(Vertex2D::MaxBatchIndexCount <= std::numeric_limits<Vertex2D::IndexType>::max());
+		CHECK((Vertex2DBuilder::MaxBatchRectCount * 4) <= Vertex2D::MaxBatchVertexCount);
+		CHECK((Vertex2DBuilder::MaxBatchRectCount * 6) <= Vertex2D::MaxBatchIndexCount);
+		CHECK((Vertex2D::MaxBatchVertexCount < ((Vertex2DBuilder::MaxBatchRectCount + 1) * 4))
+			|| (Vertex2D::MaxBatchIndexCount < ((Vertex2DBuilder::MaxBatchRectCount + 1) * 6)));
+	}
+
+	SUBCASE("Rects")
+	{
+		// 2 回目の描画がちょうど満杯になり、3 回目に端数が残る個数
+		const size_t rectCount = (Vertex2DBuilder::MaxBatchRectCount * 2 + 3);
+		Array<RectF> rects(rectCount);
+		Array<ColorF> colors(rectCount);
+
+		for (size_t i = 0; i < rectCount; ++i)
+		{
+			rects[i].set((i % 1000) * 1.25, (i / 1000) * 0.75, (1.0 + (i % 7)), (2.0 + (i % 5)));
+			colors[i] = ColorF{ ((i % 11) / 10.0), ((i % 13) / 12.0), ((i % 17) / 16.0), 1.0 };
+		}
+
+		const Float4 color{ 0.25f, 0.5f, 0.75f, 1.0f };
+
+		{
+			const Array<CapturedDraw> batched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					Vertex2DBuilder::BuildRectBatches(bufferCreator, rects, color, submitDraw);
+				});
+
+			const Array<CapturedDraw> unbatched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					for (const auto& rect : rects)
+					{
+						submitDraw(Vertex2DBuilder::BuildRect(bufferCreator, FloatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) }, color));
+					}
+				});
+
+			REQUIRE_EQ(batched.size(), 3);
+			CHECK_EQ(batched[0].vertices.size(), (Vertex2DBuilder::MaxBatchRectCount * 4));
+			CHECK_EQ(batched[1].vertices.size(), (Vertex2DBuilder::MaxBatchRectCount * 4));
+			CHECK_EQ(batched[2].vertices.size(), (3 * 4));
+			CheckSameAsUnbatched(batched, unbatched);
+		}
+
+		{
+			const Array<CapturedDraw> batched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					Vertex2DBuilder::BuildRectBatches(bufferCreator, rects, colors, submitDraw);
+				});
+
+			const Array<CapturedDraw> unbatched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					for (size_t i = 0; i < rectCount; ++i)
+					{
+						const RectF& rect = rects[i];
+						submitDraw(Vertex2DBuilder::BuildRect(bufferCreator, FloatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) }, colors[i].toFloat4()));
+					}
+				});
+
+			REQUIRE_EQ(batched.size(), 3);
+			CheckSameAsUnbatched(batched, unbatched);
+		}
+	}
+
+	SUBCASE("Circles")
+	{
+		constexpr size_t CircleCount = 20'000;
+		constexpr float Scale = 1.5f;
+		Array<Circle> circles(CircleCount);
+		Array<ColorF> colors(CircleCount);
+
+		for (size_t i = 0; i < CircleCount; ++i)
+		{
+			circles[i].set((i % 200) * 4.0, (i / 200) * 4.0, (0.5 + (i % 40)));
+			colors[i] = ColorF{ ((i % 11) / 10.0), ((i % 13) / 12.0), ((i % 17) / 16.0), 1.0 };
+		}
+
+		const Float4 color{ 0.25f, 0.5f, 0.75f, 1.0f };
+
+		{
+			const Array<CapturedDraw> batched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					Vertex2DBuilder::BuildCircleBatches(bufferCreator, circles, color, Scale, submitDraw);
+				});
+
+			const Array<CapturedDraw> unbatched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					for (const auto& circle : circles)
+					{
+						submitDraw(Vertex2DBuilder::BuildCircle(bufferCreator, circle.center, static_cast<float>(circle.r), ColorFillDirection::InOut, color, color, Scale));
+					}
+				});
+
+			size_t totalIndexCount = 0;
+
+			for (const auto& draw : unbatched)
+			{
+				totalIndexCount += draw.indices.size();
+			}
+
+			CHECK(Vertex2D::MaxBatchIndexCount < totalIndexCount);
+			CHECK(2 <= batched.size());
+			CheckSameAsUnbatched(batched, unbatched);
+		}
+
+		{
+			const Array<CapturedDraw> batched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					Vertex2DBuilder::BuildCircleBatches(bufferCreator, circles, colors, Scale, submitDraw);
+				});
+
+			const Array<CapturedDraw> unbatched = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+				{
+					for (size_t i = 0; i < CircleCount; ++i)
+					{
+						const Float4 circleColor = colors[i].toFloat4();
+						submitDraw(Vertex2DBuilder::BuildCircle(bufferCreator, circles[i].center, static_cast<float>(circles[i].r), ColorFillDirection::InOut, circleColor, circleColor, Scale));
+					}
+				});
+
+			CHECK(2 <= batched.size());
+			CheckSameAsUnbatched(batched, unbatched);
+		}
+	}
+
+	SUBCASE("Empty")
+	{
+		const Array<CapturedDraw> draws = CaptureDraws([&](const BufferCreatorFunc& bufferCreator, const DrawSubmitterFunc& submitDraw)
+			{
+				Vertex2DBuilder::BuildRectBatches(bufferCreator, std::span<const RectF>{}, Float4{ 1.0f, 1.0f, 1.0f, 1.0f }, submitDraw);
+				Vertex2DBuilder::BuildCircleBatches(bufferCreator, std::span<const Circle>{}, Float4{ 1.0f, 1.0f, 1.0f, 1.0f }, 1.0f, submitDraw);
+			});
+
+		CHECK(draws.isEmpty());
+	}
+}
@@ -0,0 +1,98 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+# include "../Siv3D/src/Siv3D/EngineResource/EngineResourceCache.hpp"
+
+TEST_CASE("EngineResourceCache")
+{
+	using EngineResourceCache::ValidationResult;
+
+	const FilePath directory{ U"../../Test/output/engineresourcecache/" };
+	FileSystem::CreateDirectories(directory);
+
+	const std::string text = "Siv3D engine resource cache test";
+	const Blob content{ text.data(), text.size() };
+	constexpr uint64 SourceSize = 1234;
+
+	SUBCASE("Miss")
+	{
+		CHECK_EQ(EngineResourceCache::Validate((directory + U"missing.bin"), SourceSize), ValidationResult::Invalid);
+	}
+
+	SUBCASE("Hit")
+	{
+		const FilePath path = (directory + U"hit.bin");
+		REQUIRE(EngineResourceCache::Store(path, content, SourceSize));
+
+		CHECK(FileSystem::Exists(EngineResourceCache::GetInfoPath(path)));
+		CHECK_EQ(EngineResourceCache::Validate(path, SourceSize), ValidationResult::Unchanged);
+
+		// リソースが存在しない場合はサイズを比較しない
+		CHECK_EQ(EngineResourceCache::Validate(path, 0), ValidationResult::Unchanged);
+	}
+
+	SUBCASE("Commit")
+	{
+		// 一時ファイルに書き込んだ内容を、キャッシュとして置き換える
+		const FilePath path = (directory + U"commit.bin");
+		REQUIRE(content.save(EngineResourceCache::GetTemporaryPath(path)));
+		REQUIRE(EngineResourceCache::Commit(path, SourceSize));
+
+		CHECK_FALSE(FileSystem::Exists(EngineResourceCache::GetTemporaryPath(path)));
+		CHECK_EQ(Blob{ path }.size(), content.size());
+		CHECK_EQ(EngineResourceCache::Validate(path, SourceSize), ValidationResult::Unchanged);
+
+		// 一時ファイルが無い
+		CHECK_FALSE(EngineResourceCache::Commit((directory + U"uncommitted.bin"), SourceSize));
+		CHECK_EQ(EngineResourceCache::Validate((directory + U"uncommitted.bin"), SourceSize), ValidationResult::Invalid);
+	}
+
+	SUBCASE("Invalidation")
+	{
+		const FilePath path = (directory + U"invalid.bin");
+		REQUIRE(EngineResourceCache::Store(path, content, SourceSize));
+
+		// リソースが更新された
+		CHECK_EQ(EngineResourceCache::Validate(path, (SourceSize + 1)), ValidationResult::Invalid);
+
+		// キャッシュが途中までしか書き込まれていない
+		REQUIRE(Blob{ text.data(), (text.size() / 2) }.save(path));
+		CHECK_EQ(EngineResourceCache::Validate(path, SourceSize), ValidationResult::Invalid);
+
+		// 検証情報が無い
+		REQUIRE(EngineResourceCache::Store(path, content, SourceSize));
+		FileSystem::Remove(EngineResourceCache::GetInfoPath(path));
+		CHECK_EQ(EngineResourceCache::Validate(path, SourceSize), ValidationResult::Invalid);
+	}
+
+	SUBCASE("Modified")
+	{
+		const FilePath touchedPath = (directory + U"touched.bin");
+		const FilePath corruptedPath = (directory + U"corrupted.bin");
+		REQUIRE(EngineResourceCache::Store(touchedPath, content, SourceSize));
+		REQUIRE(EngineResourceCache::Store(corruptedPath, content, SourceSize));
+
+		// 更新日時の分解能が粗いファイルシステムでも変化が分かるよう待つ
+		System::Sleep(2100);
+
+		// 内容が同じ: ハッシュ値で検証され、次回からは更新日時だけで判定される
+		REQUIRE(content.save(touchedPath));
+		CHECK_EQ(EngineResourceCache::Validate(touchedPath, SourceSize), ValidationResult::Verified);
+		CHECK_EQ(EngineResourceCache::Validate(touchedPath, SourceSize), ValidationResult::Unchanged);
+
+		// サイズが同じで内容が異なる
+		std::string corrupted = text;
+		corrupted[0] = 'X';
+		REQUIRE(Blob{ corrupted.data(), corrupted.size() }.save(corruptedPath));
+		CHECK_EQ(EngineResourceCache::Validate(corruptedPath, SourceSize), ValidationResult::Invalid);
+	}
+}
@@ -0,0 +1,132 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+# include "../Siv3D/src/Siv3D/DirectoryWatcher/FileChangeCoalescer.hpp"
+
+// 取り出した変更が、期待するパスと操作の並びと一致するかを調べる
+static void CheckChanges(const Array<FileChange>& changes, const Array<FileChange>& expected)
+{
+	REQUIRE_EQ(changes.size(), expected.size());
+
+	for (size_t i = 0; i < changes.size(); ++i)
+	{
+		CHECK_EQ(changes[i].path, expected[i].path);
+		CHECK(changes[i].action == expected[i].action);
+	}
+}
+
+TEST_CASE("FileChangeCoalescer")
+{
+	// まとめる時間 [マイクロ秒]
+	constexpr int64 DebounceTimeUs = 100'000;
+
+	Array<FileChange> changes;
+
+	SUBCASE("No debounce")
+	{
+		FileChangeCoalescer coalescer;
+		coalescer.add(U"a.txt", FileAction::Added, 0);
+		coalescer.add(U"a.txt", FileAction::Modified, 0);
+		coalescer.add(U"a.txt", FileAction::Removed, 0);
+
+		// まとめずに、通知された順にすぐ取り出せる
+		coalescer.extract(changes, 0);
+		CheckChanges(changes, { { U"a.txt", FileAction::Added }, { U"a.txt", FileAction::Modified }, { U"a.txt", FileAction::Removed } });
+
+		coalescer.extract(changes, 0);
+		CHECK(changes.isEmpty());
+	}
+
+	SUBCASE("Debounce")
+	{
+		FileChangeCoalescer coalescer;
+		coalescer.setDebounceTime(SecondsF{ 0.1 });
+
+		coalescer.add(U"a.txt", FileAction::Modified, 0);
+		coalescer.add(U"a.txt", FileAction::Modified, 50'000);
+
+		// 最後の変更からまとめる時間が経過するまでは取り出せない
+		coalescer.extract(changes, 100'000);
+		CHECK(changes.isEmpty());
+
+		coalescer.extract(changes, (50'000 + DebounceTimeUs));
+		CheckChanges(changes, { { U"a.txt", FileAction::Modified } });
+
+		coalescer.extract(changes, 1'000'000);
+		CHECK(changes.isEmpty());
+	}
+
+	SUBCASE("Merge")
+	{
+		FileChangeCoalescer coalescer;
+		coalescer.setDebounceTime(SecondsF{ 0.1 });
+
+		// 追加されてすぐに削除されたファイルは通知しない
+		coalescer.add(U"added_removed.txt", FileAction::Added, 0);
+		coalescer.add(U"added_removed.txt", FileAction::Modified, 0);
+		coalescer.add(U"added_removed.txt", FileAction::Removed, 0);
+
+		// 追加後の更新は追加として通知する
+		coalescer.add(U"added_modified.txt", FileAction::Added, 0);
+		coalescer.add(U"added_modified.txt", FileAction::Modified, 0);
+
+		// 削除されて作り直されたファイルは更新として通知する
+		coalescer.add(U"removed_added.txt", FileAction::Removed, 0);
+		coalescer.add(U"removed_added.txt", FileAction::Added, 0);
+
+		// 更新後の削除は削除として通知する
+		coalescer.add(U"modified_removed.txt", FileAction::Modified, 0);
+		coalescer.add(U"modified_removed.txt", FileAction::Removed, 0);
+
+		coalescer.extract(changes, DebounceTimeUs);
+		CheckChanges(changes, {
+			{ U"added_modified.txt", FileAction::Added },
+			{ U"removed_added.txt", FileAction::Modified },
+			{ U"modified_removed.txt", FileAction::Removed } });
+	}
+
+	SUBCASE("Order")
+	{
+		FileChangeCoalescer coalescer;
+		coalescer.setDebounceTime(SecondsF{ 0.1 });
+
+		coalescer.add(U"c.txt", FileAction::Added, 0);
+		coalescer.add(U"a.txt", FileAction::Added, 10'000);
+		coalescer.add(U"b.txt", FileAction::Added, 20'000);
+		coalescer.add(U"c.txt", FileAction::Modified, 80'000);
+
+		// まとめる時間が経過したものだけを取り出す
+		coalescer.extract(changes, (20'000 + DebounceTimeUs));
+		CheckChanges(changes, { { U"a.txt", FileAction::Added }, { U"b.txt", FileAction::Added } });
+
+		// 最初に通知された順番を保つ
+		coalescer.add(U"a.txt", FileAction::Modified, 150'000);
+		coalescer.extract(changes, (150'000 + DebounceTimeUs));
+		CheckChanges(changes, { { U"c.txt", FileAction::Added }, { U"a.txt", FileAction::Modified } });
+	}
+
+	SUBCASE("Clear")
+	{
+		FileChangeCoalescer coalescer;
+		coalescer.setDebounceTime(SecondsF{ 0.1 });
+
+		coalescer.add(U"a.txt", FileAction::Added, 0);
+		coalescer.add(U"b.txt", FileAction::Added, 0);
+		coalescer.extract(changes, DebounceTimeUs);
+		CHECK_EQ(changes.size(), 2);
+
+		coalescer.add(U"c.txt", FileAction::Added, 200'000);
+		coalescer.clear();
+		coalescer.extract(changes, 1'000'000);
+		CHECK(changes.isEmpty());
+	}
+}
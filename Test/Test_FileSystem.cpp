@@ -264,6 +264,51 @@ TEST_CASE("FileSystem::ChangeCurrentDirectory")
 	CHECK_EQ(FileSystem::CurrentDirectory(), currentDirectory);
 }
 
+TEST_CASE("DirectoryWalker")
+{
+	const FilePath directory = FileSystem::FullPath(U"example/");
+
+	const Array<DirectoryEntry> entries = DirectoryWalker{ U"example/" }.readAll();
+	CHECK(entries);
+
+	for (const auto& entry : entries)
+	{
+		CHECK(entry.path.starts_with(directory));
+		CHECK_EQ(entry.isDirectory(), FileSystem::IsDirectory(entry.path));
+		CHECK_EQ(entry.isDirectory(), entry.path.ends_with(U'/'));
+
+		if (entry.isFile())
+		{
+			CHECK_EQ(entry.size, FileSystem::FileSize(entry.path));
+		}
+	}
+
+	// パスの重複がないこと
+	CHECK_EQ(entries.map([](const DirectoryEntry& entry) { return entry.path; }).sorted().uniqued_consecutive().size(), entries.size());
+
+	// 非再帰
+	{
+		DirectoryWalker walker{ U"example/", { .recursive = Recursive::No } };
+		CHECK_EQ(walker.directory(), directory);
+
+		for (const auto& entry : walker)
+		{
+			const String name = entry.path.substr(directory.size());
+			CHECK_FALSE(String{ name.begin(), (name.end() - (entry.isDirectory() ? 1 : 0)) }.contains(U'/'));
+		}
+	}
+
+	// フィルタ
+	{
+		const DirectoryWalkerOptions options{ .filter = [](const DirectoryEntry& entry) { return (entry.isFile() && (FileSystem::Extension(entry.path) == U"png")); } };
+		const isize expected = entries.count_if([](const DirectoryEntry& entry) { return (entry.isFile() && (FileSystem::Extension(entry.path) == U"png")); });
+		CHECK_EQ(static_cast<isize>(DirectoryWalker{ U"example/", options }.readAll().size()), expected);
+	}
+
+	CHECK_FALSE(DirectoryWalker{ U"example/windmill.png" });
+	CHECK_FALSE(DirectoryWalker{ U"nonexistent/" }.readAll());
+}
+
 TEST_CASE("FileSystem Misc")
 {
 	Console << U"FileSystem";
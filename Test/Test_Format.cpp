@@ -0,0 +1,104 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Format.FormatTo")
+{
+	String s = U"x = ";
+	FormatTo(s, 12, U", y = ", 3.5, U'!');
+	CHECK_EQ(s, U"x = 12, y = 3.5!");
+	CHECK_EQ(s, (U"x = " + Format(12, U", y = ", 3.5, U'!')));
+
+	s.clear();
+	const size_t capacity = s.capacity();
+	FormatTo(s, U"abc");
+	CHECK_EQ(s, U"abc");
+	CHECK(s.capacity() == capacity);
+}
+
+TEST_CASE("Format.FormatUTF8To")
+{
+	std::string s = "x = ";
+	FormatUTF8To(s, 12, U", あ");
+	CHECK_EQ(s, "x = 12, \xE3\x81\x82");
+
+	s.clear();
+	FormatUTF8To(s, Array{ 1, 2, 3 }, 4.5);
+	CHECK_EQ(s, Unicode::ToUTF8(Format(Array{ 1, 2, 3 }, 4.5)));
+
+	// 作業用バッファに収まらない長い文字列
+	const String longText(10000, U'a');
+	std::string u;
+	FormatUTF8To(u, longText, 1);
+	CHECK(u.size() == 10001);
+}
+
+TEST_CASE("Format.InlineFormat")
+{
+	{
+		const InlineFormat<16> s{ U"FPS: ", 60 };
+		CHECK(s.isInline());
+		CHECK_EQ(s.view(), U"FPS: 60");
+		CHECK_EQ(s.data()[s.size()], U'\0');
+		CHECK_EQ(s.str(), Format(U"FPS: ", 60));
+
+		const InlineFormat<16> copy = s;
+		CHECK_EQ(copy.view(), U"FPS: 60");
+		CHECK_EQ(Format(U"[", s, U"]"), U"[FPS: 60]");
+	}
+
+	{
+		const InlineFormat<4> s{ U"Hello, ", U"Siv3D!" };
+		CHECK_FALSE(s.isInline());
+		CHECK_EQ(s.view(), U"Hello, Siv3D!");
+		CHECK_EQ(s.data()[s.size()], U'\0');
+	}
+
+	{
+		const InlineFormat<4> s;
+		CHECK(s.isEmpty());
+		CHECK(s.isInline());
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("Format.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+	const int32 score = 123456;
+	const double time = 12.345;
+	const Vec2 pos{ 640.5, 360.25 };
+
+	String buffer;
+	std::string utf8Buffer;
+
+	Bench{}.title("Format int32").relative(true).run("Format", [&]() { doNotOptimizeAway(Format(U"Score: ", score)); });
+	Bench{}.title("Format int32").relative(true).run("FormatTo", [&]() { buffer.clear(); FormatTo(buffer, U"Score: ", score); doNotOptimizeAway(buffer); });
+	Bench{}.title("Format int32").relative(true).run("InlineFormat<32>", [&]() { doNotOptimizeAway(InlineFormat<32>{ U"Score: ", score }); });
+	Bench{}.title("Format int32").relative(true).run("Unicode::ToUTF8(Format)", [&]() { doNotOptimizeAway(Unicode::ToUTF8(Format(U"Score: ", score))); });
+	Bench{}.title("Format int32").relative(true).run("FormatUTF8To", [&]() { utf8Buffer.clear(); FormatUTF8To(utf8Buffer, U"Score: ", score); doNotOptimizeAway(utf8Buffer); });
+
+	Bench{}.title("Format double").relative(true).run("Format", [&]() { doNotOptimizeAway(Format(U"Time: ", time)); });
+	Bench{}.title("Format double").relative(true).run("FormatTo", [&]() { buffer.clear(); FormatTo(buffer, U"Time: ", time); doNotOptimizeAway(buffer); });
+	Bench{}.title("Format double").relative(true).run("InlineFormat<32>", [&]() { doNotOptimizeAway(InlineFormat<32>{ U"Time: ", time }); });
+	Bench{}.title("Format double").relative(true).run("Unicode::ToUTF8(Format)", [&]() { doNotOptimizeAway(Unicode::ToUTF8(Format(U"Time: ", time))); });
+	Bench{}.title("Format double").relative(true).run("FormatUTF8To", [&]() { utf8Buffer.clear(); FormatUTF8To(utf8Buffer, U"Time: ", time); doNotOptimizeAway(utf8Buffer); });
+
+	Bench{}.title("Format Vec2").relative(true).run("Format", [&]() { doNotOptimizeAway(Format(U"Pos: ", pos)); });
+	Bench{}.title("Format Vec2").relative(true).run("FormatTo", [&]() { buffer.clear(); FormatTo(buffer, U"Pos: ", pos); doNotOptimizeAway(buffer); });
+	Bench{}.title("Format Vec2").relative(true).run("InlineFormat<32>", [&]() { doNotOptimizeAway(InlineFormat<32>{ U"Pos: ", pos }); });
+	Bench{}.title("Format Vec2").relative(true).run("Unicode::ToUTF8(Format)", [&]() { doNotOptimizeAway(Unicode::ToUTF8(Format(U"Pos: ", pos))); });
+	Bench{}.title("Format Vec2").relative(true).run("FormatUTF8To", [&]() { utf8Buffer.clear(); FormatUTF8To(utf8Buffer, U"Pos: ", pos); doNotOptimizeAway(utf8Buffer); });
+}
+
+# endif
@@ -63,6 +63,333 @@ TEST_CASE("Image.bgraToRGBA")
 	CHECK_EQ(image1, image2);
 }
 
+TEST_CASE("ImageDecodeOptions.getScaledSize")
+{
+	CHECK_EQ(ImageDecodeOptions{}.getScaledSize(Size{ 101, 50 }), Size{ 101, 50 });
+	CHECK_EQ(ImageDecodeOptions{ .scaleDenominator = 2 }.getScaledSize(Size{ 101, 50 }), Size{ 51, 25 });
+	CHECK_EQ(ImageDecodeOptions{ .scaleDenominator = 3 }.getScaledSize(Size{ 101, 50 }), Size{ 26, 13 });
+	CHECK_EQ(ImageDecodeOptions{ .scaleDenominator = 8 }.getScaledSize(Size{ 101, 50 }), Size{ 13, 7 });
+	CHECK_EQ(ImageDecodeOptions{ .scaleDenominator = 100 }.getScaledSize(Size{ 101, 50 }), Size{ 13, 7 });
+}
+
+TEST_CASE("ImageDecodeOptions.getOutputSize")
+{
+	const Size imageSize{ 1600, 900 };
+
+	CHECK(ImageDecodeOptions{}.isFullDecode(imageSize));
+	CHECK_EQ(ImageDecodeOptions{ .maxSize = Size{ 320, 320 } }.getOutputSize(imageSize), Size{ 320, 180 });
+	CHECK_EQ(ImageDecodeOptions{ .maxSize = Size{ 3200, 3200 } }.getOutputSize(imageSize), imageSize);
+	CHECK_EQ(ImageDecodeOptions{ .sourceRect = Rect{ 1500, -100, 200, 300 } }.getSourceRect(imageSize), Rect{ 1500, 0, 100, 200 });
+	CHECK_EQ(ImageDecodeOptions{ .sourceRect = Rect{ 2000, 0, 100, 100 } }.getOutputSize(imageSize), Size{ 0, 0 });
+	CHECK_EQ(ImageDecodeOptions{ .scaleDenominator = 2, .maxSize = Size{ 100, 100 }, .sourceRect = Rect{ 0, 0, 800, 400 } }.getOutputSize(imageSize), Size{ 100, 50 });
+}
+
+TEST_CASE("ImageDecoder.sourceRect")
+{
+	Image source{ 256, 128, Color{ 0, 0, 255 } };
+
+	for (int32 y = 0; y < source.height(); ++y)
+	{
+		for (int32 x = 0; x < (source.width() / 2); ++x)
+		{
+			source[y][x] = Color{ 255, 0, 0 };
+		}
+	}
+
+	for (const ImageFormat format : { ImageFormat::PNG, ImageFormat::BMP, ImageFormat::TGA, ImageFormat::QOI })
+	{
+		const Blob blob = ImageEncoder::Encode(source, format);
+
+		const Image full = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, ImageDecodeOptions{}, format);
+		CHECK_EQ(full, source);
+
+		const Image right = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, ImageDecodeOptions{ .sourceRect = Rect{ 128, 32, 128, 64 } }, format);
+		CHECK_EQ(right.size(), Size{ 128, 64 });
+		CHECK(std::ranges::all_of(right, [](const Color& c) { return (c == Color{ 0, 0, 255 }); }));
+
+		const Image preview = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, ImageDecodeOptions{ .maxSize = Size{ 64, 64 } }, format);
+		CHECK_EQ(preview.size(), Size{ 64, 32 });
+		CHECK_EQ(preview[0][0], Color{ 255, 0, 0 });
+		CHECK_EQ(preview[31][63], Color{ 0, 0, 255 });
+	}
+}
+
+TEST_CASE("ImageDecoder.JPEG.scaleDenominator")
+{
+	const Blob blob = ImageEncoder::Encode(Image{ 640, 480, Palette::Orange }, ImageFormat::JPEG);
+
+	for (const int32 scaleDenominator : { 1, 2, 4, 8 })
+	{
+		const Image image = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, ImageDecodeOptions{ .scaleDenominator = scaleDenominator }, ImageFormat::JPEG);
+		CHECK_EQ(image.size(), Size{ (640 / scaleDenominator), (480 / scaleDenominator) });
+	}
+
+	const Image full = ImageDecoder::Decode(MemoryReader{ blob }, PremultiplyAlpha::Yes, ImageFormat::JPEG);
+	CHECK_EQ(full.size(), Size{ 640, 480 });
+	CHECK_EQ(full[0][0].a, 255);
+}
+
+TEST_CASE("PNGEncoder.Parallelize")
+{
+	for (const PNGFilter filter : { PNGFilter::Default, PNGFilter::None_, PNGFilter::Paeth, PNGFilter{ PNGFilter::Sub | PNGFilter::Avg } })
+	{
+		for (const Size size : { Size{ 1, 1 }, Size{ 3, 700 }, Size{ 1500, 1000 } })
+		{
+			Image image{ size };
+
+			for (size_t i = 0; i < image.num_pixels(); ++i)
+			{
+				image.data()[i] = ((i % 7 < 3) ? Color{ RandomUint8(), RandomUint8(), RandomUint8(), RandomUint8() } : Color{ static_cast<uint8>(i), 0, 0, 255 });
+			}
+
+			const Blob blob = image.encodePNG(filter, Parallelize::Yes);
+			const Image decoded = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, PremultiplyAlpha::No, ImageFormat::PNG);
+
+			CHECK_EQ(decoded, image);
+		}
+	}
+
+	// 空の画像は不正なストリームを作らずに失敗する
+	{
+		const ScopedLogSilencer logSilencer;
+
+		CHECK(Image{}.encodePNG(PNGFilter::Default, Parallelize::Yes).isEmpty());
+
+		MemoryWriter writer;
+		CHECK_FALSE(PNGEncoder{}.encode(Image{}, writer, PNGFilter::Default, Parallelize::Yes));
+		CHECK_EQ(writer.size(), 0);
+	}
+}
+
+TEST_CASE("QOIEncoder")
+{
+	for (const Size size : { Size{ 1, 1 }, Size{ 3, 700 }, Size{ 300, 200 } })
+	{
+		Image image{ size };
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			image.data()[i] = ((i % 7 < 3) ? Color{ RandomUint8(), RandomUint8(), RandomUint8(), RandomUint8() } : Color{ static_cast<uint8>(i / 3), 0, 0, 255 });
+		}
+
+		const Blob blob = ImageEncoder::Encode(image, ImageFormat::QOI);
+
+		const Optional<ImageInfo> info = ImageDecoder::GetImageInfo(MemoryViewReader{ blob.data(), blob.size() });
+		REQUIRE(info);
+		CHECK_EQ(info->imageFormat, ImageFormat::QOI);
+		CHECK_EQ(info->size, size);
+
+		const Image decoded = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, PremultiplyAlpha::No);
+		CHECK_EQ(decoded, image);
+	}
+}
+
+TEST_CASE("ImageProcessing.Resize")
+{
+	const Image image = MakeTestImage(97);
+
+	for (const GammaCorrect gammaCorrect : { GammaCorrect::No, GammaCorrect::Yes })
+	{
+		for (const Size size : { Size{ 40, 30 }, Size{ 300, 400 }, Size{ 40, 30 } })
+		{
+			const Image resized = ImageProcessing::Resize(image, size, ResizeFilter::Mitchell, gammaCorrect);
+			CHECK_EQ(resized.size(), size);
+
+			// 再利用されたリサイズプランでも同じ結果になる
+			CHECK_EQ(ImageProcessing::Resize(image, size, ResizeFilter::Mitchell, gammaCorrect), resized);
+		}
+	}
+
+	{
+		const Image resized = ImageProcessing::Resize(image, Size{ 194, 194 }, ResizeFilter::Nearest);
+		CHECK_EQ(resized[Point{ 3, 5 }], image[Point{ 1, 2 }]);
+	}
+
+	CHECK(ImageProcessing::Resize(Image{}, Size{ 10, 10 }).isEmpty());
+	CHECK(ImageProcessing::Resize(image, Size{ 0, 10 }).isEmpty());
+}
+
+TEST_CASE("ImageProcessing.BuildPyramid")
+{
+	{
+		const Image image{ 37, 22, Color{ 13, 200, 77, 99 } };
+		const Array<Image> pyramid = ImageProcessing::BuildPyramid(image);
+
+		REQUIRE_EQ(pyramid.size(), ImageProcessing::CalculateMipmapLevel(37, 22));
+		CHECK_EQ(pyramid[0], image);
+
+		for (size_t i = 1; i < pyramid.size(); ++i)
+		{
+			CHECK_EQ(pyramid[i].size(), Size{ Max((37 >> i), 1), Max((22 >> i), 1) });
+			CHECK(std::all_of(pyramid[i].begin(), pyramid[i].end(), [](const Color& c) { return (c == Color{ 13, 200, 77, 99 }); }));
+		}
+	}
+
+	{
+		Image image{ 8, 8 };
+
+		for (int32 y = 0; y < 8; ++y)
+		{
+			for (int32 x = 0; x < 8; ++x)
+			{
+				image[y][x] = (((x + y) % 2) ? Palette::White : Palette::Black);
+			}
+		}
+
+		// 線形の色空間では 50% のグレーは sRGB で 188 になる
+		CHECK_EQ(ImageProcessing::BuildPyramid(image, GammaCorrect::Yes)[1][Point{ 0, 0 }], Color{ 188, 188, 188, 255 });
+		CHECK_EQ(ImageProcessing::BuildPyramid(image, GammaCorrect::No)[1][Point{ 0, 0 }], Color{ 128, 128, 128, 255 });
+	}
+
+	{
+		const Image image = MakeTestImage(37);
+		const Array<Image> pyramid = ImageProcessing::BuildPyramid(image);
+		const Array<Image> mipmaps = ImageProcessing::BuildPyramid(image, GammaCorrect::Yes, IncludeSource::No);
+
+		// 元の画像を含めない場合は、1/2 に縮小したレベルから始まる
+		REQUIRE_EQ(mipmaps.size(), (pyramid.size() - 1));
+
+		for (size_t i = 0; i < mipmaps.size(); ++i)
+		{
+			CHECK_EQ(mipmaps[i], pyramid[i + 1]);
+		}
+
+		CHECK(ImageProcessing::BuildPyramid(Image{ 1, 1, Palette::White }, GammaCorrect::Yes, IncludeSource::No).isEmpty());
+	}
+
+	CHECK(ImageProcessing::BuildPyramid(Image{}).isEmpty());
+}
+
+TEST_CASE("ImageProcessing.SeparableConvolve")
+{
+	const Image image = MakeTestImage(67);
+
+	SUBCASE("Identity")
+	{
+		constexpr float Identity[] = { 1.0f };
+		CHECK_EQ(ImageProcessing::SeparableConvolve(image, Identity, Identity), image);
+		CHECK_EQ(ImageProcessing::SeparableConvolve(image, {}, {}), image);
+	}
+
+	SUBCASE("Kernel range")
+	{
+		const ScopedLogSilencer logSilencer;
+
+		// 係数の絶対値の合計が 2 を超えるカーネルは、固定小数点の中間結果があふれるため使えない
+		constexpr float Valid[] = { -0.25f, 1.5f, -0.25f };
+		constexpr float Invalid[] = { -1.0f, 3.0f, -1.0f };
+		CHECK_EQ(ImageProcessing::SeparableConvolve(image, Valid, Valid).size(), image.size());
+		CHECK(ImageProcessing::SeparableConvolve(image, Invalid, {}).isEmpty());
+		CHECK(ImageProcessing::SeparableConvolve(image, {}, Invalid).isEmpty());
+		CHECK_EQ(ImageProcessing::SeparableConvolve(Grid<float>(4, 4, 1.0f), Invalid, Invalid)[Point{ 1, 1 }], doctest::Approx(1.0f));
+	}
+
+	SUBCASE("Flat")
+	{
+		const Image flat{ 31, 17, Color{ 13, 200, 77, 99 } };
+		CHECK_EQ(ImageProcessing::GaussianBlur(flat, 2.5), flat);
+		CHECK_EQ(ImageProcessing::BoxBlur(flat, 4), flat);
+	}
+
+	SUBCASE("BoxBlur")
+	{
+		const Array<float> kernel(7, (1.0f / 7.0f));
+		const Image a = ImageProcessing::BoxBlur(image, 3);
+		const Image b = ImageProcessing::SeparableConvolve(image, kernel, kernel);
+		REQUIRE_EQ(a.size(), image.size());
+
+		for (size_t i = 0; i < a.num_pixels(); ++i)
+		{
+			const Color ca = a.data()[i];
+			const Color cb = b.data()[i];
+			CHECK_LE(std::abs(ca.r - cb.r), 1);
+			CHECK_LE(std::abs(ca.a - cb.a), 1);
+		}
+	}
+
+	SUBCASE("Sharpen")
+	{
+		CHECK_EQ(ImageProcessing::Sharpen(image, 1.0, 0.0), image);
+
+		const Image sharpened = ImageProcessing::Sharpen(image, 1.0, 1.5);
+		CHECK(std::equal(image.begin(), image.end(), sharpened.begin(), [](const Color& a, const Color& b) { return (a.a == b.a); }));
+	}
+
+	SUBCASE("Grid")
+	{
+		Grid<float> grid(40, 30);
+		RandomFill(std::span<float>{ grid.data(), grid.num_elements() }, 0.0f, 1.0f, 12345);
+
+		const float kernel[] = { 0.2f, 0.2f, 0.2f, 0.2f, 0.2f };
+		const Grid<float> a = ImageProcessing::BoxBlur(grid, 2);
+		const Grid<float> b = ImageProcessing::SeparableConvolve(grid, kernel, kernel);
+
+		for (size_t i = 0; i < a.num_elements(); ++i)
+		{
+			CHECK(a.data()[i] == doctest::Approx(b.data()[i]).epsilon(1e-5));
+		}
+
+		const Grid<float> flat(9, 7, 0.5f);
+
+		for (const float value : ImageProcessing::GaussianBlur(flat, 3.0))
+		{
+			CHECK(value == doctest::Approx(0.5f).epsilon(1e-5));
+		}
+	}
+
+	CHECK(ImageProcessing::GaussianBlur(Image{}, 1.0).isEmpty());
+	CHECK(ImageProcessing::BoxBlur(Grid<float>{}, 1).isEmpty());
+}
+
+TEST_CASE("BCnEncoder")
+{
+	const BCnEncoder encoder;
+	Image image{ 68, 36 };
+
+	for (size_t i = 0; i < image.num_pixels(); ++i)
+	{
+		image.data()[i] = ((i % 5 < 2) ? Color{ RandomUint8(), RandomUint8(), RandomUint8(), RandomUint8() } : Color{ static_cast<uint8>(i), static_cast<uint8>(i / 68), 0, 255 });
+	}
+
+	const uint8 mipCount = ImageProcessing::CalculateMipmapLevel(image.width(), image.height());
+
+	for (const BCnQuality quality : { BCnQuality::Fastest, BCnQuality::Default, BCnQuality::Highest })
+	{
+		for (const double rdoLambda : { 0.0, 1.0 })
+		{
+			const Array<Blob> blobs = {
+				encoder.encodeBC1(image, GenerateMipmaps::Yes, quality, rdoLambda),
+				encoder.encodeBC3(image, GenerateMipmaps::Yes, quality, rdoLambda),
+				encoder.encodeBC4(image, GenerateMipmaps::Yes, quality, rdoLambda),
+				encoder.encodeBC5(image, GenerateMipmaps::Yes, quality, rdoLambda),
+				encoder.encodeBC7(image, GenerateMipmaps::Yes, quality, rdoLambda),
+			};
+
+			for (size_t i = 0; i < blobs.size(); ++i)
+			{
+				const size_t blockBytes = (((i == 0) || (i == 2)) ? 8 : 16);
+				const BCnData data = BCnDecoder{}.decodeNative(std::make_unique<MemoryReader>(blobs[i]), false);
+
+				REQUIRE(data);
+				CHECK_EQ(data.size, image.size());
+				REQUIRE_EQ(data.textures.size(), mipCount);
+
+				for (uint32 mip = 0; mip < mipCount; ++mip)
+				{
+					const size_t xBlocks = ((Max((image.width() >> mip), 1) + 3) / 4);
+					const size_t yBlocks = ((Max((image.height() >> mip), 1) + 3) / 4);
+					CHECK_EQ(data.textures[mip].size(), (xBlocks * yBlocks * blockBytes));
+				}
+			}
+
+			// 並列化しても結果は決定的
+			CHECK_EQ(encoder.encodeBC7(image, GenerateMipmaps::Yes, quality, rdoLambda), blobs[4]);
+		}
+	}
+
+	CHECK(encoder.encodeBC1(Image{ 6, 8 }).isEmpty());
+}
+
 # if SIV3D_RUN_BENCHMARK
 
 TEST_CASE("Image.premultiplyAlpha.Benchmark")
@@ -109,4 +436,151 @@ TEST_CASE("Image.bgraToRGBA.Benchmark")
 	}
 }
 
+TEST_CASE("ImageDecoder.JPEG.scaleDenominator.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Blob blob = ImageEncoder::Encode(MakeTestImage(2048), ImageFormat::JPEG);
+
+	for (const int32 scaleDenominator : { 1, 2, 4, 8 })
+	{
+		Bench{}.title("Decode 2048x2048 JPEG").relative(true).run(fmt::format("scaleDenominator = {}", scaleDenominator), [&]()
+			{
+				const Image image = ImageDecoder::Decode(MemoryViewReader{ blob.data(), blob.size() }, ImageDecodeOptions{ .scaleDenominator = scaleDenominator }, ImageFormat::JPEG);
+				doNotOptimizeAway(image);
+			});
+	}
+}
+
+TEST_CASE("PNGEncoder.Parallelize.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Image image{ 3840, 2160 };
+
+	for (size_t i = 0; i < image.num_pixels(); ++i)
+	{
+		image.data()[i] = Color{ static_cast<uint8>(i / 64), static_cast<uint8>(i / 4096), RandomUint8(), 255 };
+	}
+
+	Bench{}.title("Encode 3840x2160 PNG").relative(true).run("Parallelize::No", [&]()
+		{
+			doNotOptimizeAway(image.encodePNG(PNGFilter::Default, Parallelize::No));
+		});
+
+	Bench{}.title("Encode 3840x2160 PNG").relative(true).run("Parallelize::Yes", [&]()
+		{
+			doNotOptimizeAway(image.encodePNG(PNGFilter::Default, Parallelize::Yes));
+		});
+}
+
+TEST_CASE("QOIEncoder.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Image image{ 3840, 2160 };
+
+	for (size_t i = 0; i < image.num_pixels(); ++i)
+	{
+		image.data()[i] = Color{ static_cast<uint8>(i / 64), static_cast<uint8>(i / 4096), RandomUint8(), 255 };
+	}
+
+	Bench{}.title("Encode 3840x2160").relative(true).run("PNG", [&]()
+		{
+			doNotOptimizeAway(ImageEncoder::Encode(image, ImageFormat::PNG));
+		});
+
+	Bench{}.title("Encode 3840x2160").relative(true).run("QOI", [&]()
+		{
+			doNotOptimizeAway(ImageEncoder::Encode(image, ImageFormat::QOI));
+		});
+
+	const Blob png = ImageEncoder::Encode(image, ImageFormat::PNG);
+	const Blob qoi = ImageEncoder::Encode(image, ImageFormat::QOI);
+
+	Bench{}.title("Decode 3840x2160").relative(true).run("PNG", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::Decode(MemoryViewReader{ png.data(), png.size() }, PremultiplyAlpha::No, ImageFormat::PNG));
+		});
+
+	Bench{}.title("Decode 3840x2160").relative(true).run("QOI", [&]()
+		{
+			doNotOptimizeAway(ImageDecoder::Decode(MemoryViewReader{ qoi.data(), qoi.size() }, PremultiplyAlpha::No, ImageFormat::QOI));
+		});
+}
+
+TEST_CASE("ImageProcessing.BuildPyramid.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Image image = MakeTestImage(2048);
+
+	Bench{}.title("Mip chain 2048x2048").relative(true).run("Resize per level", [&]()
+		{
+			Image previous = image;
+
+			for (uint8 level = 1; level < ImageProcessing::CalculateMipmapLevel(2048, 2048); ++level)
+			{
+				previous = ImageProcessing::Resize(previous, Size{ Max((2048 >> level), 1), Max((2048 >> level), 1) }, ResizeFilter::Box, GammaCorrect::Yes);
+			}
+
+			doNotOptimizeAway(previous);
+		});
+
+	Bench{}.title("Mip chain 2048x2048").relative(true).run("BuildPyramid", [&]()
+		{
+			doNotOptimizeAway(ImageProcessing::BuildPyramid(image));
+		});
+}
+
+TEST_CASE("ImageProcessing.Blur.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const Image image = MakeTestImage(2048);
+
+	Bench{}.title("Blur 2048x2048").relative(true).run("GaussianBlur sigma 2", [&]()
+		{
+			doNotOptimizeAway(ImageProcessing::GaussianBlur(image, 2.0));
+		});
+
+	Bench{}.title("Blur 2048x2048").relative(true).run("GaussianBlur sigma 8", [&]()
+		{
+			doNotOptimizeAway(ImageProcessing::GaussianBlur(image, 8.0));
+		});
+
+	Bench{}.title("Blur 2048x2048").relative(true).run("BoxBlur radius 24", [&]()
+		{
+			doNotOptimizeAway(ImageProcessing::BoxBlur(image, 24));
+		});
+}
+
+TEST_CASE("BCnEncoder.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+	const BCnEncoder encoder;
+
+	Image image{ 2048, 2048 };
+
+	for (size_t i = 0; i < image.num_pixels(); ++i)
+	{
+		image.data()[i] = Color{ static_cast<uint8>(i / 64), static_cast<uint8>(i / 4096), RandomUint8(), 255 };
+	}
+
+	Bench{}.title("Encode 2048x2048 BC1 with mipmaps").relative(true).run("Fast", [&]()
+		{
+			doNotOptimizeAway(encoder.encodeBC1(image, GenerateMipmaps::Yes, BCnQuality::Fast));
+		});
+
+	Bench{}.title("Encode 2048x2048 BC1 with mipmaps").relative(true).run("Default", [&]()
+		{
+			doNotOptimizeAway(encoder.encodeBC1(image, GenerateMipmaps::Yes, BCnQuality::Default));
+		});
+
+	Bench{}.title("Encode 2048x2048 BC7 with mipmaps").relative(true).run("Default", [&]()
+		{
+			doNotOptimizeAway(encoder.encodeBC7(image, GenerateMipmaps::Yes, BCnQuality::Default));
+		});
+}
+
 # endif
@@ -0,0 +1,144 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("InternedString")
+{
+	{
+		const InternedString s;
+		CHECK(s.isEmpty());
+		CHECK(s.size() == 0);
+		CHECK_EQ(s.data()[0], U'\0');
+		CHECK_EQ(s, InternedString{ U"" });
+		CHECK_EQ(s.hash(), StringView{}.hash());
+	}
+
+	{
+		const String text = U"Siv3D";
+		const InternedString a{ U"Siv3D" };
+		const InternedString b{ text };
+
+		CHECK_EQ(a, b);
+		CHECK(a.data() == b.data());
+		CHECK_EQ(a.view(), U"Siv3D");
+		CHECK_EQ(a.str(), text);
+		CHECK_EQ(a.data()[a.size()], U'\0');
+		CHECK_EQ(a.hash(), text.hash());
+		CHECK(a == U"Siv3D");
+		CHECK(a != InternedString{ U"OpenSiv3D" });
+		CHECK(InternedString{ U"a" } < InternedString{ U"b" });
+		CHECK_EQ(U"{}"_fmt(a), text);
+	}
+
+	{
+		const InternedString a{ U"InternedString.Find" };
+		CHECK(InternedString::Find(U"InternedString.Find"));
+		CHECK_EQ(*InternedString::Find(U"InternedString.Find"), a);
+		CHECK_FALSE(InternedString::Find(U"InternedString.NotFound"));
+	}
+}
+
+TEST_CASE("InternedString.Threading")
+{
+	constexpr size_t N = 10000;
+	Array<Array<const char32*>> pointers(Threading::GetConcurrency());
+
+	Threading::ParallelFor(pointers.size(), [&](const size_t begin, const size_t end)
+		{
+			for (size_t t = begin; t < end; ++t)
+			{
+				for (size_t i = 0; i < N; ++i)
+				{
+					pointers[t] << InternedString{ U"thread{}"_fmt(i) }.data();
+				}
+			}
+		});
+
+	for (const auto& p : pointers)
+	{
+		CHECK(p == pointers.front());
+	}
+}
+
+TEST_CASE("InternedString.HashMap")
+{
+	{
+		HashMap<String, int32> table = { { U"one", 1 }, { U"two", 2 } };
+		CHECK_EQ(table.find(InternedString{ U"one" })->second, 1);
+		CHECK(table.contains(InternedString{ U"two" }));
+		CHECK_FALSE(table.contains(InternedString{ U"three" }));
+	}
+
+	{
+		HashMap<InternedString, int32> table;
+		table[InternedString{ U"one" }] = 1;
+		table[InternedString{ U"two" }] = 2;
+		CHECK_EQ(table[InternedString{ U"one" }], 1);
+		CHECK(table.size() == 2);
+	}
+
+	{
+		HashSet<InternedString> set = { InternedString{ U"a" }, InternedString{ U"a" }, InternedString{ U"b" } };
+		CHECK(set.size() == 2);
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("InternedString.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Array<String> keys;
+	Array<InternedString> internedKeys;
+
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		keys << U"assets/textures/environment/item_{:04}.png"_fmt(i);
+		internedKeys << InternedString{ keys.back() };
+	}
+
+	HashMap<String, size_t> stringTable;
+	HashMap<InternedString, size_t> internedTable;
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		stringTable.emplace(keys[i], i);
+		internedTable.emplace(internedKeys[i], i);
+	}
+
+	Bench{}.title("HashMap lookup").relative(true).run("HashMap<String>::find(String)", [&]()
+		{
+			for (const auto& key : keys)
+			{
+				doNotOptimizeAway(stringTable.find(key));
+			}
+		});
+
+	Bench{}.title("HashMap lookup").relative(true).run("HashMap<String>::find(InternedString)", [&]()
+		{
+			for (const auto& key : internedKeys)
+			{
+				doNotOptimizeAway(stringTable.find(key));
+			}
+		});
+
+	Bench{}.title("HashMap lookup").relative(true).run("HashMap<InternedString>::find(InternedString)", [&]()
+		{
+			for (const auto& key : internedKeys)
+			{
+				doNotOptimizeAway(internedTable.find(key));
+			}
+		});
+}
+
+# endif
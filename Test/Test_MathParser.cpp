@@ -0,0 +1,180 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("MathParser")
+{
+	CHECK_EQ(Eval(U"1 + 2 * 3"), 7.0);
+	CHECK(not EvalOpt(U"1 +"));
+
+	{
+		double x = 2.0;
+		MathParser parser{ U"x * x + 1" };
+		parser.setVariable(U"x", &x);
+		CHECK_EQ(parser.eval(), 5.0);
+
+		x = 3.0;
+		CHECK_EQ(parser.eval(), 10.0);
+	}
+}
+
+TEST_CASE("MathParser.compile")
+{
+	double x = 0.0, y = 0.0, a = 3.0;
+	MathParser parser;
+	parser.setVariable(U"x", &x);
+	parser.setVariable(U"y", &y);
+	parser.setVariable(U"a", &a);
+
+	{
+		parser.setExpression(U"a * x + y ^ 2");
+		const CompiledExpression expression = parser.compile({ U"x", U"y" });
+		REQUIRE(expression);
+		CHECK(expression.num_columns() == 2);
+		CHECK_EQ(expression.eval({ 2.0, 3.0 }), 15.0);
+		CHECK(std::isnan(expression.eval({ 2.0 })));
+
+		// 列として指定しなかった変数は、コンパイル時の値で固定される
+		a = 100.0;
+		CHECK_EQ(expression.eval({ 2.0, 3.0 }), 15.0);
+		a = 3.0;
+	}
+
+	{
+		parser.setExpression(U"x > y ? sin(x) : max(x, y, 1) + sum(x, y)");
+		const CompiledExpression expression = parser.compile(Array<String>{ U"x", U"y" });
+		REQUIRE(expression);
+
+		Array<double> xs(1000), ys(1000), results(1000);
+
+		for (size_t i = 0; i < xs.size(); ++i)
+		{
+			xs[i] = (static_cast<double>(i % 17) - 8.0);
+			ys[i] = (static_cast<double>(i % 13) - 6.0);
+		}
+
+		CHECK(expression.evalColumns({ xs, ys }, results));
+
+		for (size_t i = 0; i < xs.size(); ++i)
+		{
+			x = xs[i];
+			y = ys[i];
+			CHECK_EQ(results[i], parser.eval());
+		}
+
+		CHECK(not expression.evalColumns({ xs }, results));
+		CHECK(not expression.evalColumns({ xs, std::span<const double>{ ys.data(), 10 } }, results));
+	}
+
+	{
+		// 複数のスレッドで分割して評価される行数
+		constexpr size_t NumRows = 100'000;
+
+		parser.setExpression(U"a * x - y / 2 + (x < y ? x : y)");
+		const CompiledExpression expression = parser.compile({ U"x", U"y" });
+		REQUIRE(expression);
+
+		Array<double> xs(NumRows), ys(NumRows), results(NumRows, Math::NaN);
+
+		for (size_t i = 0; i < NumRows; ++i)
+		{
+			xs[i] = (static_cast<double>(i % 1009) * 0.5);
+			ys[i] = (static_cast<double>(i % 997) * 0.25);
+		}
+
+		CHECK(expression.evalColumns({ xs, ys }, results));
+
+		size_t numMismatches = 0;
+
+		for (size_t i = 0; i < NumRows; ++i)
+		{
+			const double expected = (a * xs[i] - ys[i] / 2 + Min(xs[i], ys[i]));
+
+			if (results[i] != expected)
+			{
+				++numMismatches;
+			}
+		}
+
+		CHECK_EQ(numMismatches, 0);
+	}
+
+	{
+		// 代入を含む数式はコンパイルできず、変数も書き換えない
+		x = 5.0;
+		parser.setExpression(U"x = 1");
+		CHECK(not parser.compile({ U"x" }));
+		CHECK(not parser.getErrorMessage().isEmpty());
+		CHECK_EQ(x, 5.0);
+
+		parser.setExpression(U"a = x + 1");
+		CHECK(not parser.compile({ U"x" }));
+		CHECK_EQ(a, 3.0);
+		x = 0.0;
+
+		parser.setExpression(U"x, y");
+		CHECK(not parser.compile({ U"x", U"y" }));
+
+		parser.setExpression(U"x + z");
+		CHECK(not parser.compile({ U"x" }));
+
+		parser.setExpression(U"x + 1");
+		CHECK(not parser.compile({ U"w" }));
+		CHECK(parser.compile({ U"x" }));
+		CHECK(parser.getErrorMessage().isEmpty());
+	}
+
+	CHECK(not CompiledExpression{});
+	CHECK(not CompiledExpression{}.evalColumns({ std::span<const double>{} }, std::span<double>{}));
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("MathParser.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+	constexpr size_t N = 1'000'000;
+
+	double x = 0.0, y = 0.0;
+	MathParser parser{ U"x * x + 3 * y - sin(x) * 2 + (x > y ? x : y)" };
+	parser.setVariable(U"x", &x);
+	parser.setVariable(U"y", &y);
+	const CompiledExpression expression = parser.compile({ U"x", U"y" });
+
+	Array<double> xs(N), ys(N), results(N);
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		xs[i] = (i * 1e-6);
+		ys[i] = (1.0 - i * 1e-6);
+	}
+
+	Bench{}.title("MathParser 1M rows").relative(true).run("MathParser::eval", [&]()
+	{
+		for (size_t i = 0; i < N; ++i)
+		{
+			x = xs[i];
+			y = ys[i];
+			results[i] = parser.eval();
+		}
+
+		doNotOptimizeAway(results);
+	});
+
+	Bench{}.title("MathParser 1M rows").relative(true).run("CompiledExpression::evalColumns", [&]()
+	{
+		expression.evalColumns({ xs, ys }, results);
+		doNotOptimizeAway(results);
+	});
+}
+
+# endif
@@ -0,0 +1,134 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	static Array<String> MakePaths(const size_t count, const uint64 seed)
+	{
+		PRNG::SplitMix64 rng{ seed };
+		Array<String> paths(Arg::reserve = count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const uint64 r = rng();
+			paths << U"assets/stage{}/image{}_{}.png"_fmt((r % 50), ((r >> 8) % 1000), ((r >> 20) % 10));
+		}
+
+		return paths;
+	}
+
+	[[nodiscard]]
+	static Array<String> StableSortedByLess(Array<String> values)
+	{
+		std::ranges::stable_sort(values, NaturalSortLess{});
+		return values;
+	}
+}
+
+TEST_CASE("NaturalSortKey")
+{
+	const Array<String> values = { U"", U"a", U"a1", U"a2", U"a10", U"a10b", U"a100", U"b", U"file9.txt", U"file10.txt", U"file10a.txt", U"x/y", U"x1", U"x-1", U"ä", U"あ" };
+
+	for (const auto& lhs : values)
+	{
+		for (const auto& rhs : values)
+		{
+			const int32 expected = NaturalSortCompare(lhs, rhs);
+			const auto actual = (NaturalSortKey{ lhs } <=> NaturalSortKey{ rhs });
+			CHECK_EQ((expected < 0), (actual < 0));
+			CHECK_EQ((expected == 0), (actual == 0));
+			CHECK_EQ((expected > 0), (actual > 0));
+		}
+	}
+
+	// 長い数字ブロック
+	CHECK(NaturalSortKey{ U"a99999999999999999999" } < NaturalSortKey{ U"a100000000000000000000" });
+	CHECK(NaturalSortKey{ U"a" + String(300, U'9') } < NaturalSortKey{ U"a1" + String(300, U'0') });
+
+	// 先頭の 0 の個数だけが異なる
+	CHECK(NaturalSortKey{ U"a1" } < NaturalSortKey{ U"a01" });
+	CHECK_LT(NaturalSortCompare(U"a1", U"a01"), 0);
+
+	// NaturalSortCompare() は 0 を返すが、ソートキーは順序を決める
+	CHECK_EQ(NaturalSortCompare(U"a01", U"a1b"), 0);
+	CHECK(NaturalSortKey{ U"a01" } < NaturalSortKey{ U"a1b" });
+
+	CHECK(NaturalSortKey{}.size() == 0);
+}
+
+TEST_CASE("Array.sort_natural")
+{
+	{
+		Array<String> values = { U"img12.png", U"img10.png", U"IMG2.png", U"img1.png", U"img2.png" };
+		values.sort_natural();
+		CHECK_EQ(values, Array<String>{ U"IMG2.png", U"img1.png", U"img2.png", U"img10.png", U"img12.png" });
+	}
+
+	{
+		const Array<String> values = { U"b2", U"b10", U"a" };
+		CHECK_EQ(values.sorted_natural(), Array<String>{ U"a", U"b2", U"b10" });
+		CHECK_EQ(Array<String>{ U"b2", U"b10", U"a" }.sort_natural(), Array<String>{ U"a", U"b2", U"b10" });
+	}
+
+	{
+		CHECK(Array<String>{}.sorted_natural().isEmpty());
+	}
+
+	// 基数ソートと比較ソートの両方が使われる要素数で、安定ソートの結果と一致することを確認する
+	for (const size_t count : { 5, 300, 5000 })
+	{
+		const Array<String> paths = MakePaths(count, count);
+		const Array<String> expected = StableSortedByLess(paths);
+
+		CHECK_EQ(paths.sorted_natural(), expected);
+
+		Array<String> parallelSorted = paths;
+		parallelSorted.parallel_sort_natural();
+		CHECK_EQ(parallelSorted, expected);
+
+		const Array<String> longPaths = paths.map([](const String& path) { return (U"C:/Users/Siv3D/Documents/Projects/" + path); });
+		CHECK_EQ(longPaths.sorted_natural(), StableSortedByLess(longPaths));
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("NaturalSort.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+	const Array<String> paths = MakePaths(100'000, 12345);
+
+	Bench{}.title("Natural sort 100K paths").relative(true).run("std::ranges::sort(NaturalSortLess)", [&]()
+		{
+			Array<String> values = paths;
+			std::ranges::sort(values, NaturalSortLess{});
+			doNotOptimizeAway(values);
+		});
+
+	Bench{}.title("Natural sort 100K paths").relative(true).run("Array::sort_natural()", [&]()
+		{
+			Array<String> values = paths;
+			values.sort_natural();
+			doNotOptimizeAway(values);
+		});
+
+	Bench{}.title("Natural sort 100K paths").relative(true).run("Array::parallel_sort_natural()", [&]()
+		{
+			Array<String> values = paths;
+			values.parallel_sort_natural();
+			doNotOptimizeAway(values);
+		});
+}
+
+# endif
@@ -0,0 +1,147 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	static bool WaitForMessages(OSCReceiver& receiver, const size_t count)
+	{
+		for (int32 i = 0; i < 2000; ++i)
+		{
+			if (count <= receiver.num_messages())
+			{
+				return true;
+			}
+
+			System::Sleep(1);
+		}
+
+		return false;
+	}
+}
+
+TEST_CASE("OSC")
+{
+	// ポート番号 0 で受信を始め、OS が割り当てたポート番号に送信する
+	OSCReceiver receiver{ IPv4Endpoint::Localhost(0) };
+	REQUIRE_NE(receiver.endpoint().port(), 0);
+	OSCSender sender{ receiver.endpoint() };
+
+	SUBCASE("pop")
+	{
+		const Byte blob[3] = { Byte{ 1 }, Byte{ 2 }, Byte{ 3 } };
+
+		OSCMessage message;
+		message.beginMessage(U"/test")
+			.addInt32(42)
+			.addString(U"こんにちは")
+			.addFloat(1.5f)
+			.addBlob(blob)
+			.addRGBA(Color{ 10, 20, 30, 40 })
+			.endMessage();
+		sender.send(message);
+
+		REQUIRE(WaitForMessages(receiver, 1));
+
+		const OSCReceivedMessage received = receiver.pop();
+		CHECK_EQ(received.addressPattern, U"/test");
+		REQUIRE_EQ(received.arguments.size(), 5);
+		CHECK_EQ(received.arguments[0].getInt32(), 42);
+		CHECK_EQ(received.arguments[1].getString(), U"こんにちは");
+		CHECK_EQ(received.arguments[2].getFloat(), 1.5f);
+		CHECK_EQ(received.arguments[3].getBlob().size(), 3);
+		CHECK_EQ(received.arguments[4].getColor(), Color{ 10, 20, 30, 40 });
+
+		CHECK_FALSE(receiver.hasMessages());
+		CHECK_THROWS_AS((void)receiver.pop(), Error);
+	}
+
+	SUBCASE("consume")
+	{
+		constexpr size_t N = 160;
+
+		// UDP は受信側の処理が追いつかないと取りこぼすため、少数ずつ送り、届いたことを確かめてから次を送る
+		constexpr size_t ChunkSize = 16;
+
+		Array<OSCMessage> messages;
+
+		for (size_t i = 0; i < N; ++i)
+		{
+			messages << OSCMessage{ 64 };
+			messages.back().beginMessage(U"/sensor").addInt32(static_cast<int32>(i)).addString(U"x").endMessage();
+		}
+
+		Array<int32> expected;
+		size_t numSent = 0;
+
+		for (size_t offset = 0; offset < N; offset += ChunkSize)
+		{
+			const std::span<const OSCMessage> chunk = std::span<const OSCMessage>{ messages }.subspan(offset, ChunkSize);
+
+			sender.send(chunk);
+			numSent += chunk.size();
+			REQUIRE(WaitForMessages(receiver, numSent));
+
+			sender.sendBundle(chunk);
+			numSent += chunk.size();
+			REQUIRE(WaitForMessages(receiver, numSent));
+
+			sender.sendBundle(chunk, 1, 128);
+			numSent += chunk.size();
+			REQUIRE(WaitForMessages(receiver, numSent));
+
+			for (int32 k = 0; k < 3; ++k)
+			{
+				for (size_t i = offset; i < (offset + chunk.size()); ++i)
+				{
+					expected << static_cast<int32>(i);
+				}
+			}
+		}
+
+		size_t count = 0;
+		bool ok = true;
+
+		const size_t consumed = receiver.consume([&](const OSCReceivedMessageView& message)
+			{
+				ok &= (message.addressPattern == "/sensor");
+				ok &= (message.arguments.size() == 2);
+				ok &= ((count < expected.size()) && (message.arguments[0].getInt32() == expected[count]));
+				ok &= (message.arguments[1].getString() == "x");
+				++count;
+			});
+
+		CHECK_EQ(consumed, (N * 3));
+		CHECK(ok);
+		CHECK_FALSE(receiver.hasMessages());
+	}
+
+	SUBCASE("nested bundle")
+	{
+		OSCMessage message;
+		message.beginBundle(12345)
+			.beginMessage(U"/a").addInt32(1).endMessage()
+			.beginBundle()
+				.beginMessage(U"/b").endMessage()
+			.endBundle()
+			.endBundle();
+		CHECK(message.isReady());
+		sender.send(message);
+
+		REQUIRE(WaitForMessages(receiver, 2));
+		CHECK_EQ(receiver.pop().addressPattern, U"/a");
+		CHECK_EQ(receiver.pop().addressPattern, U"/b");
+
+		message.clear();
+		CHECK_EQ(message.size(), 0);
+	}
+}
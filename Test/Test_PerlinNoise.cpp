@@ -0,0 +1,99 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("PerlinNoise.batchFractalNoise")
+{
+	const PerlinNoiseF noise{ 12345 };
+	const PerlinNoiseF::Parameters parameters{ .octaves = 6, .persistence = 0.5f };
+	const Size size{ 67, 45 };
+	const float baseX = -3.25f, baseY = 1.5f, xStep = 0.037f, yStep = 0.041f;
+
+	for (const auto type : { PerlinNoiseF::FractalType::FBm, PerlinNoiseF::FractalType::Turbulence, PerlinNoiseF::FractalType::Ridged })
+	{
+		Grid<float> grid(size);
+		noise.batchFractalNoise(grid.begin(), size, baseX, baseY, xStep, yStep, type, parameters, [](float n) { return n; }, Parallelize::No);
+
+		Grid<float> parallel(size);
+		noise.batchFractalNoise(parallel.begin(), size, baseX, baseY, xStep, yStep, type, parameters, [](float n) { return n; }, Parallelize::Yes);
+
+		CHECK(grid == parallel);
+
+		for (int32 y = 0; y < size.y; ++y)
+		{
+			for (int32 x = 0; x < size.x; ++x)
+			{
+				const float expected = noise.fractalNoise((baseX + x * xStep), (baseY + y * yStep), type, parameters);
+				CHECK(Abs(grid[y][x] - expected) < 1e-5f);
+			}
+		}
+	}
+}
+
+TEST_CASE("PerlinNoise.batchFractalNoise.Image")
+{
+	const PerlinNoise noise{ 42 };
+	const PerlinNoise::Parameters parameters{ .octaves = 4 };
+
+	Image image{ Size{ 30, 20 } };
+	noise.batchFractalNoise(image.begin(), image.size(), 0.0, 0.0, 0.1, 0.1, PerlinNoise::FractalType::Ridged, parameters,
+		[](double n) { return Color{ static_cast<uint8>(n * 255.0) }; });
+
+	for (int32 y = 0; y < image.height(); ++y)
+	{
+		for (int32 x = 0; x < image.width(); ++x)
+		{
+			const double expected = noise.fractalNoise((x * 0.1), (y * 0.1), PerlinNoise::FractalType::Ridged, parameters);
+			CHECK(image[y][x] == Color{ static_cast<uint8>(expected * 255.0) });
+		}
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("PerlinNoise.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	const PerlinNoiseF noise{ 12345 };
+	const PerlinNoiseF::Parameters parameters{ .octaves = 8 };
+	Grid<float> grid(1024, 1024);
+
+	Bench{}.title("fBm 1024x1024, 8 octaves").relative(true).run("octaveNoise()", [&]()
+		{
+			for (int32 y = 0; y < grid.height(); ++y)
+			{
+				for (int32 x = 0; x < grid.width(); ++x)
+				{
+					grid[y][x] = noise.octaveNoise((x / 256.0f), (y / 256.0f), parameters);
+				}
+			}
+
+			doNotOptimizeAway(grid);
+		});
+
+	Bench{}.title("fBm 1024x1024, 8 octaves").relative(true).run("batchFractalNoise(Parallelize::No)", [&]()
+		{
+			noise.batchFractalNoise(grid.begin(), grid.size(), 0.0f, 0.0f, (1 / 256.0f), (1 / 256.0f),
+				PerlinNoiseF::FractalType::FBm, parameters, [](float n) { return n; }, Parallelize::No);
+			doNotOptimizeAway(grid);
+		});
+
+	Bench{}.title("fBm 1024x1024, 8 octaves").relative(true).run("batchFractalNoise(Parallelize::Yes)", [&]()
+		{
+			noise.batchFractalNoise(grid.begin(), grid.size(), 0.0f, 0.0f, (1 / 256.0f), (1 / 256.0f),
+				PerlinNoiseF::FractalType::FBm, parameters, [](float n) { return n; }, Parallelize::Yes);
+			doNotOptimizeAway(grid);
+		});
+}
+
+# endif
@@ -0,0 +1,232 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+# if SIV3D_PLATFORM(MACOS) || SIV3D_PLATFORM(LINUX)
+
+// 1 行読み込むごとに、末尾に '!' を付けて 1 行書き出すワーカー。"crash" を受け取ると終了する
+static const Array<String> EchoWorker = { U"-c", U"while IFS= read -r line; do if [ \"$line\" = crash ]; then exit 1; fi; echo \"$line!\"; done" };
+
+// 子プロセスの標準出力を、閉じられるか timeout が経過するまで読み込む
+static std::string ReadAll(ChildProcess& child, const Duration& timeout)
+{
+	std::string output;
+	const Stopwatch stopwatch{ StartImmediately::Yes };
+
+	while (stopwatch.elapsed() < timeout)
+	{
+		char buffer[256];
+		const Optional<size_t> result = child.tryRead(buffer, sizeof(buffer));
+
+		if (not result)
+		{
+			break;
+		}
+
+		if (*result == 0)
+		{
+			System::Sleep(1ms);
+			continue;
+		}
+
+		output.append(buffer, *result);
+	}
+
+	return output;
+}
+
+TEST_CASE("ChildProcess")
+{
+	SUBCASE("Exit code")
+	{
+		ChildProcess child{ U"/bin/sh", Array<String>{ U"-c", U"exit 3" } };
+		REQUIRE(child);
+
+		child.wait();
+		CHECK_FALSE(child.isRunning());
+		CHECK_EQ(child.getExitCode(), 3);
+	}
+
+	SUBCASE("Spawn failure")
+	{
+		const ScopedLogSilencer logSilencer;
+
+		const ChildProcess child{ U"/nonexistent/siv3d-test-program" };
+		CHECK_FALSE(child);
+	}
+
+	SUBCASE("Round trip")
+	{
+		ChildProcess child{ U"/bin/cat", Pipe::StdInOut };
+		REQUIRE(child);
+
+		const std::string input = "Hello, Siv3D!\nsecond line\n";
+		size_t written = 0;
+
+		while (written < input.size())
+		{
+			const Optional<size_t> result = child.tryWrite((input.data() + written), (input.size() - written));
+			REQUIRE(result.has_value());
+			written += *result;
+		}
+
+		child.closeStdIn();
+
+		CHECK_EQ(ReadAll(child, 5s), input);
+
+		child.wait();
+		CHECK_EQ(child.getExitCode(), 0);
+	}
+
+	SUBCASE("Terminate")
+	{
+		ChildProcess child{ U"/bin/sh", Array<String>{ U"-c", U"sleep 10" } };
+		REQUIRE(child);
+		CHECK(child.isRunning());
+
+		child.terminate();
+		CHECK_FALSE(child.isRunning());
+		CHECK_EQ(child.getExitCode(), (128 + 9)); // SIGKILL
+	}
+
+	SUBCASE("Release")
+	{
+		const FilePath directory{ U"../../Test/output/childprocess/" };
+		FileSystem::Remove(directory);
+		REQUIRE(FileSystem::CreateDirectories(directory));
+
+		constexpr int32 NumChildren = 32;
+
+		// 実行中のまま破棄した子プロセスは終了させられず、最後まで実行される
+		for (int32 i = 0; i < NumChildren; ++i)
+		{
+			const ChildProcess child{ U"/bin/sh", Array<String>{ U"-c", Format(U"sleep 0.2; touch '", directory, i, U"'") } };
+			REQUIRE(child);
+		}
+
+		const auto numFinished = [&]()
+			{
+				int32 count = 0;
+
+				for (int32 i = 0; i < NumChildren; ++i)
+				{
+					count += FileSystem::Exists(Format(directory, i));
+				}
+
+				return count;
+			};
+
+		const Stopwatch stopwatch{ StartImmediately::Yes };
+
+		while ((numFinished() < NumChildren) && (stopwatch.elapsed() < 10s))
+		{
+			System::Sleep(10ms);
+		}
+
+		CHECK_EQ(numFinished(), NumChildren);
+
+		FileSystem::Remove(directory);
+	}
+}
+
+TEST_CASE("ProcessPool")
+{
+	SUBCASE("Round trip")
+	{
+		ProcessPool pool{ U"/bin/sh", EchoWorker, 4 };
+		REQUIRE(pool);
+		CHECK_EQ(pool.num_workers(), 4);
+
+		HashTable<uint64, String> expected;
+
+		for (int32 i = 0; i < 200; ++i)
+		{
+			const uint64 jobID = pool.submit(Format(U"job", i));
+			REQUIRE(jobID != 0);
+			expected.emplace(jobID, Format(U"job", i, U'!'));
+		}
+
+		pool.waitAll();
+		CHECK_EQ(pool.num_pendingJobs(), 0);
+
+		const Array<ProcessPool::JobResult> results = pool.retrieveResults();
+		REQUIRE_EQ(results.size(), expected.size());
+
+		for (const auto& result : results)
+		{
+			CHECK(result.succeeded);
+			CHECK_EQ(result.output, expected[result.jobID]);
+		}
+	}
+
+	SUBCASE("Worker crash and restart")
+	{
+		const ScopedLogSilencer logSilencer;
+
+		ProcessPool pool{ U"/bin/sh", EchoWorker, 1 };
+		REQUIRE(pool);
+
+		const uint64 job0 = pool.submit(U"a");
+		const uint64 job1 = pool.submit(U"crash");
+		const uint64 job2 = pool.submit(U"b");
+
+		pool.waitAll();
+
+		const Array<ProcessPool::JobResult> results = pool.retrieveResults();
+		REQUIRE_EQ(results.size(), 3);
+
+		CHECK_EQ(results[0].jobID, job0);
+		CHECK(results[0].succeeded);
+		CHECK_EQ(results[0].output, U"a!");
+
+		// ワーカーが終了したジョブは失敗として報告され、ワーカーは再起動される
+		CHECK_EQ(results[1].jobID, job1);
+		CHECK_FALSE(results[1].succeeded);
+
+		CHECK_EQ(results[2].jobID, job2);
+		CHECK(results[2].succeeded);
+		CHECK_EQ(results[2].output, U"b!");
+
+		CHECK_EQ(pool.num_workers(), 1);
+	}
+
+	SUBCASE("Restart limit")
+	{
+		const ScopedLogSilencer logSilencer;
+
+		// 起動直後に終了するワーカーは、再起動を繰り返さずに停止する
+		ProcessPool pool{ U"/bin/sh", Array<String>{ U"-c", U"exit 1" }, 1 };
+		const uint64 jobID = pool.submit(U"x");
+
+		for (int32 i = 0; (i < 100) && pool.isValid(); ++i)
+		{
+			pool.update(SecondsF{ 0.1 });
+		}
+
+		CHECK_FALSE(pool.isValid());
+		CHECK_EQ(pool.num_workers(), 0);
+		CHECK_EQ(pool.num_pendingJobs(), 0);
+
+		const Array<ProcessPool::JobResult> results = pool.retrieveResults();
+
+		if (jobID != 0)
+		{
+			REQUIRE_EQ(results.size(), 1);
+			CHECK_EQ(results[0].jobID, jobID);
+			CHECK_FALSE(results[0].succeeded);
+		}
+
+		CHECK_EQ(pool.submit(U"y"), 0);
+	}
+}
+
+# endif
@@ -0,0 +1,138 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("RandomFill")
+{
+	SUBCASE("range")
+	{
+		Array<double> values(100'000);
+		RandomFill(values, -2.0, 3.0, 12345);
+
+		CHECK(values.all([](double x) { return ((-2.0 <= x) && (x < 3.0)); }));
+
+		const double mean = (values.sum() / values.size());
+		CHECK(Abs(mean - 0.5) < 0.05);
+	}
+
+	SUBCASE("float")
+	{
+		Array<float> values(100'000);
+		RandomFill(values, 0.0f, 1.0f, 12345);
+
+		CHECK(values.all([](float x) { return ((0.0f <= x) && (x < 1.0f)); }));
+	}
+
+	SUBCASE("min > max")
+	{
+		Array<double> values(100'000);
+		RandomFill(values, 3.0, -2.0, 12345);
+
+		CHECK(values.all([](double x) { return ((-2.0 <= x) && (x < 3.0)); }));
+
+		const double mean = (values.sum() / values.size());
+		CHECK(Abs(mean - 0.5) < 0.05);
+
+		Array<double> swapped(100'000);
+		RandomFill(swapped, -2.0, 3.0, 12345);
+		CHECK_EQ(values, swapped);
+
+		Array<float> floats(100'000);
+		RandomFill(floats, 1.0f, 0.0f, 12345);
+		CHECK(floats.all([](float x) { return ((0.0f <= x) && (x < 1.0f)); }));
+		CHECK_FALSE(floats.all([first = floats.front()](float x) { return (x == first); }));
+	}
+
+	SUBCASE("deterministic")
+	{
+		Array<double> a(300'001), b(300'001), c(300'001);
+		RandomFill(a, 0.0, 1.0, 42);
+		RandomFill(b, 0.0, 1.0, 42, Parallelize::Yes);
+		RandomFill(c, 0.0, 1.0, 43);
+
+		CHECK_EQ(a, b);
+		CHECK_NE(a, c);
+	}
+}
+
+TEST_CASE("RandomFillNormal")
+{
+	Array<double> values(200'001);
+	RandomFillNormal(values, 10.0, 2.0, 12345, Parallelize::Yes);
+
+	const double mean = (values.sum() / values.size());
+	const double variance = (values.map([=](double x) { return ((x - mean) * (x - mean)); }).sum() / values.size());
+
+	CHECK(Abs(mean - 10.0) < 0.05);
+	CHECK(Abs(variance - 4.0) < 0.1);
+}
+
+TEST_CASE("RandomFillInt")
+{
+	Array<int32> values(100'000);
+	RandomFillInt(values, -3, 3, 12345);
+
+	CHECK(values.all([](int32 x) { return ((-3 <= x) && (x <= 3)); }));
+
+	for (int32 i = -3; i <= 3; ++i)
+	{
+		CHECK(values.contains(i));
+	}
+
+	RandomFillInt(values, Smallest<int32>, Largest<int32>, 12345);
+	CHECK(values.any([](int32 x) { return (x < 0); }));
+	CHECK(values.any([](int32 x) { return (0 < x); }));
+}
+
+TEST_CASE("RandomFillVec2")
+{
+	Array<Vec2> values(10'000);
+
+	RandomFillVec2(values, 5.0, 12345);
+	CHECK(values.all([](const Vec2& v) { return (Abs(v.length() - 5.0) < 1e-9); }));
+
+	RandomFillVec2(values, { 0.0, 10.0 }, { 20.0, 30.0 }, 12345);
+	CHECK(values.all([](const Vec2& v) { return (InRange(v.x, 0.0, 10.0) && InRange(v.y, 20.0, 30.0)); }));
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+TEST_CASE("RandomFill.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	Array<double> values(1'000'000);
+
+	Bench{}.title("Fill 1M doubles").relative(true).run("Random()", [&]()
+		{
+			for (auto& value : values)
+			{
+				value = Random(0.0, 1.0);
+			}
+
+			doNotOptimizeAway(values);
+		});
+
+	Bench{}.title("Fill 1M doubles").relative(true).run("RandomFill()", [&]()
+		{
+			RandomFill(values, 0.0, 1.0);
+			doNotOptimizeAway(values);
+		});
+
+	Bench{}.title("Fill 1M doubles").relative(true).run("RandomFill(Parallelize::Yes)", [&]()
+		{
+			RandomFill(values, 0.0, 1.0, Parallelize::Yes);
+			doNotOptimizeAway(values);
+		});
+}
+
+# endif
@@ -0,0 +1,114 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	constexpr StringView TestSVG = UR"(<svg xmlns="http://www.w3.org/2000/svg" width="600" height="400">
+<circle cx="300" cy="200" r="150" fill="#f80"/>
+<rect x="20" y="30" width="100" height="50" fill="#08f" stroke="#000" stroke-width="3"/>
+</svg>)";
+
+	// タイルごとにラスタライズするため、アンチエイリアスの値が ±1 ずれることがある
+	[[nodiscard]]
+	bool IsNearlySameRegion(const Image& image, const Image& region, const Point& pos)
+	{
+		for (int32 y = 0; y < region.height(); ++y)
+		{
+			for (int32 x = 0; x < region.width(); ++x)
+			{
+				const Color a = region[y][x];
+				const Color b = image[pos.y + y][pos.x + x];
+
+				if ((1 < AbsDiff(a.r, b.r)) || (1 < AbsDiff(a.g, b.g)) || (1 < AbsDiff(a.b, b.b)) || (1 < AbsDiff(a.a, b.a)))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+TEST_CASE("SVG.renderRegion")
+{
+	SVG svg = SVG::Parse(TestSVG);
+	REQUIRE(svg);
+
+	const Image full = svg.render();
+	REQUIRE(full.size() == Size{ 600, 400 });
+
+	SUBCASE("matches render()")
+	{
+		const Image region = svg.renderRegion(RectF{ 100, 50, 400, 300 }, 1.0);
+		CHECK(region.size() == Size{ 400, 300 });
+		CHECK(IsNearlySameRegion(full, region, Point{ 100, 50 }));
+	}
+
+	SUBCASE("cache and parallelization")
+	{
+		// キャッシュを使わない render() の結果と比較する
+		const RectF rect{ 130, 70, 400, 300 };
+		svg.clearTileCache();
+
+		const Image rendered = svg.renderRegion(rect, 1.0, Color{ 0, 0 }, PremultiplyAlpha::Yes, Parallelize::Yes);
+		CHECK(IsNearlySameRegion(full, rendered, Point{ 130, 70 }));
+
+		// 全てのタイルがキャッシュから合成される
+		const Image cached = svg.renderRegion(rect, 1.0, Color{ 0, 0 }, PremultiplyAlpha::Yes, Parallelize::No);
+		CHECK(IsNearlySameRegion(full, cached, Point{ 130, 70 }));
+
+		// 一部のタイルだけがキャッシュから合成される
+		const Image shifted = svg.renderRegion(RectF{ 200, 100, 390, 290 }, 1.0, Color{ 0, 0 }, PremultiplyAlpha::Yes, Parallelize::Yes);
+		CHECK(IsNearlySameRegion(full, shifted, Point{ 200, 100 }));
+
+		// キャッシュを使わない場合と一致する
+		svg.setTileCacheCapacity(0);
+		CHECK(svg.renderRegion(rect, 1.0, Color{ 0, 0 }, PremultiplyAlpha::Yes, Parallelize::No) == cached);
+		svg.setTileCacheCapacity(SVG::DefaultTileCacheCapacity);
+	}
+
+	SUBCASE("text")
+	{
+		const SVG textSVG = SVG::Parse(UR"(<svg xmlns="http://www.w3.org/2000/svg" width="600" height="400">
+<text x="20" y="200" font-size="80">Siv3D SVG</text>
+</svg>)");
+		REQUIRE(textSVG);
+
+		const Image textFull = textSVG.render();
+		const Image region = textSVG.renderRegion(RectF{ 0, 0, 600, 400 }, 1.0, Color{ 0, 0 }, PremultiplyAlpha::Yes, Parallelize::Yes);
+		CHECK(IsNearlySameRegion(textFull, region, Point{ 0, 0 }));
+	}
+
+	SUBCASE("scale")
+	{
+		const Image region = svg.renderRegion(RectF{ -10.25, 20.5, 100, 50 }, 2.0);
+		CHECK(region.size() == Size{ 201, 100 });
+
+		const Image full2 = svg.render(Size{ 1200, 800 });
+		const Image region2 = svg.renderRegion(RectF{ 300, 200, 200, 100 }, 2.0);
+		CHECK(IsNearlySameRegion(full2, region2, Point{ 600, 400 }));
+	}
+
+	SUBCASE("too large")
+	{
+		const ScopedLogSilencer logSilencer;
+
+		// int32 に変換すると小さな正の値に折り返す大きさも、空の画像になる
+		CHECK(svg.renderRegion(RectF{ 0, 0, 600, 400 }, 30.0).isEmpty());
+		CHECK(svg.renderRegion(RectF{ 0, 0, 1, 1 }, (4294967296.0 + 64.0)).isEmpty());
+		CHECK(svg.renderRegion(RectF{ 1e12, 0, 10, 10 }, 1.0).isEmpty());
+		CHECK(svg.renderRegion(RectF{ 0, 0, (Image::MaxWidth + 1), 1 }, 1.0).isEmpty());
+		CHECK_EQ(svg.renderRegion(RectF{ 0, 0, Image::MaxWidth, 1 }, 1.0).size(), Size{ Image::MaxWidth, 1 });
+	}
+}
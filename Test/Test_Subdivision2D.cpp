@@ -0,0 +1,134 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+/// @brief 各三角形の外接円の内側に他の点が無いかを調べます。
+[[nodiscard]]
+static bool IsDelaunay(const Array<Triangle>& triangles, const Array<Vec2>& points)
+{
+	for (const auto& triangle : triangles)
+	{
+		const Vec2 a = triangle.p0;
+		const Vec2 b = triangle.p1;
+		const Vec2 c = triangle.p2;
+		const double orientation = ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x));
+
+		for (const auto& p : points)
+		{
+			const Vec2 da = (a - p), db = (b - p), dc = (c - p);
+			const double det = ((da.lengthSq() * (db.x * dc.y - db.y * dc.x))
+				- (db.lengthSq() * (da.x * dc.y - da.y * dc.x))
+				+ (dc.lengthSq() * (da.x * db.y - da.y * db.x)));
+
+			// 外接円の内側にある（共円の点は許容する）
+			if (1e-3 < ((orientation < 0.0) ? -det : det))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+[[nodiscard]]
+static Array<Vec2> MakeTestPoints()
+{
+	Array<double> xs(400), ys(400);
+	RandomFill(xs, 0.0, 100.0, 12345);
+	RandomFill(ys, 0.0, 100.0, 54321);
+
+	Array<Vec2> points;
+
+	for (size_t i = 0; i < xs.size(); ++i)
+	{
+		points.emplace_back(xs[i], ys[i]);
+	}
+
+	// 重複する点
+	for (size_t i = 0; i < 50; ++i)
+	{
+		const Vec2 duplicate = points[i * 7];
+		points << duplicate;
+	}
+
+	// 同一直線上の点
+	for (int32 i = 0; i < 20; ++i)
+	{
+		points.emplace_back((5.0 + i * 4.5), 50.0);
+	}
+
+	return points;
+}
+
+TEST_CASE("Subdivision2D.addPointsBulk")
+{
+	const RectF rect{ 0, 0, 100, 100 };
+
+	SUBCASE("Same as addPoints")
+	{
+		const Array<Vec2> points = MakeTestPoints();
+
+		Subdivision2D incremental{ rect };
+		incremental.addPoints(points);
+		const Array<Triangle> expected = incremental.computeDelaunayTriangles();
+
+		for (const auto parallelize : { Parallelize::No, Parallelize::Yes })
+		{
+			Subdivision2D bulk{ rect };
+			const Array<Subdivision2D::VertexID> vertexIDs = bulk.addPointsBulk(points, parallelize);
+			REQUIRE_EQ(vertexIDs.size(), points.size());
+
+			for (size_t i = 0; i < points.size(); ++i)
+			{
+				CHECK_EQ(bulk.getVertex(vertexIDs[i]), points[i]);
+			}
+
+			// 重複する点は同じ頂点になる
+			for (size_t i = 0; i < 50; ++i)
+			{
+				CHECK_EQ(vertexIDs[400 + i], vertexIDs[i * 7]);
+			}
+
+			const Array<Triangle> triangles = bulk.computeDelaunayTriangles();
+			CHECK_EQ(triangles.size(), expected.size());
+			CHECK(IsDelaunay(triangles, points));
+		}
+
+		CHECK(IsDelaunay(expected, points));
+	}
+
+	SUBCASE("Collinear")
+	{
+		Array<Vec2> points;
+
+		for (int32 i = 0; i < 30; ++i)
+		{
+			points.emplace_back((1.0 + i * 3.0), (2.0 + i * 3.0));
+		}
+
+		Subdivision2D incremental{ rect };
+		incremental.addPoints(points);
+
+		Subdivision2D bulk{ rect };
+		const Array<Subdivision2D::VertexID> vertexIDs = bulk.addPointsBulk(points);
+		CHECK_EQ(vertexIDs.size(), points.size());
+		CHECK_EQ(bulk.computeDelaunayTriangles().size(), incremental.computeDelaunayTriangles().size());
+		CHECK_EQ(bulk.computeDelaunayEdges().size(), incremental.computeDelaunayEdges().size());
+	}
+
+	SUBCASE("Empty")
+	{
+		Subdivision2D bulk{ rect };
+		CHECK(bulk.addPointsBulk({}).isEmpty());
+	}
+}
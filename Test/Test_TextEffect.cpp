@@ -0,0 +1,209 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+// テキストエフェクトに渡された 1 グリフ分の情報
+struct RecordedGlyph
+{
+	FloatRect rect;
+
+	FloatRect uvRect;
+
+	GlyphContext glyphContext;
+};
+
+// draw() に渡されたグリフを記録する。drawBatch() はデフォルトの実装 (グリフごとの draw()) を使う
+class PerGlyphRecorder : public ITextEffect
+{
+public:
+
+	mutable Array<RecordedGlyph> glyphs;
+
+	void draw(const TextureRegion& textureRegion, const GlyphContext& glyphContext) const override
+	{
+		const Vec2& pos = glyphContext.pos;
+		glyphs << RecordedGlyph{ FloatRect{ pos.x, pos.y, (pos.x + textureRegion.size.x), (pos.y + textureRegion.size.y) }, textureRegion.uvRect, glyphContext };
+	}
+};
+
+// drawBatch() に渡されたグリフをまとめて記録する
+class BatchRecorder : public ITextEffect
+{
+public:
+
+	mutable Array<RecordedGlyph> glyphs;
+
+	mutable size_t batchCount = 0;
+
+	void draw(const TextureRegion&, const GlyphContext&) const override
+	{
+		FAIL("draw() should not be called");
+	}
+
+	void drawBatch(const Texture&, const std::span<const GlyphQuad> glyphQuads, const std::span<const GlyphContext> glyphContexts) const override
+	{
+		REQUIRE_EQ(glyphQuads.size(), glyphContexts.size());
+
+		for (size_t i = 0; i < glyphQuads.size(); ++i)
+		{
+			glyphs << RecordedGlyph{ glyphQuads[i].rect, glyphQuads[i].uvRect, glyphContexts[i] };
+		}
+
+		++batchCount;
+	}
+};
+
+// drawBatch() の中から同じフォントで別のテキストを描いたあとに、受け取ったグリフを記録する
+class NestedBatchRecorder : public BatchRecorder
+{
+public:
+
+	NestedBatchRecorder(const Font& font, const PerGlyphRecorder& inner)
+		: m_font{ font }
+		, m_inner{ inner } {}
+
+	void drawBatch(const Texture& texture, const std::span<const GlyphQuad> glyphQuads, const std::span<const GlyphContext> glyphContexts) const override
+	{
+		if (not m_drawing)
+		{
+			m_drawing = true;
+			m_font(U"nested text\nwith many glyphs").draw(Vec2{ 0, 300 }, m_inner);
+			m_drawing = false;
+		}
+
+		BatchRecorder::drawBatch(texture, glyphQuads, glyphContexts);
+	}
+
+private:
+
+	const Font& m_font;
+
+	const PerGlyphRecorder& m_inner;
+
+	mutable bool m_drawing = false;
+};
+
+// ユーザーが BasicTextEffect を継承して draw() だけをオーバーライドしたエフェクト
+class DerivedBasicRecorder : public TextEffect::BasicTextEffect
+{
+public:
+
+	mutable Array<RecordedGlyph> glyphs;
+
+	void draw(const TextureRegion& textureRegion, const GlyphContext& glyphContext) const override
+	{
+		const Vec2& pos = glyphContext.pos;
+		glyphs << RecordedGlyph{ FloatRect{ pos.x, pos.y, (pos.x + textureRegion.size.x), (pos.y + textureRegion.size.y) }, textureRegion.uvRect, glyphContext };
+	}
+};
+
+static void CheckSameGlyphs(const Array<RecordedGlyph>& batched, const Array<RecordedGlyph>& perGlyph)
+{
+	REQUIRE_EQ(batched.size(), perGlyph.size());
+
+	for (size_t i = 0; i < batched.size(); ++i)
+	{
+		const RecordedGlyph& a = batched[i];
+		const RecordedGlyph& b = perGlyph[i];
+
+		CHECK_EQ(a.rect.left, doctest::Approx(b.rect.left));
+		CHECK_EQ(a.rect.top, doctest::Approx(b.rect.top));
+		CHECK_EQ(a.rect.right, doctest::Approx(b.rect.right));
+		CHECK_EQ(a.rect.bottom, doctest::Approx(b.rect.bottom));
+		CHECK_EQ(a.uvRect.left, b.uvRect.left);
+		CHECK_EQ(a.uvRect.top, b.uvRect.top);
+		CHECK_EQ(a.uvRect.right, b.uvRect.right);
+		CHECK_EQ(a.uvRect.bottom, b.uvRect.bottom);
+		CHECK_EQ(a.glyphContext.pos, b.glyphContext.pos);
+		CHECK_EQ(a.glyphContext.index, b.glyphContext.index);
+		CHECK_EQ(a.glyphContext.totalGlyphCount, b.glyphContext.totalGlyphCount);
+		CHECK_EQ(a.glyphContext.isColorGlyph, b.glyphContext.isColorGlyph);
+	}
+}
+
+static void CheckTextEffects(const Font& font)
+{
+	const String text = U"Hello, Siv3D!\n\tBatched glyphs 0123456789";
+
+	// まとめて受け取ったグリフが、グリフごとの draw() と一致する
+	{
+		PerGlyphRecorder perGlyph;
+		BatchRecorder batched;
+
+		font(text).draw(Vec2{ 20, 40 }, perGlyph);
+		font(text).draw(Vec2{ 20, 40 }, batched);
+
+		CHECK_EQ(batched.batchCount, 1);
+		CHECK_FALSE(perGlyph.glyphs.isEmpty());
+		CheckSameGlyphs(batched.glyphs, perGlyph.glyphs);
+
+		PerGlyphRecorder perGlyphBase;
+		BatchRecorder batchedBase;
+
+		font(text).drawBase(Vec2{ 20, 40 }, perGlyphBase);
+		font(text).drawBase(Vec2{ 20, 40 }, batchedBase);
+
+		CheckSameGlyphs(batchedBase.glyphs, perGlyphBase.glyphs);
+	}
+
+	// BasicTextEffect の派生クラスは、オーバーライドした draw() がグリフごとに 1 回ずつ呼ばれる
+	{
+		PerGlyphRecorder perGlyph;
+		DerivedBasicRecorder derived;
+
+		font(text).draw(Vec2{ 20, 40 }, perGlyph);
+		font(text).draw(Vec2{ 20, 40 }, derived);
+
+		CHECK_FALSE(perGlyph.glyphs.isEmpty());
+		CheckSameGlyphs(derived.glyphs, perGlyph.glyphs);
+
+		DerivedBasicRecorder derivedBase;
+		font(text).drawBase(Vec2{ 20, 40 }, derivedBase);
+		CHECK_EQ(derivedBase.glyphs.size(), perGlyph.glyphs.size());
+	}
+
+	// drawBatch() の中で同じフォントを描いても、受け取ったグリフは壊れない
+	{
+		BatchRecorder expected;
+		font(text).draw(Vec2{ 20, 40 }, expected);
+
+		PerGlyphRecorder innerExpected;
+		font(U"nested text\nwith many glyphs").draw(Vec2{ 0, 300 }, innerExpected);
+
+		PerGlyphRecorder inner;
+		NestedBatchRecorder nested{ font, inner };
+		font(text).draw(Vec2{ 20, 40 }, nested);
+
+		CheckSameGlyphs(nested.glyphs, expected.glyphs);
+		CheckSameGlyphs(inner.glyphs, innerExpected.glyphs);
+	}
+}
+
+TEST_CASE("TextEffect")
+{
+	CHECK_FALSE(PerGlyphRecorder{}.isBatchable());
+	CHECK(TextEffect::BasicTextEffect{}.isBatchable());
+	CHECK_FALSE(TextEffect::FlipX{}.isBatchable());
+	CHECK_FALSE(TextEffect::QuadWarp{ 0.1, 0.2 }.isBatchable());
+	CHECK_FALSE(TextEffect::VerticalScale{ 0.5 }.isBatchable());
+	CHECK_FALSE(DerivedBasicRecorder{}.isBatchable());
+
+	SUBCASE("Bitmap")
+	{
+		CheckTextEffects(Font{ 24 });
+	}
+
+	SUBCASE("MSDF")
+	{
+		CheckTextEffects(Font{ FontMethod::MSDF, 24 });
+	}
+}
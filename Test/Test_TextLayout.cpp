@@ -0,0 +1,147 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+// 同じテキストと幅で新しく作り直したレイアウトと、行数・高さ・テキストが一致するかを調べる
+static void CheckSameAsRebuilt(const TextLayout& layout, const Font& font, const double fontSize)
+{
+	const TextLayout rebuilt{ font, fontSize, layout.width(), layout.getText() };
+
+	CHECK_EQ(layout.num_paragraphs(), rebuilt.num_paragraphs());
+	CHECK_EQ(layout.num_characters(), rebuilt.num_characters());
+	CHECK_EQ(layout.num_lines(), rebuilt.num_lines());
+	CHECK_EQ(layout.height(), rebuilt.height());
+}
+
+TEST_CASE("TextLayout")
+{
+	constexpr int32 FontSize = 20;
+	const Font font{ FontSize };
+
+	// "a" 1 文字分の進み幅
+	const double advance = (font(U"aa").region(FontSize).w - font(U"a").region(FontSize).w);
+	REQUIRE(0.0 < advance);
+
+	SUBCASE("Line breaking")
+	{
+		TextLayout layout{ font, FontSize, (advance * 4.5), U"aaaaaaaaaa" };
+		CHECK_EQ(layout.num_paragraphs(), 1);
+		CHECK_EQ(layout.num_lines(), 3);
+		CHECK_EQ(layout.lineHeight(), font.height(FontSize));
+		CHECK_EQ(layout.height(), (3 * layout.lineHeight()));
+
+		layout.setWidth(advance * 10.5);
+		CHECK_EQ(layout.num_lines(), 1);
+
+		// 1 行に少なくとも 1 グリフは置く
+		layout.setWidth(0.0);
+		CHECK_EQ(layout.num_lines(), 10);
+
+		// 空の段落も 1 行として数える
+		layout.setText(U"abc\n\nde");
+		CHECK_EQ(layout.num_paragraphs(), 3);
+		CHECK_EQ(layout.num_lines(), (3 + 1 + 2));
+
+		layout.setWidth(100000.0);
+		CHECK_EQ(layout.num_lines(), 3);
+		CHECK_EQ(layout.height(), (3 * layout.lineHeight()));
+
+		layout.clear();
+		CHECK_EQ(layout.num_paragraphs(), 1);
+		CHECK_EQ(layout.num_characters(), 0);
+		CHECK_EQ(layout.num_lines(), 1);
+	}
+
+	SUBCASE("Insert")
+	{
+		TextLayout layout{ font, FontSize, (advance * 4.5), U"aaaa\naaaa\naaaa" };
+		CHECK_EQ(layout.num_lines(), 3);
+
+		// 先頭の段落が 2 行になる
+		layout.insert(2, U"aa");
+		CHECK_EQ(layout.getText(), U"aaaaaa\naaaa\naaaa");
+		CHECK_EQ(layout.num_lines(), (2 + 1 + 1));
+		CHECK_EQ(layout.height(), (4 * layout.lineHeight()));
+		CheckSameAsRebuilt(layout, font, FontSize);
+
+		// 2 番目の段落が "aaa" と "aaaaaaaaaaa" に分かれる
+		layout.insert(9, U"a\naaaaaaaaa");
+		CHECK_EQ(layout.getText(), U"aaaaaa\naaa\naaaaaaaaaaa\naaaa");
+		CHECK_EQ(layout.num_paragraphs(), 4);
+		CHECK_EQ(layout.num_lines(), (2 + 1 + 3 + 1));
+		CheckSameAsRebuilt(layout, font, FontSize);
+
+		layout.append(U"\naaaa");
+		CHECK_EQ(layout.num_paragraphs(), 5);
+		CHECK_EQ(layout.num_lines(), 8);
+		CheckSameAsRebuilt(layout, font, FontSize);
+
+		// 範囲外の位置は末尾への追加になる
+		const size_t numCharacters = layout.num_characters();
+		layout.insert(100000, U"a");
+		CHECK_EQ(layout.num_characters(), (numCharacters + 1));
+		CHECK_EQ(layout.num_lines(), 9);
+		CheckSameAsRebuilt(layout, font, FontSize);
+	}
+
+	SUBCASE("Erase")
+	{
+		TextLayout layout{ font, FontSize, (advance * 4.5), U"aaaaaa\naaaa\naaaaaaaaaa\naaaa" };
+		CHECK_EQ(layout.num_lines(), (2 + 1 + 3 + 1));
+
+		// 1 つの段落の中での削除
+		layout.erase(0, 2);
+		CHECK_EQ(layout.getText(), U"aaaa\naaaa\naaaaaaaaaa\naaaa");
+		CHECK_EQ(layout.num_lines(), (1 + 1 + 3 + 1));
+		CHECK_EQ(layout.height(), (6 * layout.lineHeight()));
+		CheckSameAsRebuilt(layout, font, FontSize);
+
+		// 段落をまたぐ削除
+		layout.erase(2, 10);
+		CHECK_EQ(layout.getText(), U"aaaaaaaaaa\naaaa");
+		CHECK_EQ(layout.num_paragraphs(), 2);
+		CHECK_EQ(layout.num_lines(), (3 + 1));
+		CheckSameAsRebuilt(layout, font, FontSize);
+
+		// 末尾を越える削除
+		layout.erase(10, 100000);
+		CHECK_EQ(layout.getText(), U"aaaaaaaaaa");
+		CHECK_EQ(layout.num_lines(), 3);
+		CheckSameAsRebuilt(layout, font, FontSize);
+
+		layout.erase(0, layout.num_characters());
+		CHECK_EQ(layout.num_characters(), 0);
+		CHECK_EQ(layout.num_lines(), 1);
+	}
+
+	SUBCASE("Random edits")
+	{
+		TextLayout layout{ font, FontSize, (advance * 8.5) };
+		PRNG::SplitMix64 rng{ 12345 };
+
+		for (int32 i = 0; i < 200; ++i)
+		{
+			const size_t index = Random<size_t>(0, layout.num_characters(), rng);
+
+			if (Random(0, 2, rng) != 0)
+			{
+				layout.insert(index, ((Random(0, 3, rng) == 0) ? U"xy\nzzzzzzzzzzzz" : U"abcdefg"));
+			}
+			else
+			{
+				layout.erase(index, Random<size_t>(0, 20, rng));
+			}
+		}
+
+		CheckSameAsRebuilt(layout, font, FontSize);
+	}
+}
@@ -0,0 +1,136 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2026 Ryo Suzuki
+//	Copyright (c) 2016-2026 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("PackVertex2D")
+{
+	Array<Vertex2D> vertices(1000);
+
+	for (size_t i = 0; i < vertices.size(); ++i)
+	{
+		const float t = (static_cast<float>(i) / vertices.size());
+		vertices[i].set(Float2{ (i * 1.5f), (i * -0.5f) }, Float2{ t, (1.0f - t) }, Float4{ t, (t * 2.0f - 0.5f), 0.5f, (1.0f + t) });
+	}
+
+	SUBCASE("Vertex2DPacked")
+	{
+		Array<Vertex2DPacked> packed(vertices.size());
+		PackVertex2D(vertices, packed.data());
+
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			const Vertex2D& v = vertices[i];
+			CHECK_EQ(packed[i].pos, v.pos);
+			CHECK_EQ(packed[i].tex, v.tex);
+			CHECK_EQ(packed[i].color, Color{ Color::ToUint8(v.color.x), Color::ToUint8(v.color.y), Color::ToUint8(v.color.z), Color::ToUint8(v.color.w) });
+		}
+	}
+
+	SUBCASE("Vertex2DPackedHalf")
+	{
+		Array<Vertex2DPackedHalf> packed(vertices.size());
+		PackVertex2D(vertices, packed.data());
+
+		for (size_t i = 0; i < vertices.size(); ++i)
+		{
+			const Vertex2D& v = vertices[i];
+			CHECK_EQ(packed[i].pos, v.pos);
+			CHECK(Abs(packed[i].tex[0].asFloat() - v.tex.x) < 0.001f);
+			CHECK(Abs(packed[i].tex[1].asFloat() - v.tex.y) < 0.001f);
+			CHECK_EQ(packed[i].color, Color{ Color::ToUint8(v.color.x), Color::ToUint8(v.color.y), Color::ToUint8(v.color.z), Color::ToUint8(v.color.w) });
+		}
+	}
+}
+
+# if SIV3D_RUN_BENCHMARK
+
+namespace
+{
+	template <class VertexType, class SetVertex>
+	void GenerateRects(Array<VertexType>& vertices, const size_t rectCount, SetVertex setVertex)
+	{
+		VertexType* pVertex = vertices.data();
+
+		for (size_t i = 0; i < rectCount; ++i)
+		{
+			const float left = static_cast<float>(i % 1024);
+			const float top = static_cast<float>(i / 1024);
+			const Float4 color{ 0.25f, 0.5f, 0.75f, 1.0f };
+
+			setVertex(pVertex[0], left, top, 0.0f, 0.0f, color);
+			setVertex(pVertex[1], (left + 1.0f), top, 1.0f, 0.0f, color);
+			setVertex(pVertex[2], left, (top + 1.0f), 0.0f, 1.0f, color);
+			setVertex(pVertex[3], (left + 1.0f), (top + 1.0f), 1.0f, 1.0f, color);
+			pVertex += 4;
+		}
+	}
+}
+
+TEST_CASE("Vertex2D.Benchmark")
+{
+	const ScopedLogSilencer logSilencer;
+
+	constexpr size_t RectCount = 100'000;
+	Array<Vertex2D> vertices(RectCount * 4);
+	Array<Vertex2DPacked> packed(RectCount * 4);
+	Array<Vertex2DPackedHalf> packedHalf(RectCount * 4);
+	Array<Vertex2D> copied(RectCount * 4);
+
+	Bench{}.title("Generate 100K rects").relative(true).run("Vertex2D (32 bytes)", [&]()
+		{
+			GenerateRects(vertices, RectCount, [](Vertex2D& v, float x, float y, float u, float t, const Float4& color) { v.set(x, y, u, t, color); });
+			doNotOptimizeAway(vertices);
+		});
+
+	Bench{}.title("Generate 100K rects").relative(true).run("Vertex2DPacked (20 bytes)", [&]()
+		{
+			GenerateRects(packed, RectCount, [](Vertex2DPacked& v, float x, float y, float u, float t, const Float4& color)
+				{
+					v.pos.set(x, y);
+					v.tex.set(u, t);
+					v.color = Color{ Color::ToUint8(color.x), Color::ToUint8(color.y), Color::ToUint8(color.z), Color::ToUint8(color.w) };
+				});
+			doNotOptimizeAway(packed);
+		});
+
+	Bench{}.title("Generate 100K rects").relative(true).run("Vertex2DPackedHalf (16 bytes)", [&]()
+		{
+			GenerateRects(packedHalf, RectCount, [](Vertex2DPackedHalf& v, float x, float y, float u, float t, const Float4& color)
+				{
+					v.pos.set(x, y);
+					v.tex[0] = HalfFloat{ u };
+					v.tex[1] = HalfFloat{ t };
+					v.color = Color{ Color::ToUint8(color.x), Color::ToUint8(color.y), Color::ToUint8(color.z), Color::ToUint8(color.w) };
+				});
+			doNotOptimizeAway(packedHalf);
+		});
+
+	Bench{}.title("Upload 400K vertices").relative(true).run("memcpy Vertex2D", [&]()
+		{
+			std::memcpy(copied.data(), vertices.data(), vertices.size_bytes());
+			doNotOptimizeAway(copied);
+		});
+
+	Bench{}.title("Upload 400K vertices").relative(true).run("PackVertex2D -> Vertex2DPacked", [&]()
+		{
+			PackVertex2D(vertices, packed.data());
+			doNotOptimizeAway(packed);
+		});
+
+	Bench{}.title("Upload 400K vertices").relative(true).run("PackVertex2D -> Vertex2DPackedHalf", [&]()
+		{
+			PackVertex2D(vertices, packedHalf.data());
+			doNotOptimizeAway(packedHalf);
+		});
+}
+
+# endif